@@ -127,8 +127,8 @@ namespace
                 if ((themeIt->second.getType() == tgui::ObjectConverter::Type::RendererData)
                  && (widgetPropertyValuePairs[themeIt->first].getType() == tgui::ObjectConverter::Type::RendererData))
                 {
-                    if (compareRenderers(themeIt->second.getRenderer()->propertyValuePairs,
-                                         widgetPropertyValuePairs[themeIt->first].getRenderer()->propertyValuePairs))
+                    if (compareRenderers(themeIt->second.getRenderer()->propertyValuePairs.getMap(),
+                                         widgetPropertyValuePairs[themeIt->first].getRenderer()->propertyValuePairs.getMap()))
                     {
                         continue;
                     }
@@ -847,7 +847,7 @@ void GuiBuilder::loadForm()
             // This should make the comparison below slightly more accurate as it allows to compare some types instead of only strings.
             tgui::WidgetFactory::getConstructFunction(widget->ptr->getWidgetType())()->setRenderer(themeRenderer);
 
-            if (compareRenderers(themeRenderer->propertyValuePairs, widget->ptr->getSharedRenderer()->getPropertyValuePairs()))
+            if (compareRenderers(themeRenderer->propertyValuePairs.getMap(), widget->ptr->getSharedRenderer()->getPropertyValuePairs()))
             {
                 widget->theme = theme.first;
                 widget->ptr->setRenderer(themeRenderer); // Use the exact same renderer as the new widgets to keep it shared
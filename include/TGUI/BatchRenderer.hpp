@@ -0,0 +1,193 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_BATCH_RENDERER_HPP
+#define TGUI_BATCH_RENDERER_HPP
+
+#include <TGUI/Config.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <SFML/Graphics/Shape.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Collects the geometry drawn by the widgets and sends it to the render target in as few draw calls as possible
+        ///
+        /// Vertices are transformed on the CPU and stored in batches of triangles that share the same texture, shader, blend mode
+        /// and view. A new piece of geometry is merged with an earlier batch with the same states as long as none of the batches
+        /// that were added in between overlap with it, so the result looks exactly the same as when everything was drawn in order.
+        /// The view is stored in the batch, which means that a clipping area only splits a batch when it actually differs.
+        ///
+        /// Drawables that can't be batched (e.g. text) flush the pending batches before they are drawn.
+        ///
+        /// While an OpacityScope exists, the alpha of everything that is drawn is multiplied with its opacity. This is how fade
+        /// animations are applied without recalculating the colors of the widget and all its children on every frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API BatchRenderer
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Multiplies the opacity of everything that is drawn until the object is destroyed.
+            // Scopes can be nested, in which case their opacities are multiplied with each other. A scope that isn't nested
+            // replaces the opacity of the surrounding scopes instead (e.g. while drawing to a texture that is faded as a whole).
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            class TGUI_API OpacityScope
+            {
+            public:
+                explicit OpacityScope(float opacity, bool nested = true);
+                ~OpacityScope();
+
+                OpacityScope(const OpacityScope& copy) = delete;
+                OpacityScope& operator=(const OpacityScope& right) = delete;
+
+            private:
+                float m_previousOpacity;
+            };
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the opacity with which everything is currently drawn, which is 1 when no OpacityScope exists
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static float getDrawOpacity();
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Starts collecting everything that is drawn on the target via the static draw functions.
+            // The draw call counter is reset, also when batching is disabled.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void begin(sf::RenderTarget& target);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Draws the pending batches and stops collecting the draws on the target
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void end();
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Changes whether the geometry is batched. When disabled, everything is passed directly to the render target.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void setEnabled(bool enabled);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns whether the geometry is batched
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            bool isEnabled() const;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the amount of times the render target was asked to draw something since the last call to begin
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getDrawCallCount() const;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Draws primitives on the target, or adds them to the active batch renderer of the target.
+            // Only triangles, triangle strips, triangle fans and quads can be batched.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static void draw(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t vertexCount,
+                             sf::PrimitiveType type, const sf::RenderStates& states);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Draws primitives of which the colors are multiplied with the given color, which allows sharing the same vertices
+            // between objects that only differ in color (e.g. the glyphs of texts with the same string and font).
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static void draw(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t vertexCount,
+                             sf::PrimitiveType type, const sf::RenderStates& states, sf::Color color);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Draws a drawable on the target. When a batch renderer is active for the target, the pending batches are flushed first.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static void draw(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Draws a shape, sprite or text on the target. When the draw opacity is less than 1, the alpha of its colors is
+            // temporarily lowered while it is drawn.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static void draw(sf::RenderTarget& target, const sf::Shape& shape, const sf::RenderStates& states);
+            static void draw(sf::RenderTarget& target, const sf::Sprite& sprite, const sf::RenderStates& states);
+            static void draw(sf::RenderTarget& target, const sf::Text& text, const sf::RenderStates& states);
+
+
+        private:
+
+            struct Batch
+            {
+                const sf::Texture* texture = nullptr;
+                const sf::Shader* shader = nullptr;
+                sf::BlendMode blendMode;
+                sf::View view;
+                float left = 0;
+                float top = 0;
+                float right = 0;
+                float bottom = 0;
+                std::vector<sf::Vertex> vertices;
+            };
+
+            // Returns the batch renderer that is currently collecting the draws on the target, or nullptr if there is none
+            static BatchRenderer* getActive(const sf::RenderTarget& target);
+
+            void addVertices(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states, sf::Color color);
+
+            void flush();
+
+
+        private:
+
+            bool m_enabled = true;
+            sf::RenderTarget* m_target = nullptr;
+            std::size_t m_drawCallCount = 0;
+
+            // Batches are reused between frames to avoid reallocating their vertices, only the first m_batchCount ones are in use
+            std::vector<Batch> m_batches;
+            std::size_t m_batchCount = 0;
+
+            // Vertices that are being added, after they were transformed
+            std::vector<sf::Vertex> m_transformedVertices;
+
+            // The batch renderer that was active before begin was called, in case the gui is drawn while drawing another gui
+            BatchRenderer* m_previousActive = nullptr;
+
+            static BatchRenderer* m_active;
+
+            static float m_drawOpacity;
+
+            // Copy of the vertices of which the color or alpha was changed, used when they are drawn without batching
+            static std::vector<sf::Vertex> m_fadedVertices;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BATCH_RENDERER_HPP
@@ -68,6 +68,13 @@ namespace tgui
         static void setGuiView(const sf::View& view);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Returns the view that was passed to setGuiView, so that it can be restored after drawing to another target
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const sf::View& getGuiView();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
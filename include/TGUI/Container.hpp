@@ -30,6 +30,11 @@
 #include <list>
 
 #include <TGUI/Widget.hpp>
+#include <TGUI/SpatialIndex.hpp>
+#include <TGUI/NameIndex.hpp>
+#include <TGUI/UpdateScheduler.hpp>
+#include <TGUI/BatchRenderer.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -132,6 +137,12 @@ namespace tgui
         /// The container will first search for widgets that are direct children of it, but when none of the child widgets match
         /// the given name, a recursive search will be performed.
         ///
+        /// When no widget has the given name, the name is treated as a path in which the names of containers are separated by
+        /// dots. So get("form.user") returns the widget called "user" that is found inside the container called "form".
+        ///
+        /// When the container is part of a gui, the names are looked up in a hash map that the gui keeps for all its widgets,
+        /// so the time needed to find a widget doesn't grow with the amount of widgets in the gui.
+        ///
         /// @return Pointer to the earlier created widget
         ///
         /// @warning This function will return nullptr when an unknown widget name was passed
@@ -262,6 +273,26 @@ namespace tgui
         void saveWidgetsToStream(std::stringstream& stream) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the child widgets from a binary file that was created with saveWidgetsToBinary
+        ///
+        /// @param filename  Filename of the binary widget file
+        ///
+        /// Loading a binary file is faster than loading a text file as there is no text to parse. Binary files can only be
+        /// loaded by the same version of TGUI that created them, so they should be created from the text files when needed
+        /// instead of replacing them. The binary cache (see setBinaryCachePath) does this automatically.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadWidgetsFromBinary(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves the child widgets to a binary file
+        ///
+        /// @param filename  Filename of the binary widget file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveWidgetsToBinary(const std::string& filename) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Places a widget before all other widgets
         ///
@@ -280,6 +311,64 @@ namespace tgui
         void moveWidgetToBack(const Widget::Ptr& widget);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether a spatial index is used to find the widget below the mouse
+        ///
+        /// @param enabled  Should the child widgets be stored in a grid based on their bounds?
+        ///
+        /// By default the container checks every child widget, from front to back, to find out on which widget the mouse is
+        /// located. When the container has a lot of child widgets then enabling the spatial index will reduce the amount of
+        /// widgets that have to be checked for every mouse event. The order in which the widgets are checked remains the same.
+        ///
+        /// When the spatial index is enabled, a child widget can only be found when the mouse is located inside its full size
+        /// (as returned by getFullSize, starting at the position plus the widget offset).
+        ///
+        /// The spatial index is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSpatialIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a spatial index is used to find the widget below the mouse
+        ///
+        /// @return Is the spatial index enabled?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isSpatialIndexEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the child widgets are drawn to a texture that is reused until one of them changes
+        ///
+        /// @param enabled  Should the child widgets be kept in a texture between frames?
+        ///
+        /// When enabled, the child widgets are drawn to an internal texture which is then drawn as a single quad. The widgets
+        /// are only drawn to the texture again after one of them was invalidated (see Widget::invalidate), which happens
+        /// automatically whenever they change (e.g. when they are moved, hovered, added or removed, get a new value, item or
+        /// text or when their renderer changes). Moving the container itself (e.g. dragging a child window) doesn't require the
+        /// texture to be updated.
+        ///
+        /// This is interesting for containers with many widgets that rarely change, but it costs the memory of the texture.
+        /// The texture has the size of the container in the coordinates of the gui view, so the contents will look blurry
+        /// when the view is scaled.
+        ///
+        /// The render cache is disabled by default.
+        ///
+        /// @warning Custom widgets have to call Widget::invalidate themselves when they change how they look.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRenderCacheEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the child widgets are drawn to a texture that is reused until one of them changes
+        ///
+        /// @return Is the render cache enabled?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isRenderCacheEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Focuses the next widget in this container
         /// @return Whether a new widget was focused
@@ -305,6 +394,16 @@ namespace tgui
         void setFocused(bool focused) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Shows or hides a widget
+        /// @param visible  Is the widget visible?
+        ///
+        /// The widget won't receive events (and thus won't send callbacks) nor will it be drawn when hidden.
+        /// The widget is visible by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVisible(bool visible) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// Called when one of the child widgets of this container gains focus.
@@ -312,6 +411,28 @@ namespace tgui
         void childWidgetFocused(const Widget::Ptr& child);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when the position or size of one of the child widgets may have changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childWidgetBoundsChanged(const Widget* child);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when one of the widgets inside this container changed, the render cache has to be updated before it is drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateRenderCache();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// This function is called when the widget is added to a container.
+        /// You should not call this function yourself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setParent(Container* parent) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -388,9 +509,15 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // This function is called every frame with the time passed since the last frame.
+        // Replaces the child widgets by the ones from a parsed widget file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadWidgetsFromNodeTree(const std::unique_ptr<DataIO::Node>& rootNode);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stores the child widgets in a tree of nodes which can be written to a widget file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void update(sf::Time elapsedTime) override;
+        std::unique_ptr<DataIO::Node> saveWidgetsToNodeTree() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -412,6 +539,19 @@ namespace tgui
         virtual void drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states = sf::RenderStates::Default) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the child widgets to the render cache when they changed and then draws the cached texture on the target.
+        // Returns false when the texture couldn't be created, in which case the widgets have to be drawn directly.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool drawRenderCache(sf::RenderTarget& target, const sf::RenderStates& states) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the size of the area, starting at the position of the child widgets, that is stored in the render cache
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual Vector2f getRenderCacheSize() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Find out what the index of the focused widget is. Returns 0 when no widget is focused and index+1 otherwise.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -424,6 +564,25 @@ namespace tgui
         bool tryFocusWidget(const tgui::Widget::Ptr &widget, bool reverseWidgetOrder);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the name index of the gui that this container is part of, or nullptr when it isn't part of a gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        priv::NameIndex* getGuiNameIndex() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds or removes a widget and all the widgets inside it to or from the name index of the gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addToNameIndex(priv::NameIndex& nameIndex, const Widget::Ptr& widget, const sf::String& widgetName);
+        static void removeFromNameIndex(priv::NameIndex& nameIndex, const Widget::Ptr& widget, const sf::String& widgetName);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Searches a widget with the exact name, without treating the name as a path
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr findWidgetByName(const sf::String& widgetName) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -439,6 +598,19 @@ namespace tgui
         // Does focusing the next widget always keep a widget from this container focused (e.g. in a ChildWindow)?
         bool m_isolatedFocus = false;
 
+        // Grid of child widget bounds, only created when the spatial index is enabled
+        std::unique_ptr<priv::SpatialIndex> m_spatialIndex;
+        std::vector<std::pair<std::size_t, const Widget*>> m_spatialIndexCandidates;
+
+        // Texture that keeps the drawn child widgets between frames, only created when the render cache is enabled
+        struct RenderCache
+        {
+            sf::RenderTexture texture;
+            priv::BatchRenderer batchRenderer;
+            bool valid = false;
+        };
+        mutable std::unique_ptr<RenderCache> m_renderCache;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -494,6 +666,45 @@ namespace tgui
         bool mouseOnWidget(Vector2f pos) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Makes sure that the update function of the widget will be called during the next frame
+        ///
+        /// @param widget  Widget inside this gui that needs to know the elapsed time
+        /// @param delay   Time after which the widget has something to change, which may be later than the next frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scheduleWidgetUpdate(Widget& widget, sf::Time delay);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Marks part of the screen as having to be redrawn
+        ///
+        /// @param region  Area that changed, in the coordinates of the gui view
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateRegion(const FloatRect& region);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Draws the child widgets that overlap with a region of the screen
+        ///
+        /// @param target  Render target to draw to
+        /// @param region  Area in the coordinates of the gui view outside which nothing has to be drawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawRegion(sf::RenderTarget& target, const FloatRect& region) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the names of all widgets inside the gui, which is used to quickly find a widget by its name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        priv::NameIndex& getNameIndex()
+        {
+            return m_nameIndex;
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -518,6 +729,16 @@ namespace tgui
 
         friend class Gui; // Required to let Gui access protected members from container and Widget
 
+        // Widgets that are animating or waiting for a timer
+        priv::UpdateScheduler m_updateScheduler;
+
+        // Part of the screen that changed since the gui was last drawn
+        FloatRect m_dirtyRegion;
+        bool m_dirty = false;
+
+        // Names of all widgets inside the gui, including the ones inside child containers
+        priv::NameIndex m_nameIndex;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
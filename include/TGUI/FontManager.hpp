@@ -0,0 +1,106 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_FONT_MANAGER_HPP
+#define TGUI_FONT_MANAGER_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/Config.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <unordered_map>
+#include <memory>
+#include <string>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Shares fonts that are loaded from the same file
+    ///
+    /// The font manager only keeps weak references to the fonts, a font is destroyed as soon as no widget uses it anymore.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API FontManager
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Information about the fonts that were loaded by the font manager
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Statistics
+        {
+            std::size_t fontCount = 0;  //!< Amount of fonts that are currently loaded and still in use
+            std::size_t loadCount = 0;  //!< Amount of times that a font file was actually loaded
+            std::size_t reuseCount = 0; //!< Amount of times that an already loaded font was returned instead of loading the file
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a font
+        ///
+        /// @param filename  Filename of the font to load, the resource path should already be part of the filename
+        ///
+        /// When a font with the same filename is still in use, that font is returned instead of loading the file again.
+        ///
+        /// @return The loaded font. The font is still returned when loading failed, but it won't be shared in that case.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<sf::Font> getFont(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Forgets the loaded fonts so that the files are loaded again the next time they are requested
+        ///
+        /// @param filename  Font to remove from the cache.
+        ///                  If no filename is given, the entire cache is cleared.
+        ///
+        /// Fonts that are still used by widgets remain valid, they are just no longer shared with fonts loaded afterwards.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void flushCache(const std::string& filename = "");
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns information about the fonts that were loaded
+        ///
+        /// @return Statistics about the fonts loaded by the font manager
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static Statistics getStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        static std::unordered_map<std::string, std::weak_ptr<sf::Font>> m_fonts;
+        static std::size_t m_loadCount;
+        static std::size_t m_reuseCount;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_FONT_MANAGER_HPP
@@ -121,6 +121,28 @@ namespace tgui
     TGUI_API const std::string& getResourcePath();
 
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Sets the folder in which binary versions of parsed widget and theme files are stored
+    ///
+    /// When a path is set, loading a widget file or theme file stores the parsed result in this folder, using a hash of the
+    /// file contents as filename. Loading a file with the same contents later (e.g. on the next start of the program) then
+    /// skips parsing the text. The folder has to exist already.
+    ///
+    /// @param path  Folder to store the cached files in, or an empty string to disable caching (default)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API void setBinaryCachePath(const std::string& path);
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Returns the folder in which binary versions of parsed widget and theme files are stored
+    ///
+    /// @return The current binary cache path, which is empty when caching is disabled
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API const std::string& getBinaryCachePath();
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @internal
     // Checks if two floats are equal, with regard to a small epsilon margin.
@@ -0,0 +1,146 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_GLYPH_CACHE_HPP
+#define TGUI_GLYPH_CACHE_HPP
+
+#include <TGUI/Config.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <unordered_map>
+#include <cstdint>
+#include <memory>
+#include <array>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Cache of the glyph advances and kernings of a font at a specific character size and style
+        ///
+        /// Retrieving a glyph or kerning from an sf::Font requires a map lookup and a FreeType call every time, which becomes
+        /// expensive when long strings are measured or word-wrapped repeatedly. The advances of the Latin-1 characters are
+        /// stored in an array, the advances of the other characters and all kernings are stored in hash maps.
+        ///
+        /// The caches are kept per sf::Font. When the font is destroyed and another font is created at the same address, or
+        /// when the font is reloaded, the old values are discarded (the latter requires a call to invalidate).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API GlyphCache
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the cache for the given font, character size and style. The font must not be a nullptr.
+            // The returned reference remains valid until the cache of the font is invalidated.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static GlyphCache& get(const std::shared_ptr<sf::Font>& font, unsigned int characterSize, bool bold);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Removes all cached values of a font, which is needed when a font object is loaded again
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static void invalidate(const sf::Font* font);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Removes the caches of all fonts
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static void clear();
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the amount of fonts for which values are being cached
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static std::size_t getFontCount();
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the horizontal offset to move to the next character. A tab counts as 4 spaces.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            float getAdvance(std::uint32_t codePoint)
+            {
+                if (codePoint < m_latinAdvances.size())
+                {
+                    float& advance = m_latinAdvances[codePoint];
+                    if (advance < 0)
+                        advance = loadAdvance(codePoint);
+
+                    return advance;
+                }
+                else
+                    return getNonLatinAdvance(codePoint);
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the kerning offset between two characters
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            float getKerning(std::uint32_t first, std::uint32_t second);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the line spacing of the font
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            float getLineSpacing() const
+            {
+                return m_lineSpacing;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the extra space below the baseline that is not part of the line spacing (see Text::calculateExtraVerticalSpace)
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            float getExtraVerticalSpace() const
+            {
+                return m_extraVerticalSpace;
+            }
+
+
+        private:
+
+            GlyphCache(const sf::Font& font, unsigned int characterSize, bool bold);
+
+            float loadAdvance(std::uint32_t codePoint) const;
+            float getNonLatinAdvance(std::uint32_t codePoint);
+
+
+        private:
+
+            const sf::Font& m_font;
+            unsigned int m_characterSize;
+            bool m_bold;
+
+            float m_lineSpacing;
+            float m_extraVerticalSpace;
+
+            std::array<float, 256> m_latinAdvances; // Negative values indicate that the advance wasn't loaded yet
+            std::unordered_map<std::uint32_t, float> m_advances;
+            std::unordered_map<std::uint64_t, float> m_kernings;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_GLYPH_CACHE_HPP
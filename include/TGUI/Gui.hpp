@@ -28,7 +28,9 @@
 
 
 #include <TGUI/Container.hpp>
+#include <TGUI/BatchRenderer.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 #include <queue>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -170,6 +172,84 @@ namespace tgui
         void draw();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the geometry of the widgets is combined into as few draw calls as possible
+        ///
+        /// @param enabled  Should the draw calls be batched?
+        ///
+        /// Batching is enabled by default. The result on the screen is identical in both cases, disabling it is only useful to
+        /// compare the performance or when you need the widgets to be drawn one by one (e.g. while debugging).
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDrawBatchingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the geometry of the widgets is combined into as few draw calls as possible
+        ///
+        /// @return Are the draw calls batched?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDrawBatchingEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of draw calls that were made on the render target during the last call to the draw function
+        ///
+        /// @return Amount of draw calls in the last frame
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getDrawCallCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether only the parts of the screen that changed are redrawn
+        ///
+        /// @param enabled  Should the widgets be drawn to a texture in which only the changed region gets updated?
+        ///
+        /// When enabled, the widgets are drawn to an internal texture that has the size of the render target. Each call to
+        /// the draw function only redraws the widgets that overlap with the dirty region and then draws the texture on the
+        /// target. This is interesting for guis that barely change, but it costs memory and an extra texture draw per frame.
+        ///
+        /// Partial redrawing is disabled by default.
+        ///
+        /// @warning Custom widgets have to call Widget::invalidate themselves when they change how they look.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPartialRedrawEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether only the parts of the screen that changed are redrawn
+        ///
+        /// @return Are the widgets drawn to a texture in which only the changed region gets updated?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isPartialRedrawEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether something changed since the last time the gui was drawn
+        ///
+        /// @return Has any widget changed since the last call to the draw function?
+        ///
+        /// Applications that only redraw the window when something changes can use this function (together with
+        /// getNextWakeupTime) to skip frames in which the gui looks identical to the previous one.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDirty() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the area of the screen that changed since the last time the gui was drawn
+        ///
+        /// @return Bounding rectangle, in the coordinates of the gui view, around all changes that have to be redrawn.
+        ///         An empty rectangle is returned when nothing changed.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FloatRect getDirtyRegion() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the internal container of the Gui
         ///
@@ -396,6 +476,24 @@ namespace tgui
         void saveWidgetsToStream(std::stringstream& stream) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the child widgets from a binary file that was created with saveWidgetsToBinary
+        ///
+        /// @param filename  Filename of the binary widget file
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadWidgetsFromBinary(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves the child widgets to a binary file
+        ///
+        /// @param filename  Filename of the binary widget file
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveWidgetsToBinary(const std::string& filename) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         // Updates the internal clock to make animation possible. This function is called automatically by the draw function.
@@ -404,6 +502,18 @@ namespace tgui
         void updateTime(const sf::Time& elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how long the gui can wait before it has to be updated and drawn again
+        ///
+        /// @return Time until the next animation frame or timer (e.g. a blinking caret or a tool tip that has to appear).
+        ///         When nothing is animating, the maximum value of sf::Time is returned.
+        ///
+        /// Applications that only redraw the window when something changes can use this function to find out how long they can
+        /// wait for the next event. Animations return a time of 0 as they have to be updated every frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getNextWakeupTime() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       private:
 
@@ -413,6 +523,13 @@ namespace tgui
         void init();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the changed part of the internal texture and draws the texture on the render target.
+        // Returns false when the texture couldn't be created, in which case all widgets have to be drawn directly.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool drawDirtyRegion();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -438,6 +555,13 @@ namespace tgui
 
         sf::View m_view;
 
+        // Combines the draw calls of the widgets
+        priv::BatchRenderer m_batchRenderer;
+
+        // Texture that keeps the drawn widgets between frames when only the changed region is redrawn
+        std::unique_ptr<sf::RenderTexture> m_redrawTexture;
+        bool m_partialRedrawEnabled = false;
+
         bool m_TabKeyUsageEnabled = true;
 
 
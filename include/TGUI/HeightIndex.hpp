@@ -0,0 +1,135 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+#ifndef TGUI_HEIGHT_INDEX_HPP
+#define TGUI_HEIGHT_INDEX_HPP
+
+#include <TGUI/Config.hpp>
+#include <cstddef>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Heights of a list of items that are placed below each other, with fast lookup of their vertical offsets
+        ///
+        /// The heights are stored in a Fenwick tree on top of a ring buffer. Adding or removing items at the front or back,
+        /// changing the height of an item, calculating the offset of an item and finding the item at a given offset are all
+        /// O(log n). Removing an item from the middle of the list requires rebuilding the tree.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API HeightIndex
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the amount of items
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getSize() const;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Removes all items
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void clear();
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Adds an item below or above the existing items
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void pushBack(float height);
+            void pushFront(float height);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Removes the bottom or top item. The index must not be empty.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void popBack();
+            void popFront();
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Removes an item at any position
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void erase(std::size_t index);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Changes or returns the height of an item
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void setHeight(std::size_t index, float height);
+            float getHeight(std::size_t index) const;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the sum of the heights of all items above the given index. The index may be equal to the amount of items.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            float getOffset(std::size_t index) const;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the sum of the heights of all items
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            float getTotalHeight() const;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the index of the item that contains the given offset.
+            // Returns 0 when the offset is negative and the amount of items when the offset lies below the last item.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t findIndex(float offset) const;
+
+
+        private:
+
+            // Returns the position in the ring buffer of the item at the given index
+            std::size_t getSlot(std::size_t index) const
+            {
+                return (m_head + index) & (m_heights.size() - 1);
+            }
+
+            // Returns the sum of the heights in the slots before the given slot
+            double getSlotSum(std::size_t slotEnd) const;
+
+            // Finds the amount of slots of which the summed heights is not larger than the given sum
+            std::size_t findSlot(double sum) const;
+
+            void addToSlot(std::size_t slot, double height);
+            void rebuild(std::size_t capacity);
+
+
+        private:
+
+            std::vector<float> m_heights; // Ring buffer of which the size is always a power of two
+            std::vector<double> m_tree;   // Fenwick tree over the slots of the ring buffer (1-based)
+            std::size_t m_head = 0;
+            std::size_t m_size = 0;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_HEIGHT_INDEX_HPP
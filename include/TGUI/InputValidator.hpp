@@ -0,0 +1,146 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+#ifndef TGUI_INPUT_VALIDATOR_HPP
+#define TGUI_INPUT_VALIDATOR_HPP
+
+#include <TGUI/Config.hpp>
+#include <SFML/System/String.hpp>
+#include <array>
+#include <cstdint>
+#include <regex>
+#include <string>
+#include <utility>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Checks whether text matches a regular expression, without using std::regex for the common patterns
+        ///
+        /// Patterns of the form "[...]*" only check the characters that are inserted. Other patterns that only use literals,
+        /// character classes, groups, alternations and quantifiers are compiled once into a DFA. The DFA states of the
+        /// text before the caret are remembered, so typing a character only has to run the DFA on the text behind it.
+        /// Anything else (e.g. anchors or back-references) is passed to std::regex.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API InputValidator
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Changes the regular expression that the text has to match. Throws std::regex_error when the pattern is invalid.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void setPattern(const std::string& pattern);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the regular expression that was passed to setPattern
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            const std::string& getPattern() const
+            {
+                return m_pattern;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns whether the pattern is matched with std::regex, in which case only ANSI text can be checked
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            bool isUsingRegex() const
+            {
+                return m_kind == Kind::Regex;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns whether the entire text matches the pattern
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            bool isValid(const sf::String& text) const;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns whether the text would match the pattern after replacing the erased characters at the given position
+            // with the inserted ones. The text must have been valid and textChanged must have been called for all changes
+            // to the text since the validator last saw it.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            bool isValidEdit(const sf::String& text, std::size_t pos, std::size_t erased, const std::uint32_t* inserted, std::size_t insertedCount);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Informs the validator that the text was changed at or after the given position
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void textChanged(std::size_t pos)
+            {
+                if (m_prefixStates.size() > pos + 1)
+                    m_prefixStates.resize(pos + 1);
+            }
+
+
+        private:
+
+            // Returns the DFA state after reading the given character in the given state
+            std::uint16_t getNextState(std::uint16_t state, std::uint32_t character) const;
+
+            // Returns whether a character lies inside the character set
+            bool isInCharacterSet(std::uint32_t character) const;
+
+
+        private:
+
+            enum class Kind
+            {
+                All,          // ".*", every text is accepted
+                CharacterSet, // "[...]*", every character is checked on its own
+                Dfa,          // Compiled pattern
+                Regex         // Pattern that is not supported by the compiler
+            };
+
+            std::string m_pattern = ".*";
+            Kind m_kind = Kind::All;
+
+            // Sorted and non-overlapping ranges of accepted characters when the kind is CharacterSet
+            std::vector<std::pair<std::uint32_t, std::uint32_t>> m_characterSet;
+
+            // The DFA groups characters in classes. State 0 is the dead state and state 1 is the start state.
+            std::vector<std::uint32_t> m_classBoundaries;
+            std::array<std::uint16_t, 128> m_asciiClasses;
+            std::vector<std::uint16_t> m_transitions; // Index is state * classCount + class
+            std::vector<bool> m_acceptingStates;
+            std::size_t m_classCount = 0;
+
+            // DFA states after each prefix of the text, the first element is the state before the first character
+            std::vector<std::uint16_t> m_prefixStates;
+
+            std::regex m_regex;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_INPUT_VALIDATOR_HPP
@@ -116,7 +116,7 @@ namespace tgui
         /// @internal
         /// @brief Constructs the layout with a mathematical operation between two other layouts
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        explicit Layout(Operation operation, std::unique_ptr<Layout> leftOperand, std::unique_ptr<Layout> rightOperand);
+        explicit Layout(Operation operation, std::shared_ptr<Layout> leftOperand, std::shared_ptr<Layout> rightOperand);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -194,6 +194,19 @@ namespace tgui
     private:
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the other operand into the operand. Constant operands are shared, otherwise the memory of the existing operand
+        // is reused when it isn't shared with another layout.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void copyOperand(std::shared_ptr<Layout>& operand, const std::shared_ptr<Layout>& otherOperand);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the layout only consists of constants. Such a layout never changes, so it can be shared between copies.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isConstant() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // If a widget is bound, inform it that the layout no longer binds it
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -225,11 +238,14 @@ namespace tgui
         float m_value = 0;
         Layout* m_parent = nullptr;
         Operation m_operation = Operation::Value;
-        std::unique_ptr<Layout> m_leftOperand = nullptr; // The left operand of the operation in case the operation is a math operation
-        std::unique_ptr<Layout> m_rightOperand = nullptr; // The left operand of the operation in case the operation is a math operation
+        std::shared_ptr<Layout> m_leftOperand = nullptr; // The left operand of the operation in case the operation is a math operation
+        std::shared_ptr<Layout> m_rightOperand = nullptr; // The left operand of the operation in case the operation is a math operation
         Widget* m_boundWidget = nullptr; // The widget on which this layout depends in case the operation is a binding
         std::string m_boundString; // String referring  to a widget on which this layout depends in case the layout was created from a string and contains a binding operation
         std::function<void()> m_connectedWidgetCallback = nullptr; // Function to call when the value of the layout changes in case the layout and sublayouts are not all constants
+        Widget* m_connectedWidget = nullptr; // The widget whose position or size is determined by this layout, in case it is the topmost layout
+
+        friend class LayoutScheduler; // LayoutScheduler needs to find the widgets that depend on other widgets
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -0,0 +1,152 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_LAYOUT_SCHEDULER_HPP
+#define TGUI_LAYOUT_SCHEDULER_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/Config.hpp>
+#include <unordered_map>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Layout;
+    class Widget;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Decides when the layouts that depend on the position or size of other widgets are recalculated
+    ///
+    /// When a widget is moved or resized, the layouts that depend on it are not evaluated one by one. Instead the widgets are
+    /// updated in the order of their dependencies, so that each widget only has to recalculate its position and size once and
+    /// emits its onPositionChange and onSizeChange signals only once, when all its layouts have their final value.
+    ///
+    /// By default the layouts are updated before the function that moved or resized the widget returns. When updates are
+    /// deferred, they are postponed until update() is called, which the gui does once per frame and before handling events.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API LayoutScheduler
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether layout updates are postponed until update() is called
+        ///
+        /// @param deferred  Should the layouts only be recalculated when update() is called?
+        ///
+        /// When updates are deferred, the widgets that depend on a widget that was moved or resized will keep returning their
+        /// old position and size until the layouts are updated. Deferring updates is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setDeferred(bool deferred);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether layout updates are postponed until update() is called
+        ///
+        /// @return Are layout updates deferred?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isDeferred();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Recalculates all layouts that depend on widgets that were moved or resized
+        ///
+        /// Widgets are updated in the order of their dependencies. When the layouts depend on each other in a circular way,
+        /// a warning is printed and the circular dependency is ignored.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void update();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether there are layouts waiting to be recalculated
+        ///
+        /// @return Does update() still have work to do?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool hasPendingUpdates();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Informs the scheduler that the position of a widget has changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void widgetMoved(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Informs the scheduler that the size of a widget has changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void widgetResized(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Informs the scheduler that the value of the position or size layout of a widget has changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void layoutChanged(Widget* widget, const Layout* layout);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Forgets the pending changes of a widget that is being destroyed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void widgetDestroyed(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        struct PendingChanges
+        {
+            bool moved = false;                 // The layouts bound to the position of the widget have to be recalculated
+            bool resized = false;               // The layouts bound to the size of the widget have to be recalculated
+            bool positionLayoutChanged = false; // The position of the widget has to be set again
+            bool sizeLayoutChanged = false;     // The size of the widget has to be set again
+        };
+
+        // Adds the widgets that have pending changes, and the widgets depending on them, to the list in the order in which they
+        // have to be updated. Returns false when a circular dependency was found.
+        static bool findUpdateOrder(std::vector<Widget*>& order);
+
+        // Adds the widgets that have a layout which depends on the position or size of the given widget to the list
+        static void getDependentWidgets(Widget* widget, std::vector<Widget*>& dependents);
+
+        // Updates the widget and recalculates the layouts that depend on it
+        static void updateWidget(Widget* widget);
+
+        static std::unordered_map<Widget*, PendingChanges> m_pendingChanges;
+        static bool m_deferred;
+        static bool m_updating;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_LAYOUT_SCHEDULER_HPP
@@ -86,6 +86,21 @@ namespace tgui
         static std::unique_ptr<Node> parse(std::stringstream& stream);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses a widget file that is stored in memory
+        ///
+        /// @param data  Pointer to the contents of the widget file
+        /// @param size  Amount of bytes in the contents
+        ///
+        /// @return Root node of the tree of nodes
+        ///
+        /// The contents are read in place, only the names and values that end up in the nodes are copied. The data is no
+        /// longer accessed after this function returns.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::unique_ptr<Node> parse(const char* data, std::size_t size);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Emits the widget file
         ///
@@ -94,6 +109,43 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static void emit(const std::unique_ptr<Node>& rootNode, std::stringstream& stream);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stores the tree of nodes in a compact binary form that can be loaded again without parsing text
+        ///
+        /// @param rootNode Root node of the tree of nodes that is to be converted
+        /// @param output   String to which the binary data will be appended
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void emitBinary(const std::unique_ptr<Node>& rootNode, std::string& output);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a tree of nodes that was stored with emitBinary
+        ///
+        /// @param data  Pointer to the binary data
+        /// @param size  Amount of bytes in the binary data
+        ///
+        /// @return Root node of the tree of nodes
+        ///
+        /// @throw Exception when the data was not created by emitBinary or when it is incomplete
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::unique_ptr<Node> parseBinary(const char* data, std::size_t size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses a widget file, or loads the result of parsing the same contents before from the binary cache
+        ///
+        /// @param contents  Contents of the widget file
+        ///
+        /// @return Root node of the tree of nodes
+        ///
+        /// When no binary cache path is set (see setBinaryCachePath), this function is identical to calling parse.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::unique_ptr<Node> parseWithCache(const std::string& contents);
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,99 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_NAME_INDEX_HPP
+#define TGUI_NAME_INDEX_HPP
+
+#include <TGUI/Config.hpp>
+#include <SFML/System/String.hpp>
+#include <unordered_map>
+#include <memory>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Widget;
+
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Hash map from widget names to all widgets inside a gui that were given that name
+        ///
+        /// Every name is stored only once, no matter how many widgets share it. The index only tells which widgets have the
+        /// name, the container that searches for a widget still decides which of them it would have found first.
+        /// The widgets are stored as weak pointers, so an entry that wasn't removed in time can never keep a widget alive.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API NameIndex
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Registers a widget under the given name. Empty names are ignored.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void insert(const sf::String& name, const std::shared_ptr<Widget>& widget);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Removes a widget that was registered under the given name. Widgets that no longer exist are removed as well.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void remove(const sf::String& name, const Widget* widget);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the widgets that were registered with the name, or nullptr when there are none.
+            // The list can contain widgets that no longer exist.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            const std::vector<std::weak_ptr<Widget>>* find(const sf::String& name) const;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Removes all names from the index
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void clear();
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the amount of different names in the index
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getNameCount() const;
+
+
+        private:
+
+            struct NameHash
+            {
+                std::size_t operator()(const sf::String& name) const;
+            };
+
+            std::unordered_map<sf::String, std::vector<std::weak_ptr<Widget>>, NameHash> m_widgets;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_NAME_INDEX_HPP
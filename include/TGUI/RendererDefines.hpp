@@ -34,7 +34,8 @@
 #define TGUI_RENDERER_PROPERTY_OUTLINE(CLASS, NAME) \
     Outline CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
+        constexpr priv::PropertyId id = priv::makePropertyId(#NAME); \
+        const auto it = m_data->propertyValuePairs.find(id, #NAME); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getOutline(); \
         else \
@@ -42,7 +43,8 @@
     } \
     void CLASS::set##NAME(const Outline& outline) \
     { \
-        setProperty(toLower(#NAME), {outline}); \
+        constexpr priv::PropertyId id = priv::makePropertyId(#NAME); \
+        setProperty(id, #NAME, {outline}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -50,7 +52,8 @@
 #define TGUI_RENDERER_PROPERTY_COLOR(CLASS, NAME, DEFAULT) \
     Color CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
+        constexpr priv::PropertyId id = priv::makePropertyId(#NAME); \
+        const auto it = m_data->propertyValuePairs.find(id, #NAME); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getColor(); \
         else \
@@ -58,7 +61,8 @@
     } \
     void CLASS::set##NAME(Color color) \
     { \
-        setProperty(toLower(#NAME), {color}); \
+        constexpr priv::PropertyId id = priv::makePropertyId(#NAME); \
+        setProperty(id, #NAME, {color}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -66,7 +70,8 @@
 #define TGUI_RENDERER_PROPERTY_TEXT_STYLE(CLASS, NAME, DEFAULT) \
     TextStyle CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
+        constexpr priv::PropertyId id = priv::makePropertyId(#NAME); \
+        const auto it = m_data->propertyValuePairs.find(id, #NAME); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getTextStyle(); \
         else \
@@ -74,7 +79,8 @@
     } \
     void CLASS::set##NAME(TextStyle style) \
     { \
-        setProperty(toLower(#NAME), ObjectConverter{style}); \
+        constexpr priv::PropertyId id = priv::makePropertyId(#NAME); \
+        setProperty(id, #NAME, ObjectConverter{style}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -82,7 +88,8 @@
 #define TGUI_RENDERER_PROPERTY_GET_NUMBER(CLASS, NAME, DEFAULT) \
     float CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
+        constexpr priv::PropertyId id = priv::makePropertyId(#NAME); \
+        const auto it = m_data->propertyValuePairs.find(id, #NAME); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getNumber(); \
         else \
@@ -93,7 +100,8 @@
     TGUI_RENDERER_PROPERTY_GET_NUMBER(CLASS, NAME, DEFAULT) \
     void CLASS::set##NAME(float number) \
     { \
-        setProperty(toLower(#NAME), ObjectConverter{number}); \
+        constexpr priv::PropertyId id = priv::makePropertyId(#NAME); \
+        setProperty(id, #NAME, ObjectConverter{number}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -101,7 +109,8 @@
 #define TGUI_RENDERER_PROPERTY_GET_BOOL(CLASS, NAME, DEFAULT) \
     bool CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
+        constexpr priv::PropertyId id = priv::makePropertyId(#NAME); \
+        const auto it = m_data->propertyValuePairs.find(id, #NAME); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getBool(); \
         else \
@@ -112,7 +121,8 @@
     TGUI_RENDERER_PROPERTY_GET_BOOL(CLASS, NAME, DEFAULT) \
     void CLASS::set##NAME(bool flag) \
     { \
-        setProperty(toLower(#NAME), ObjectConverter{flag}); \
+        constexpr priv::PropertyId id = priv::makePropertyId(#NAME); \
+        setProperty(id, #NAME, ObjectConverter{flag}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -120,18 +130,21 @@
 #define TGUI_RENDERER_PROPERTY_TEXTURE(CLASS, NAME) \
     Texture& CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
+        constexpr priv::PropertyId id = priv::makePropertyId(#NAME); \
+        const auto it = m_data->propertyValuePairs.find(id, #NAME); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getTexture(); \
         else \
         { \
-            m_data->propertyValuePairs[toLower(#NAME)] = {Texture{}}; \
-            return m_data->propertyValuePairs[toLower(#NAME)].getTexture(); \
+            ObjectConverter& value = m_data->propertyValuePairs.insert(id, #NAME)->second; \
+            value = {Texture{}}; \
+            return value.getTexture(); \
         } \
     } \
     void CLASS::set##NAME(const Texture& texture) \
     { \
-        setProperty(toLower(#NAME), {texture}); \
+        constexpr priv::PropertyId id = priv::makePropertyId(#NAME); \
+        setProperty(id, #NAME, {texture}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -139,19 +152,21 @@
 #define TGUI_RENDERER_PROPERTY_RENDERER(CLASS, NAME, RENDERER) \
     std::shared_ptr<RendererData> CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
+        constexpr priv::PropertyId id = priv::makePropertyId(#NAME); \
+        const auto it = m_data->propertyValuePairs.find(id, #NAME); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getRenderer(); \
         else \
         { \
             auto renderer = Theme::getDefault()->getRendererNoThrow(RENDERER); \
-            m_data->propertyValuePairs[toLower(#NAME)] = {renderer ? renderer : RendererData::create()}; \
+            m_data->propertyValuePairs.insert(id, #NAME)->second = {renderer ? renderer : RendererData::create()}; \
             return renderer; \
         } \
     } \
     void CLASS::set##NAME(std::shared_ptr<RendererData> renderer) \
     { \
-        setProperty(toLower(#NAME), {renderer}); \
+        constexpr priv::PropertyId id = priv::makePropertyId(#NAME); \
+        setProperty(id, #NAME, {renderer}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
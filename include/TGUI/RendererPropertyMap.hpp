@@ -0,0 +1,211 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_RENDERER_PROPERTY_MAP_HPP
+#define TGUI_RENDERER_PROPERTY_MAP_HPP
+
+#include <TGUI/Config.hpp>
+#include <TGUI/ObjectConverter.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /// @internal
+        /// Interned identifier of a renderer property, which is a case-insensitive hash of the property name
+        using PropertyId = std::uint64_t;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Calculates the identifier of a property name
+        ///
+        /// This function can be evaluated at compile time, so the renderer getters don't have to convert their property names
+        /// to lowercase or compare any strings when looking up their value.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr PropertyId makePropertyId(const char* name, PropertyId hash = 14695981039346656037ULL)
+        {
+            return (*name == '\0') ? hash
+                 : makePropertyId(name + 1, (hash ^ static_cast<unsigned char>(((*name >= 'A') && (*name <= 'Z')) ? (*name - 'A' + 'a') : *name))
+                                            * 1099511628211ULL);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Calculates the identifier of a property name at runtime
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_API PropertyId makePropertyId(const std::string& name);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Property-value pairs of a renderer
+    ///
+    /// The property-value pairs are stored in the order in which they were added, next to a flat list of their interned
+    /// property identifiers that is sorted on the identifier. The renderer classes find their properties with a binary search
+    /// over integers instead of string comparisons. References to the values remain valid when properties are added.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RendererPropertyMap
+    {
+    public:
+
+        using Map = std::map<std::string, ObjectConverter>;
+        using value_type = std::pair<std::string, ObjectConverter>;
+        using iterator = std::deque<value_type>::iterator;
+        using const_iterator = std::deque<value_type>::const_iterator;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RendererPropertyMap() = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs the property map from a map of property-value pairs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RendererPropertyMap(const Map& map);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the value of a property, inserting an empty value when the property didn't exist yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter& operator[](const std::string& property);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds a property by its name
+        ///
+        /// @return Iterator to the property-value pair, or end() when the property doesn't exist
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        iterator find(const std::string& property);
+        const_iterator find(const std::string& property) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Finds a property by its identifier, which is obtained by calling priv::makePropertyId on the name
+        ///
+        /// @param id    Identifier of the property, which is used to search the property
+        /// @param name  Name of the property (case-insensitive), which is compared with the key of the found property so that
+        ///              two properties whose identifiers collide are never confused
+        ///
+        /// @return Iterator to the property-value pair, or end() when the property doesn't exist
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        iterator find(priv::PropertyId id, const char* name);
+        const_iterator find(priv::PropertyId id, const char* name) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Finds a property by its identifier and adds it with an empty value when it didn't exist yet
+        ///
+        /// @param id    Identifier of the property, which is obtained by calling priv::makePropertyId on the name
+        /// @param name  Name of the property (case-insensitive), the key is only created when the property is added
+        ///
+        /// @return Iterator to the property-value pair
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        iterator insert(priv::PropertyId id, const char* name);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes a property
+        ///
+        /// @return Amount of properties that were removed (0 or 1)
+        ///
+        /// The last property takes the place of the removed one, references to these two values become invalid.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t erase(const std::string& property);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all properties
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of properties
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t size() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether there are no properties
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool empty() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an iterator to the first property-value pair, the pairs are in the order in which they were added
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        iterator begin();
+        const_iterator begin() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an iterator past the last property-value pair
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        iterator end();
+        const_iterator end() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a copy of the property-value pairs, sorted on the property name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Map getMap() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Adds a property that doesn't exist yet
+        iterator add(priv::PropertyId id, std::string key);
+
+        // Returns the position of the property in the list of identifiers
+        std::vector<std::pair<priv::PropertyId, std::size_t>>::iterator findIdEntry(priv::PropertyId id, std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // A deque is used instead of a vector because renderer getters return references to the values
+        std::deque<value_type> m_properties;
+
+        // Identifier and position in m_properties of all properties, sorted on the identifier
+        std::vector<std::pair<priv::PropertyId, std::size_t>> m_ids;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_RENDERER_PROPERTY_MAP_HPP
@@ -29,6 +29,7 @@
 
 #include <TGUI/Config.hpp>
 #include <TGUI/ObjectConverter.hpp>
+#include <TGUI/RendererPropertyMap.hpp>
 #include <TGUI/Loading/DataIO.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -58,17 +59,14 @@ namespace tgui
             for (const auto& pair : rendererNode->propertyValuePairs)
                 rendererData->propertyValuePairs[pair.first] = ObjectConverter(pair.second->value); // Did not compile with VS2015 Update 2 when using braces
 
+            // Nested renderers are created directly from their nodes instead of being converted back to text
             for (const auto& nestedProperty : rendererNode->children)
-            {
-                std::stringstream ss;
-                DataIO::emit(nestedProperty, ss);
-                rendererData->propertyValuePairs[toLower(nestedProperty->name)] = {sf::String{"{\n" + ss.str() + "}"}};
-            }
+                rendererData->propertyValuePairs[toLower(nestedProperty->name)] = ObjectConverter(createFromDataIONode(nestedProperty.get()));
 
             return rendererData;
         };
 
-        std::map<std::string, ObjectConverter> propertyValuePairs;
+        RendererPropertyMap propertyValuePairs;
         std::map<const void*, std::function<void(const std::string& property)>> observers;
         bool shared = true;
     };
@@ -175,7 +173,7 @@ namespace tgui
         /// @return Property-value pairs of the renderer
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        const std::map<std::string, ObjectConverter>& getPropertyValuePairs() const;
+        std::map<std::string, ObjectConverter> getPropertyValuePairs() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -227,6 +225,16 @@ namespace tgui
         std::shared_ptr<RendererData> clone() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes a property of the renderer. The id is the result of priv::makePropertyId on the name of the property, which
+        // the setters of the renderer classes calculate at compile time.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setProperty(priv::PropertyId id, const char* property, ObjectConverter&& value);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
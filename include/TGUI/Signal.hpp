@@ -69,17 +69,47 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         ///
-        /// @param name             Name of the signal
+        /// @param name             Name of the signal as a string literal, of which only the pointer is stored
         /// @param extraParameters  Amount of extra parameters to reserve space for
+        ///
+        /// @warning A constant character array that isn't a string literal has to outlive the signal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Signal(std::string&& name, std::size_t extraParameters = 0) :
-            m_name{std::move(name)}
+        template <std::size_t N>
+        Signal(const char (&name)[N], std::size_t extraParameters = 0) :
+            m_name{name}
         {
             if (1 + extraParameters > internal_signal::parameters.size())
                 internal_signal::parameters.resize(1 + extraParameters);
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param name             Name of the signal in a character buffer, which is copied into the signal
+        /// @param extraParameters  Amount of extra parameters to reserve space for
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <std::size_t N>
+        Signal(char (&name)[N], std::size_t extraParameters = 0) :
+            Signal{std::string{name}, extraParameters}
+        {
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param name             Name of the signal, which is copied into the signal
+        /// @param extraParameters  Amount of extra parameters to reserve space for
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Signal(std::string&& name, std::size_t extraParameters = 0) :
+            Signal{"", extraParameters}
+        {
+            m_ownedName = make_unique<const std::string>(std::move(name));
+            m_name = m_ownedName->c_str();
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Copy constructor which will not copy the signal handlers
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -149,17 +179,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget)
         {
-            if (m_handlers.empty())
-                return false;
-
-            internal_signal::parameters[0] = static_cast<const void*>(&widget);
-
-            // Copy the handlers before calling them in case the widget (and this signal) gets destroyed during the handler
-            auto handlers = m_handlers;
-            for (auto& handler : handlers)
-                handler.second();
-
-            return true;
+            const void* parameters[] = {&widget};
+            return callHandlers(parameters, 1);
         }
 
 
@@ -192,11 +213,51 @@ namespace tgui
         static std::shared_ptr<Widget> getWidget();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Stores a handler under the given connection id
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addHandler(unsigned int id, std::function<void()> handler);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Calls all connected signal handlers
+        ///
+        /// @param parameters      Pointers to the widget and the values that are passed to the handlers
+        /// @param parameterCount  Amount of elements in the parameters array
+        ///
+        /// @return True when at least one signal handler was called
+        ///
+        /// The parameters are written to the parameter list again before each handler is called, so that handlers that emit
+        /// other signals don't change the values that are passed to the remaining handlers of this signal.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool callHandlers(const void* const* parameters, std::size_t parameterCount);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        std::string m_name;
-        std::map<unsigned int, std::function<void()>> m_handlers;
+        struct Handler
+        {
+            unsigned int id; // 0 when the handler was disconnected while the signal was being emitted
+            std::function<void()> function;
+        };
+
+        // The handlers are shared with the emit function so that they stay alive when the signal is destroyed by a handler.
+        // Handlers connected during emission are stored separately and disconnected handlers are only erased afterwards,
+        // so that the handlers can be called without copying them.
+        struct HandlerList
+        {
+            std::vector<Handler> handlers;
+            std::vector<Handler> connectedWhileEmitting;
+            unsigned int emitDepth = 0;
+            bool disconnectedWhileEmitting = false;
+        };
+
+        const char* m_name; // Points to a string literal or to the owned name
+        std::unique_ptr<const std::string> m_ownedName; // Only created when the name isn't a string literal
+        std::shared_ptr<HandlerList> m_handlers; // Only created when the first handler is connected
     };
 
 
@@ -211,6 +272,24 @@ namespace tgui
         using Delegate##TypeName##Ex = std::function<void(std::shared_ptr<Widget>, const std::string&, Type)>; \
         using Signal::connect; \
         \
+        /************************************************************************************************************************ \
+         * @brief Constructor for a signal that is named with a string literal
+         ************************************************************************************************************************/ \
+        template <std::size_t N> \
+        Signal##TypeName(const char (&name)[N]) : \
+            Signal{name, 1} \
+        { \
+        } \
+        \
+        /************************************************************************************************************************ \
+         * @brief Constructor for a signal that is named with a character buffer, which is copied into the signal
+         ************************************************************************************************************************/ \
+        template <std::size_t N> \
+        Signal##TypeName(char (&name)[N]) : \
+            Signal{std::string{name}, 1} \
+        { \
+        } \
+        \
         /************************************************************************************************************************ \
          * @brief Constructor
          ************************************************************************************************************************/ \
@@ -243,11 +322,8 @@ namespace tgui
          ************************************************************************************************************************/ \
         bool emit(const Widget* widget, Type strParam) \
         { \
-            if (m_handlers.empty()) \
-                return false; \
-         \
-            internal_signal::parameters[1] = static_cast<const void*>(&strParam); \
-            return Signal::emit(widget); \
+            const void* parameters[] = {&widget, &strParam}; \
+            return callHandlers(parameters, 2); \
         } \
         \
         /************************************************************************************************************************ \
@@ -280,6 +356,26 @@ namespace tgui
         using Signal::connect;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor for a signal that is named with a string literal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <std::size_t N>
+        SignalRange(const char (&name)[N]) :
+            Signal{name, 2}
+        {
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor for a signal that is named with a character buffer, which is copied into the signal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <std::size_t N>
+        SignalRange(char (&name)[N]) :
+            Signal{std::string{name}, 2}
+        {
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -341,6 +437,26 @@ namespace tgui
         using Signal::connect;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor for a signal that is named with a string literal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <std::size_t N>
+        SignalChildWindow(const char (&name)[N]) :
+            Signal{name, 1}
+        {
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor for a signal that is named with a character buffer, which is copied into the signal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <std::size_t N>
+        SignalChildWindow(char (&name)[N]) :
+            Signal{std::string{name}, 1}
+        {
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -404,6 +520,26 @@ namespace tgui
         using Signal::connect;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor for a signal that is named with a string literal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <std::size_t N>
+        SignalItem(const char (&name)[N]) :
+            Signal{name, 2}
+        {
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor for a signal that is named with a character buffer, which is copied into the signal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <std::size_t N>
+        SignalItem(char (&name)[N]) :
+            Signal{std::string{name}, 2}
+        {
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -459,12 +595,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, const sf::String& item, const sf::String& id)
         {
-            if (m_handlers.empty())
-                return false;
-
-            internal_signal::parameters[1] = static_cast<const void*>(&item);
-            internal_signal::parameters[2] = static_cast<const void*>(&id);
-            return Signal::emit(widget);
+            const void* parameters[] = {&widget, &item, &id};
+            return callHandlers(parameters, 3);
         }
 
 
@@ -495,6 +627,26 @@ namespace tgui
         using Signal::connect;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor for a signal that is named with a string literal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <std::size_t N>
+        SignalMenuItem(const char (&name)[N]) :
+            Signal{name, 2}
+        {
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor for a signal that is named with a character buffer, which is copied into the signal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <std::size_t N>
+        SignalMenuItem(char (&name)[N]) :
+            Signal{std::string{name}, 2}
+        {
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -550,12 +702,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, const sf::String& item, const std::vector<sf::String>& fullItem)
         {
-            if (m_handlers.empty())
-                return false;
-
-            internal_signal::parameters[1] = static_cast<const void*>(&item);
-            internal_signal::parameters[2] = static_cast<const void*>(&fullItem);
-            return Signal::emit(widget);
+            const void* parameters[] = {&widget, &item, &fullItem};
+            return callHandlers(parameters, 3);
         }
 
 
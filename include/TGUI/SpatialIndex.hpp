@@ -0,0 +1,135 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_SPATIAL_INDEX_HPP
+#define TGUI_SPATIAL_INDEX_HPP
+
+#include <TGUI/Config.hpp>
+#include <TGUI/Vector2f.hpp>
+#include <TGUI/FloatRect.hpp>
+#include <unordered_map>
+#include <cstdint>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Widget;
+
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Uniform grid over the bounds of the widgets inside a container
+        ///
+        /// The index is only a broad phase: it returns the widgets of which the bounds contain the point, but the container
+        /// still has to call mouseOnWidget on these candidates. Each widget is stored together with its index in the container,
+        /// so that the candidates can be returned in the same order as the container would otherwise loop over them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API SpatialIndex
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Creates an empty index with cells of the given size
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            explicit SpatialIndex(float cellSize = 64);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Adds a widget to the index or updates its bounds when it was already added.
+            // Bounds with an infinite size are never culled: the widget is returned for every query.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void insert(const Widget* widget, std::size_t order, const FloatRect& bounds);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Updates the bounds of a widget. Returns false (and does nothing) when the widget isn't part of the index.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            bool update(const Widget* widget, const FloatRect& bounds);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Changes the index of the widget inside the container
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void setOrder(const Widget* widget, std::size_t order);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Removes a widget from the index
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void remove(const Widget* widget);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Removes all widgets from the index
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void clear();
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the amount of widgets in the index
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getWidgetCount() const;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Fills the list with all widgets of which the bounds may contain the point, sorted from the widget with the
+            // highest order (the one in front) to the lowest order. The first value of each pair is the order of the widget.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void query(Vector2f point, std::vector<std::pair<std::size_t, const Widget*>>& candidates) const;
+
+
+        private:
+
+            struct Entry
+            {
+                std::size_t order = 0;
+                bool unbounded = false;
+                int left = 0;
+                int top = 0;
+                int right = 0;
+                int bottom = 0;
+            };
+
+            void addToCells(const Widget* widget, Entry& entry, const FloatRect& bounds);
+            void removeFromCells(const Widget* widget, const Entry& entry);
+
+            std::uint64_t getCellKey(int x, int y) const;
+
+
+        private:
+
+            float m_cellSize;
+
+            std::unordered_map<const Widget*, Entry> m_entries;
+            std::unordered_map<std::uint64_t, std::vector<const Widget*>> m_cells;
+
+            // Widgets that are too large for the grid or of which the size is infinite
+            std::vector<const Widget*> m_unboundedWidgets;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_SPATIAL_INDEX_HPP
@@ -208,6 +208,19 @@ namespace tgui
         void draw(sf::RenderTarget& target, sf::RenderStates states) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the sprite as if it had a different size
+        ///
+        /// @param target  Render target to draw to
+        /// @param states  Current render states
+        /// @param size    Size to draw the image with
+        ///
+        /// The sprite itself is not changed, so widgets can draw the same sprite multiple times with different sizes without
+        /// having to copy it first.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void draw(sf::RenderTarget& target, sf::RenderStates states, Vector2f size) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -217,6 +230,12 @@ namespace tgui
         void updateVertices();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the given vertices with the position, rotation, clipping and texture of the sprite
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawVertices(sf::RenderTarget& target, sf::RenderStates states, Vector2f size, const sf::Vertex* vertices, std::size_t vertexCount) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -30,7 +30,7 @@
 #include <TGUI/Color.hpp>
 #include <TGUI/Vector2f.hpp>
 #include <TGUI/TextStyle.hpp>
-#include <SFML/Graphics/Text.hpp>
+#include <TGUI/TextLayoutCache.hpp>
 #include <SFML/Graphics/Transformable.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -258,19 +258,24 @@ namespace tgui
     private:
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Calculates the size of the text again after something changed.
+        // Returns the layout of the text, or a nullptr when there is no font. The layout is only taken from the cache when it is
+        // needed, so that setting the font, character size and string one after another doesn't create layouts in between.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void recalculateSize();
+        const priv::TextLayout* getLayout() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
-        sf::Text     m_text;
-        Vector2f     m_size;
+        sf::String   m_string;
+        unsigned int m_characterSize = 30;
+        unsigned int m_style = sf::Text::Regular;
         Font         m_font;
         Color        m_color;
         float        m_opacity = 1;
+        sf::Color    m_vertexColor = sf::Color::White;
+
+        mutable std::shared_ptr<const priv::TextLayout> m_layout; // Shared with other texts that look the same, nullptr until needed
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
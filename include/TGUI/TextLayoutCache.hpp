@@ -0,0 +1,175 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_TEXT_LAYOUT_CACHE_HPP
+#define TGUI_TEXT_LAYOUT_CACHE_HPP
+
+#include <TGUI/Config.hpp>
+#include <TGUI/Vector2f.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/String.hpp>
+#include <memory>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Measured size and glyph geometry of a string with a specific font, character size and style
+        ///
+        /// Layouts are shared between all texts that display the same string in the same way, which is why they can't be changed
+        /// after they were created. The vertices are white so that every text can apply its own color while drawing them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API TextLayout
+        {
+        public:
+
+            TextLayout(const sf::String& string, unsigned int characterSize, sf::Uint32 style, Vector2f size);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the size of the text, as used by the widgets to position it
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            Vector2f getSize() const
+            {
+                return m_size;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the triangles that draw the glyphs with the texture of the font at the character size of the layout.
+            // The font must be the one for which the layout was created. The geometry is only created when first needed,
+            // because measuring a text doesn't require the glyphs to be rendered.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            const std::vector<sf::Vertex>& getVertices(const sf::Font& font) const;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the amount of bytes used by the layout
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getMemoryUsage() const;
+
+
+        private:
+
+            friend class TextLayoutCache;
+
+            sf::String m_string;
+            unsigned int m_characterSize;
+            sf::Uint32 m_style;
+            Vector2f m_size;
+
+            mutable std::vector<sf::Vertex> m_vertices;
+            mutable bool m_verticesCreated = false;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Least recently used cache of text layouts, keyed by font, character size, style and string
+        ///
+        /// Many widgets display the same strings (e.g. list items, menu entries or repeated button captions). Instead of every
+        /// text measuring its own string and keeping its own geometry, the texts share the layouts from this cache. When the
+        /// cache has too many layouts or uses too much memory, the layout that wasn't requested for the longest time is removed
+        /// from it. Texts that still use that layout keep it alive, they only stop sharing it with new texts. Long strings
+        /// (e.g. the contents of a text box) are rarely shared and are never added to the cache.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API TextLayoutCache
+        {
+        public:
+
+            struct Statistics
+            {
+                std::size_t hits = 0;        // Amount of requests that were found in the cache
+                std::size_t misses = 0;      // Amount of requests for which a new layout had to be created
+                std::size_t evictions = 0;   // Amount of layouts that were removed because the cache was full
+                std::size_t uncached = 0;    // Amount of layouts that weren't added to the cache because of their length
+                std::size_t entryCount = 0;  // Amount of layouts currently in the cache
+                std::size_t memoryUsage = 0; // Amount of bytes used by the layouts in the cache
+            };
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the layout of a string. The font must not be a nullptr.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static std::shared_ptr<const TextLayout> get(const std::shared_ptr<sf::Font>& font, unsigned int characterSize,
+                                                         sf::Uint32 style, const sf::String& string);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Changes the maximum amount of layouts in the cache. Setting it to 0 disables the cache.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static void setCapacity(std::size_t capacity);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the maximum amount of layouts in the cache
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static std::size_t getCapacity();
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Changes the maximum amount of bytes that the layouts in the cache may use. The geometry of a layout is only
+            // created when it is drawn, so the memory of a layout is counted as if its geometry already exists.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static void setMemoryLimit(std::size_t bytes);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the maximum amount of bytes that the layouts in the cache may use
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static std::size_t getMemoryLimit();
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the maximum length of a string for which the layout is stored in the cache
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static std::size_t getMaximumStringLength();
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Removes all cached layouts of a font, which is needed when a font object is loaded again
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static void invalidate(const sf::Font* font);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Removes all layouts from the cache
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static void clear();
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the counters of the cache. The memory usage is calculated when calling this function.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static Statistics getStatistics();
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Sets the hit, miss and eviction counters back to 0
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static void resetStatistics();
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TEXT_LAYOUT_CACHE_HPP
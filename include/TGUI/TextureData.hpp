@@ -47,10 +47,28 @@ namespace tgui
     // Used by the Texture class
     struct TGUI_API TextureData
     {
-        std::unique_ptr<sf::Image> image;
+        // Returns the texture that has to be used when drawing, which is the texture atlas when the image was packed into one
+        const sf::Texture& getTexture() const
+        {
+            return atlasTexture ? *atlasTexture : texture;
+        }
+
+        // Returns the size of the (part of the) image
+        sf::Vector2u getSize() const
+        {
+            return atlasTexture ? atlasSize : texture.getSize();
+        }
+
+        std::shared_ptr<sf::Image> image;
         sf::Texture texture;
         sf::IntRect rect;
         sf::Shader* shader = nullptr;
+
+        // When the image is stored in a texture atlas, the texture member remains empty and the pixels are found inside
+        // the atlas texture at the given offset. The offset has to be added to the texture coordinates when drawing.
+        std::shared_ptr<sf::Texture> atlasTexture;
+        sf::Vector2u atlasOffset;
+        sf::Vector2u atlasSize;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -29,9 +29,9 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/TextureData.hpp>
+#include <unordered_map>
 #include <memory>
-#include <list>
-#include <map>
+#include <string>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -44,6 +44,25 @@ namespace tgui
     class TGUI_API TextureManager
     {
     public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Information about the textures that are currently loaded
+        ///
+        /// Comparing textureCount with gpuTextureCount shows how many texture switches are saved by the texture atlas.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Statistics
+        {
+            std::size_t textureCount = 0;      //!< Amount of textures (distinct image parts) that are loaded
+            std::size_t atlasTextureCount = 0; //!< Amount of loaded textures that are stored inside a texture atlas
+            std::size_t atlasPageCount = 0;    //!< Amount of atlas textures that contain several small images
+            std::size_t gpuTextureCount = 0;   //!< Amount of sf::Texture objects that are actually uploaded to the GPU
+            std::size_t gpuMemory = 0;         //!< Amount of bytes used by the pixels of all textures on the GPU
+            std::size_t gpuMemoryWithoutAtlas = 0; //!< Amount of bytes that the textures would use without the atlas
+            std::size_t imageCount = 0;        //!< Amount of images that are kept in memory
+            std::size_t imageMemory = 0;       //!< Amount of bytes used by the pixels of the images in memory
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads a texture
         ///
@@ -79,10 +98,71 @@ namespace tgui
         static void removeTexture(std::shared_ptr<TextureData> textureDataToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether textures that are loaded from now on should be stored in a texture atlas
+        ///
+        /// @param enabled  Should the texture atlas be used?
+        ///
+        /// When enabled, all parts of the same image will share a single texture that contains the entire image, instead of
+        /// each part being uploaded to a separate texture. Small images that are loaded completely are packed together into
+        /// shared atlas pages. Widgets that use textures from the same atlas can be drawn without switching textures.
+        ///
+        /// Textures in the atlas are never smoothed. Calling setSmooth(true) on such a texture will move it out of the atlas.
+        /// Textures that were already loaded are not affected when this setting is changed.
+        ///
+        /// The texture atlas is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAtlasEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether textures that are loaded from now on are stored in a texture atlas
+        ///
+        /// @return Is the texture atlas used?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isAtlasEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns information about the amount of textures and the memory that they use
+        ///
+        /// @return Statistics about all textures that were loaded by the texture manager
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static Statistics getStatistics();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        static std::map<std::string, std::list<TextureDataHolder>> m_imageMap;
+        // Textures are looked up by the combination of their filename and the part of the image that they use
+        struct TextureKey
+        {
+            std::string filename;
+            sf::IntRect rect;
+
+            bool operator==(const TextureKey& other) const
+            {
+                return (filename == other.filename) && (rect == other.rect);
+            }
+        };
+
+        struct TextureKeyHash
+        {
+            std::size_t operator()(const TextureKey& key) const;
+        };
+
+        // The image is shared between all textures that are loaded from the same file
+        struct ImageHolder
+        {
+            std::shared_ptr<sf::Image> image;
+            std::shared_ptr<sf::Texture> atlasTexture; // Texture containing the entire image when the atlas is used
+            unsigned int textureCount = 0;
+        };
+
+        static std::unordered_map<TextureKey, TextureDataHolder, TextureKeyHash> m_textureMap;
+        static std::unordered_map<const TextureData*, TextureDataHolder*> m_textureDataMap;
+        static std::unordered_map<std::string, ImageHolder> m_imageMap;
+        static bool m_atlasEnabled;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
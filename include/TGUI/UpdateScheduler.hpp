@@ -0,0 +1,105 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_UPDATE_SCHEDULER_HPP
+#define TGUI_UPDATE_SCHEDULER_HPP
+
+#include <TGUI/Config.hpp>
+#include <SFML/System/Time.hpp>
+#include <unordered_map>
+#include <memory>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Widget;
+
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Keeps track of the widgets that need to know the elapsed time
+        ///
+        /// Only the widgets that are animating or waiting for a timer (e.g. a blinking caret or a double click) are updated,
+        /// instead of all widgets in the gui. A widget is removed from the schedule when it is updated, so it has to schedule
+        /// itself again from within its update function for as long as it needs time. Widgets that are hidden are also removed
+        /// from the schedule, they are scheduled again when they become visible.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API UpdateScheduler
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Makes sure that the widget gets updated the next time the scheduler is updated. The delay is the time after which
+            // the widget has something to change, it is used to find out how long the gui can wait before being updated again.
+            // When the widget was already scheduled then the shortest delay is kept.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void schedule(Widget& widget, sf::Time delay);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Passes the elapsed time to all scheduled widgets that are still part of the given root container
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void update(sf::Time elapsedTime, const Widget& root);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the time until the earliest delay of the scheduled widgets has passed.
+            // Returns false and leaves the parameter unchanged when no widget is scheduled.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            bool getTimeUntilNextUpdate(sf::Time& time) const;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the amount of widgets that will be updated the next time the scheduler is updated
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getScheduledWidgetCount() const;
+
+
+        private:
+
+            struct Entry
+            {
+                std::weak_ptr<Widget> widget;
+                sf::Time deadline;
+            };
+
+            // Total time that was passed to the update function, the deadlines are relative to this time
+            sf::Time m_time;
+
+            std::vector<Entry> m_scheduledWidgets;
+            std::unordered_map<const Widget*, std::size_t> m_scheduledWidgetIndices;
+
+            // Widgets that are being updated, they are moved out of the schedule so that they can schedule themselves again
+            std::vector<Entry> m_updatingWidgets;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_UPDATE_SCHEDULER_HPP
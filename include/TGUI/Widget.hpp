@@ -63,6 +63,7 @@ namespace tgui
     namespace priv
     {
         class Animation;
+        class FadeAnimation;
     }
 
 
@@ -129,6 +130,7 @@ namespace tgui
         /// @brief Returns the renderer, which gives access to functions that determine how the widget is displayed
         /// @return Temporary pointer to the renderer
         /// @warning After calling this function, the widget has its own copy of the renderer and it will no longer be shared.
+        ///          The const version doesn't copy the renderer, it is identical to getSharedRenderer.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         WidgetRenderer* getRenderer();
         const WidgetRenderer* getRenderer() const;
@@ -410,7 +412,7 @@ namespace tgui
         void setUserData(tgui::Any userData)
     #endif
         {
-            m_userData = std::move(userData);
+            getSideStorage().userData = std::move(userData);
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -422,9 +424,9 @@ namespace tgui
         T getUserData() const
         {
         #ifdef TGUI_USE_CPP17
-            return std::any_cast<T>(m_userData);
+            return m_sideStorage ? std::any_cast<T>(m_sideStorage->userData) : std::any_cast<T>(std::any{});
         #else
-            return m_userData.as<T>();
+            return m_sideStorage ? m_sideStorage->userData.as<T>() : tgui::Any{}.as<T>();
         #endif
         }
 
@@ -461,6 +463,18 @@ namespace tgui
         float getInheritedOpacity() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the opacity of the running fade animation
+        ///
+        /// @return Opacity with which the widget and its children are currently drawn, or 1 when the widget isn't fading
+        ///
+        /// The fade animation doesn't change the inherited opacity of the widget and its children. The opacity is instead
+        /// applied to the vertices while the widget is being drawn, so the colors of the widgets don't have to be recalculated
+        /// on every frame of the animation.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getAnimatedOpacity() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Sets the tool tip that should be displayed when hovering over the widget
         ///
@@ -501,11 +515,37 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// This function is called every frame with the time passed since the last frame.
+        /// This function is called with the time passed since the previous update, but only after the widget called
+        /// scheduleUpdate. It is not called every frame and it isn't called while the widget is hidden.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void update(sf::Time elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Makes sure that the update function is called during the next frame. Widgets only receive the elapsed time when
+        /// they ask for it, so a widget has to call this function again from its update function as long as it needs time.
+        ///
+        /// @param delay  Time after which the widget has something to change (e.g. when the caret has to blink)
+        ///
+        /// This function has no effect when the widget hasn't been added to a gui yet.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scheduleUpdate(sf::Time delay = {});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks the area occupied by the widget as having to be redrawn
+        ///
+        /// The widgets call this function themselves whenever they change, e.g. when they are moved or hovered, when a setter
+        /// changes their value, items or text, or when their renderer changes. Custom widgets have to call it after changing
+        /// how they look, so that the change becomes visible when the gui only redraws the parts of the screen that changed
+        /// or when the widget is inside a container that has its render cache enabled.
+        ///
+        /// This function has no effect when the widget hasn't been added to a gui yet.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidate();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         ///
@@ -513,6 +553,17 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual bool mouseOnWidget(Vector2f pos) const = 0;
 
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns the area (relative to the parent widget) outside of which the widget is never drawn and mouseOnWidget never
+        /// returns true. The parent uses it to find the widgets below the mouse or inside a damaged region without checking
+        /// every child. Widgets that draw outside of their position and full size (e.g. the open menus of a menu bar) have to
+        /// override this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual FloatRect getHitTestBounds() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -694,6 +745,14 @@ namespace tgui
         virtual void mouseLeftWidget();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the color with the opacity of the widget applied to it, while an unset color remains unset.
+        // The colors that a widget draws as shapes are cached this way when the renderer changes, which is why widgets also
+        // update these colors when their opacity changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Color applyOpacity(const Color& color) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draw a rectangle shape with the right opacity
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -713,6 +772,25 @@ namespace tgui
                          Color color) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draw a rectangle shape with a color to which applyOpacity was already applied
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawFadedRectangleShape(sf::RenderTarget& target,
+                                     const sf::RenderStates& states,
+                                     Vector2f size,
+                                     Color color) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draw the borders around the widget with a color to which applyOpacity was already applied
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawFadedBorders(sf::RenderTarget& target,
+                              const sf::RenderStates& states,
+                              const Borders& borders,
+                              Vector2f size,
+                              Color color) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -722,6 +800,18 @@ namespace tgui
         void rendererChangedCallback(const std::string& property);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks an area (relative to the parent, just like the position of the widget) as having to be redrawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateArea(Vector2f position, Vector2f size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Subscribes to the renderer, which will call rendererChangedCallback when a property changes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void subscribeToRenderer();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
@@ -746,10 +836,6 @@ namespace tgui
         Vector2f m_prevPosition;
         Vector2f m_prevSize;
 
-        // Layouts that need to recalculate their value when the position or size of this widget changes
-        std::unordered_set<Layout*> m_boundPositionLayouts;
-        std::unordered_set<Layout*> m_boundSizeLayouts;
-
         // When a widget is disabled, it will no longer receive events
         bool m_enabled = true;
 
@@ -775,15 +861,9 @@ namespace tgui
         // This is set to true for widgets that store other widgets inside them
         bool m_containerWidget = false;
 
-        // The tool tip connected to the widget
-        Widget::Ptr m_toolTip = nullptr;
-
         // Renderer of the widget
         aurora::CopiedPtr<WidgetRenderer> m_renderer = aurora::makeCopied<WidgetRenderer>();
 
-        // Show animations
-        std::vector<std::shared_ptr<priv::Animation>> m_showAnimations;
-
         // Renderer properties that can be passed from containers to their children
         Font m_inheritedFont;
         float m_inheritedOpacity = 1;
@@ -792,18 +872,46 @@ namespace tgui
         Font  m_fontCached = getGlobalFont();
         float m_opacityCached = 1;
 
-    #ifdef TGUI_USE_CPP17
-        std::any m_userData;
-    #else
-        tgui::Any m_userData;
-    #endif
+        // Opacity of the fade animation, applied while drawing the widget instead of being passed to its children
+        float m_animatedOpacity = 1;
+
+        // Parts of the widget that most widgets never use. They are only allocated when one of them is needed.
+        struct SideStorage
+        {
+            // Layouts that need to recalculate their value when the position or size of this widget changes
+            std::unordered_set<Layout*> boundPositionLayouts;
+            std::unordered_set<Layout*> boundSizeLayouts;
+
+            // The tool tip connected to the widget
+            Widget::Ptr toolTip;
 
-        std::function<void(const std::string& property)> m_rendererChangedCallback = [this](const std::string& property){ rendererChangedCallback(property); };
+            // Show animations
+            std::vector<std::shared_ptr<priv::Animation>> showAnimations;
+
+        #ifdef TGUI_USE_CPP17
+            std::any userData;
+        #else
+            tgui::Any userData;
+        #endif
+        };
+
+        std::unique_ptr<SideStorage> m_sideStorage;
+
+        // Returns the side storage, after creating it if it didn't exist yet
+        SideStorage& getSideStorage()
+        {
+            if (!m_sideStorage)
+                m_sideStorage = make_unique<SideStorage>();
+
+            return *m_sideStorage;
+        }
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         friend class Container; // Container accesses m_mouseDown, m_draggableWidget, save and load
+        friend class LayoutScheduler; // LayoutScheduler accesses the bound layouts in m_sideStorage
+        friend class priv::FadeAnimation; // FadeAnimation changes m_animatedOpacity
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -31,6 +31,7 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/ChatBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <TGUI/HeightIndex.hpp>
 #include <deque>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -53,6 +54,7 @@ namespace tgui
         {
             Text text;
             sf::String string;
+            bool wrapped = false; // Lines are only word-wrapped once they become visible
         };
 
 
@@ -337,7 +339,19 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates all text attributes, recalculate the full text height and update the displayed text
+        // Returns the height of the line when it wouldn't be word-wrapped, which is used until the line becomes visible
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getUnwrappedLineHeight(const Line& line) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Word-wraps the lines that are visible and that weren't word-wrapped yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void wrapVisibleLines();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks all lines to be word-wrapped again, recalculate the full text height and update the displayed text
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateAllLines();
 
@@ -425,6 +439,7 @@ namespace tgui
         CopiedSharedPtr<ScrollbarChildWidget> m_scroll;
 
         std::deque<Line> m_lines;
+        priv::HeightIndex m_lineHeights;
 
         Sprite m_spriteBackground;
 
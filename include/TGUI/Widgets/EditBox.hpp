@@ -29,8 +29,8 @@
 #include <TGUI/Widgets/ClickableWidget.hpp>
 #include <TGUI/Renderers/EditBoxRenderer.hpp>
 #include <TGUI/FloatRect.hpp>
+#include <TGUI/InputValidator.hpp>
 #include <TGUI/Text.hpp>
-#include <regex>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -371,6 +371,10 @@ namespace tgui
         /// When the regex does not match when calling the setText function then the edit box contents will be cleared.
         /// When it does not match when the user types a character in the edit box, then the input character is rejected.
         ///
+        /// The predefined validators and most simple expressions are checked without std::regex, only looking at the typed
+        /// characters where possible. Expressions with anchors, assertions or back-references still fall back to std::regex,
+        /// in which case unicode characters can't be validated.
+        ///
         /// Examples:
         /// @code
         /// edit1->setInputValidator(EditBox::Validator::Int);
@@ -554,8 +558,7 @@ namespace tgui
         // The text inside the edit box
         sf::String    m_text;
 
-        std::string   m_regexString = ".*";
-        std::regex    m_regex = std::regex{m_regexString};
+        priv::InputValidator m_inputValidator;
 
         // This will store the size of the text ( 0 to auto size )
         unsigned int  m_textSize = 0;
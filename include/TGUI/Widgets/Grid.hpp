@@ -28,6 +28,7 @@
 
 
 #include <TGUI/Container.hpp>
+#include <unordered_map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -151,6 +152,28 @@ namespace tgui
         bool getAutoSize() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the widgets are repositioned immediately when widgets are added or resized
+        ///
+        /// @param suspended  Should repositioning the widgets be postponed until the layout is no longer suspended?
+        ///
+        /// While the layout is suspended, adding widgets to the grid or changing their size only remembers that the grid has
+        /// to be updated. The size of all rows and columns and the positions of the widgets are recalculated once when the
+        /// layout is resumed. Suspending the layout thus makes it a lot faster to fill or resize a large grid.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setLayoutSuspended(bool suspended);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether repositioning the widgets is postponed
+        ///
+        /// @return Is the layout suspended?
+        ///
+        /// @see setLayoutSuspended
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isLayoutSuspended() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Removes a single widget that was added to the container
         ///
@@ -351,12 +374,62 @@ namespace tgui
         void updatePositionsOfAllWidgets();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Repositions the widgets in the rows starting from firstRow and the widgets in the columns starting from firstColumn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updatePositionsOfWidgets(std::size_t firstRow, std::size_t firstColumn);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the position and size of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateWidgets();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the grid after the widget in a cell was added or resized. Only the row and column of the cell are measured
+        // again, and only the widgets that are moved by a change in that row or column are repositioned.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateCell(std::size_t row, std::size_t column);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the height of a row or the width of a column. Returns whether the value changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateRowHeight(std::size_t row);
+        bool updateColumnWidth(std::size_t column);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the size of the grid to fit all rows and columns when the grid is auto-sized
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateAutoSize();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the space added between the cells when the grid is larger than the widgets need
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Vector2f getExtraCellOffset() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the position of the top left corner of a cell, including half of the extra space around it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Vector2f getCellPosition(std::size_t row, std::size_t column) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Positions the widget inside its cell, based on its borders and alignment
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateWidgetPosition(std::size_t row, std::size_t column, Vector2f cellPosition);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure that the cell of the widget is updated when the widget is resized
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void connectSizeChanged(const Widget::Ptr& widget);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -380,6 +453,12 @@ namespace tgui
 
         std::map<Widget::Ptr, unsigned int> m_connectedCallbacks;
 
+        // The row and column of each widget, so that only that cell has to be updated when the widget is resized
+        std::unordered_map<const Widget*, std::pair<std::size_t, std::size_t>> m_widgetCells;
+
+        bool m_layoutSuspended = false;
+        bool m_layoutUpdatePending = false;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
@@ -31,6 +31,7 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/ListBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <unordered_map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -545,9 +546,9 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Update the colors and text style of the selected and hovered items
+        // Update the color and text style of a single item, if it currently has a text object
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateSelectedAndHoveringItemColorsAndStyle();
+        void updateItemColorAndStyle(int item);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -556,6 +557,19 @@ namespace tgui
         void updateItemColorsAndStyle();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates text objects for the items that are visible (plus a few around them) when they don't exist yet.
+        // All text objects are recreated when the pool was cleared.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleItems();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rebuilds the map to find the index of an item based on its id
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateItemIdIndices();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Update on which item the mouse is standing
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -595,10 +609,22 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        struct ItemIdHash
+        {
+            std::size_t operator()(const sf::String& id) const;
+        };
+
         // This contains the different items in the list box
-        std::vector<Text>       m_items;
+        std::vector<sf::String> m_items;
         std::vector<sf::String> m_itemIds;
 
+        // The index of the first item with each id
+        std::unordered_map<sf::String, std::size_t, ItemIdHash> m_itemIdIndices;
+
+        // Only the items that are visible have a text object, starting at the item with index m_firstVisibleItem
+        std::vector<Text> m_visibleItems;
+        std::size_t m_firstVisibleItem = 0;
+
         // What is the index of the selected item?
         // This is also used by combo box, so it can't just be changed to a pointer!
         int m_selectedItem = -1;
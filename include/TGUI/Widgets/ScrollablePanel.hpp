@@ -298,6 +298,12 @@ namespace tgui
         void load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the size of the contents, the render cache has to contain the widgets that are scrolled out of view as well
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Vector2f getRenderCacheSize() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
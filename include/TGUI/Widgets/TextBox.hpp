@@ -50,6 +50,41 @@ namespace tgui
         typedef std::shared_ptr<TextBox> Ptr; ///< Shared widget pointer
         typedef std::shared_ptr<const TextBox> ConstPtr; ///< Shared constant widget pointer
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Part of the text that was replaced
+        struct TextEdit
+        {
+            std::size_t position;
+            std::size_t removedCount;
+            std::size_t insertedCount;
+        };
+
+        // Amount of characters (excluding the newline) in a paragraph and the amount of lines in which it was word-wrapped
+        struct Paragraph
+        {
+            std::size_t length;
+            std::size_t lineCount;
+        };
+
+        // Paragraphs that have to be word-wrapped again after an edit. The lines and text start are those before wrapping,
+        // the text end is the position in the edited text.
+        struct WrapRange
+        {
+            std::size_t firstParagraph;
+            std::size_t lastParagraph;
+            std::size_t firstLine;
+            std::size_t lastLine;
+            std::size_t textStart;
+            std::size_t textEnd;
+            bool entireText;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    public:
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Default constructor
@@ -363,7 +398,28 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // This function will split the text into five pieces so that the text can be easily drawn.
+        // Rearrange the text inside the text box after part of the text was replaced.
+        // Only the paragraphs that were touched by the edit are word-wrapped again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rearrangeText(bool keepSelection, const TextEdit& edit);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Finds the paragraphs of the text that were affected by the edit. The range contains all paragraphs when there is no
+        // valid information about the paragraphs yet.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        WrapRange findWrapRange(float maxLineWidth, const TextEdit& edit) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Word-wraps the paragraphs in the range again and updates m_lines and m_paragraphs.
+        // Returns the amount of lines in which the paragraphs were split.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t wrapParagraphs(float maxLineWidth, const WrapRange& range);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the caret, scrolls it into view and updates the texts of the visible lines after the selection changed.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateSelectionTexts();
 
@@ -405,6 +461,12 @@ namespace tgui
         void recalculateVisibleLines();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recreates the texts and selection rectangles of the visible lines. Lines that aren't visible are never measured.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleLineTexts();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Retrieves a signal based on its name
         ///
@@ -462,6 +524,11 @@ namespace tgui
 
         std::vector<sf::String> m_lines;
 
+        // The lines in which every paragraph (part of the text between newlines) was split by word wrapping, so that an edit
+        // only requires the paragraphs that contain the edit to be word-wrapped again. Only valid for the given wrap width.
+        std::vector<Paragraph> m_paragraphs;
+        float m_paragraphsWrapWidth = 0;
+
         // The maximum characters (0 by default, which means no limit)
         std::size_t m_maxChars = 0;
 
@@ -477,12 +544,10 @@ namespace tgui
         Vector2f m_caretPosition;
         bool m_caretVisible = true;
 
-        Text m_textBeforeSelection;
-        Text m_textSelection1;
-        Text m_textSelection2;
-        Text m_textAfterSelection1;
-        Text m_textAfterSelection2;
+        // Texts of the visible lines. A line consists of multiple texts when part of it is selected.
+        std::vector<Text> m_visibleLineTexts;
 
+        // Background of the selected text on the visible lines
         std::vector<FloatRect> m_selectionRects;
 
         // The scrollbar
@@ -500,6 +565,8 @@ namespace tgui
         Padding m_paddingCached;
         Color   m_borderColorCached;
         Color   m_backgroundColorCached;
+        Color   m_textColorCached;
+        Color   m_selectedTextColorCached;
         Color   m_caretColorCached;
         Color   m_selectedTextBackgroundColorCached;
         float   m_caretWidthCached = 1;
@@ -140,7 +140,7 @@ namespace tgui
                 return true;
             }
 
-            m_widget->setInheritedOpacity(m_startOpacity + ((m_elapsedTime.asSeconds() / m_totalDuration.asSeconds()) * (m_endOpacity - m_startOpacity)));
+            m_widget->m_animatedOpacity = m_startOpacity + ((m_elapsedTime.asSeconds() / m_totalDuration.asSeconds()) * (m_endOpacity - m_startOpacity));
             return false;
         }
 
@@ -148,7 +148,7 @@ namespace tgui
 
         void FadeAnimation::finish()
         {
-            m_widget->setInheritedOpacity(m_endOpacity);
+            m_widget->m_animatedOpacity = m_endOpacity;
             Animation::finish();
         }
 
@@ -0,0 +1,422 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/BatchRenderer.hpp>
+
+#include <algorithm>
+#include <limits>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        namespace
+        {
+            // Amount of earlier batches that are checked when looking for a batch with the same states
+            const std::size_t maxBatchLookBehind = 16;
+
+            bool isSameView(const sf::View& left, const sf::View& right)
+            {
+                return (left.getCenter() == right.getCenter())
+                    && (left.getSize() == right.getSize())
+                    && (left.getRotation() == right.getRotation())
+                    && (left.getViewport() == right.getViewport());
+            }
+
+            sf::Color fadeColor(sf::Color color, float opacity)
+            {
+                return {color.r, color.g, color.b, static_cast<sf::Uint8>(color.a * opacity)};
+            }
+        }
+
+        BatchRenderer* BatchRenderer::m_active = nullptr;
+        float BatchRenderer::m_drawOpacity = 1;
+        std::vector<sf::Vertex> BatchRenderer::m_fadedVertices;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        BatchRenderer::OpacityScope::OpacityScope(float opacity, bool nested) :
+            m_previousOpacity{m_drawOpacity}
+        {
+            if (nested)
+                m_drawOpacity *= opacity;
+            else
+                m_drawOpacity = opacity;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        BatchRenderer::OpacityScope::~OpacityScope()
+        {
+            m_drawOpacity = m_previousOpacity;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float BatchRenderer::getDrawOpacity()
+        {
+            return m_drawOpacity;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void BatchRenderer::begin(sf::RenderTarget& target)
+        {
+            m_target = &target;
+            m_drawCallCount = 0;
+            m_batchCount = 0;
+
+            m_previousActive = m_active;
+            m_active = this;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void BatchRenderer::end()
+        {
+            flush();
+
+            m_active = m_previousActive;
+            m_previousActive = nullptr;
+            m_target = nullptr;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void BatchRenderer::setEnabled(bool enabled)
+        {
+            if (!enabled && m_target)
+                flush();
+
+            m_enabled = enabled;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool BatchRenderer::isEnabled() const
+        {
+            return m_enabled;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t BatchRenderer::getDrawCallCount() const
+        {
+            return m_drawCallCount;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void BatchRenderer::draw(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t vertexCount,
+                                 sf::PrimitiveType type, const sf::RenderStates& states)
+        {
+            draw(target, vertices, vertexCount, type, states, sf::Color::White);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void BatchRenderer::draw(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t vertexCount,
+                                 sf::PrimitiveType type, const sf::RenderStates& states, sf::Color color)
+        {
+            BatchRenderer* renderer = getActive(target);
+            if (renderer && renderer->m_enabled
+             && ((type == sf::PrimitiveType::Triangles) || (type == sf::PrimitiveType::TrianglesStrip)
+              || (type == sf::PrimitiveType::TrianglesFan) || (type == sf::PrimitiveType::Quads)))
+            {
+                // The color and opacity are applied while the vertices are copied into the batch
+                renderer->addVertices(vertices, vertexCount, type, states, color);
+                return;
+            }
+
+            if (renderer)
+            {
+                renderer->flush();
+                renderer->m_drawCallCount++;
+            }
+
+            if ((m_drawOpacity < 1) || (color != sf::Color::White))
+            {
+                m_fadedVertices.assign(vertices, vertices + vertexCount);
+                for (auto& vertex : m_fadedVertices)
+                    vertex.color = fadeColor(vertex.color * color, m_drawOpacity);
+
+                target.draw(m_fadedVertices.data(), vertexCount, type, states);
+            }
+            else
+                target.draw(vertices, vertexCount, type, states);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void BatchRenderer::draw(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states)
+        {
+            BatchRenderer* renderer = getActive(target);
+            if (renderer)
+            {
+                renderer->flush();
+                renderer->m_drawCallCount++;
+            }
+
+            target.draw(drawable, states);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void BatchRenderer::draw(sf::RenderTarget& target, const sf::Shape& shape, const sf::RenderStates& states)
+        {
+            if (m_drawOpacity >= 1)
+            {
+                draw(target, static_cast<const sf::Drawable&>(shape), states);
+                return;
+            }
+
+            // The colors are restored after drawing, the shape only looks different while it is being drawn
+            sf::Shape& fadedShape = const_cast<sf::Shape&>(shape);
+            const sf::Color fillColor = shape.getFillColor();
+            const sf::Color outlineColor = shape.getOutlineColor();
+            fadedShape.setFillColor(fadeColor(fillColor, m_drawOpacity));
+            fadedShape.setOutlineColor(fadeColor(outlineColor, m_drawOpacity));
+            draw(target, static_cast<const sf::Drawable&>(shape), states);
+            fadedShape.setFillColor(fillColor);
+            fadedShape.setOutlineColor(outlineColor);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void BatchRenderer::draw(sf::RenderTarget& target, const sf::Sprite& sprite, const sf::RenderStates& states)
+        {
+            if (m_drawOpacity >= 1)
+            {
+                draw(target, static_cast<const sf::Drawable&>(sprite), states);
+                return;
+            }
+
+            sf::Sprite& fadedSprite = const_cast<sf::Sprite&>(sprite);
+            const sf::Color color = sprite.getColor();
+            fadedSprite.setColor(fadeColor(color, m_drawOpacity));
+            draw(target, static_cast<const sf::Drawable&>(sprite), states);
+            fadedSprite.setColor(color);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void BatchRenderer::draw(sf::RenderTarget& target, const sf::Text& text, const sf::RenderStates& states)
+        {
+            if (m_drawOpacity >= 1)
+            {
+                draw(target, static_cast<const sf::Drawable&>(text), states);
+                return;
+            }
+
+            sf::Text& fadedText = const_cast<sf::Text&>(text);
+        #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+            const sf::Color fillColor = text.getFillColor();
+            const sf::Color outlineColor = text.getOutlineColor();
+            fadedText.setFillColor(fadeColor(fillColor, m_drawOpacity));
+            fadedText.setOutlineColor(fadeColor(outlineColor, m_drawOpacity));
+            draw(target, static_cast<const sf::Drawable&>(text), states);
+            fadedText.setFillColor(fillColor);
+            fadedText.setOutlineColor(outlineColor);
+        #else
+            const sf::Color color = text.getColor();
+            fadedText.setColor(fadeColor(color, m_drawOpacity));
+            draw(target, static_cast<const sf::Drawable&>(text), states);
+            fadedText.setColor(color);
+        #endif
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        BatchRenderer* BatchRenderer::getActive(const sf::RenderTarget& target)
+        {
+            if (m_active && (m_active->m_target == &target))
+                return m_active;
+            else
+                return nullptr;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void BatchRenderer::addVertices(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states, sf::Color color)
+        {
+            if (vertexCount < 3)
+                return;
+
+            // Nothing has to be drawn when the clipping area lies completely outside the viewport
+            const sf::View& view = m_target->getView();
+            if ((view.getViewport().width <= 0) || (view.getViewport().height <= 0))
+                return;
+
+            // Transform the vertices and calculate the area that they cover
+            m_transformedVertices.resize(vertexCount);
+            float left = std::numeric_limits<float>::max();
+            float top = std::numeric_limits<float>::max();
+            float right = std::numeric_limits<float>::lowest();
+            float bottom = std::numeric_limits<float>::lowest();
+            const bool colored = (color != sf::Color::White);
+            const bool faded = (m_drawOpacity < 1);
+            for (std::size_t i = 0; i < vertexCount; ++i)
+            {
+                sf::Vertex& vertex = m_transformedVertices[i];
+                vertex = vertices[i];
+                vertex.position = states.transform.transformPoint(vertex.position);
+                if (colored)
+                    vertex.color = vertex.color * color;
+                if (faded)
+                    vertex.color = fadeColor(vertex.color, m_drawOpacity);
+
+                left = std::min(left, vertex.position.x);
+                top = std::min(top, vertex.position.y);
+                right = std::max(right, vertex.position.x);
+                bottom = std::max(bottom, vertex.position.y);
+            }
+
+            // Look for an earlier batch with the same states. We can only skip over batches that don't overlap with the new
+            // geometry, otherwise the draw order would change. A batch with a different view ends the search, as its bounds
+            // are expressed in different coordinates.
+            Batch* batch = nullptr;
+            for (std::size_t i = m_batchCount, checked = 0; (i > 0) && (checked < maxBatchLookBehind); --i, ++checked)
+            {
+                Batch& candidate = m_batches[i-1];
+                if (!isSameView(candidate.view, view))
+                    break;
+
+                if ((candidate.texture == states.texture) && (candidate.shader == states.shader) && (candidate.blendMode == states.blendMode))
+                {
+                    batch = &candidate;
+                    break;
+                }
+
+                if ((left < candidate.right) && (right > candidate.left) && (top < candidate.bottom) && (bottom > candidate.top))
+                    break;
+            }
+
+            if (batch)
+            {
+                batch->left = std::min(batch->left, left);
+                batch->top = std::min(batch->top, top);
+                batch->right = std::max(batch->right, right);
+                batch->bottom = std::max(batch->bottom, bottom);
+            }
+            else
+            {
+                if (m_batchCount == m_batches.size())
+                    m_batches.emplace_back();
+
+                batch = &m_batches[m_batchCount++];
+                batch->texture = states.texture;
+                batch->shader = states.shader;
+                batch->blendMode = states.blendMode;
+                batch->view = view;
+                batch->left = left;
+                batch->top = top;
+                batch->right = right;
+                batch->bottom = bottom;
+                batch->vertices.clear();
+            }
+
+            // Store the geometry as separate triangles so that it can be combined with the other geometry in the batch
+            std::vector<sf::Vertex>& batchVertices = batch->vertices;
+            switch (type)
+            {
+                case sf::PrimitiveType::TrianglesStrip:
+                {
+                    for (std::size_t i = 2; i < vertexCount; ++i)
+                    {
+                        batchVertices.push_back(m_transformedVertices[i-2]);
+                        batchVertices.push_back(m_transformedVertices[i-1]);
+                        batchVertices.push_back(m_transformedVertices[i]);
+                    }
+                    break;
+                }
+                case sf::PrimitiveType::TrianglesFan:
+                {
+                    for (std::size_t i = 2; i < vertexCount; ++i)
+                    {
+                        batchVertices.push_back(m_transformedVertices[0]);
+                        batchVertices.push_back(m_transformedVertices[i-1]);
+                        batchVertices.push_back(m_transformedVertices[i]);
+                    }
+                    break;
+                }
+                case sf::PrimitiveType::Quads:
+                {
+                    for (std::size_t i = 3; i < vertexCount; i += 4)
+                    {
+                        batchVertices.push_back(m_transformedVertices[i-3]);
+                        batchVertices.push_back(m_transformedVertices[i-2]);
+                        batchVertices.push_back(m_transformedVertices[i-1]);
+                        batchVertices.push_back(m_transformedVertices[i-3]);
+                        batchVertices.push_back(m_transformedVertices[i-1]);
+                        batchVertices.push_back(m_transformedVertices[i]);
+                    }
+                    break;
+                }
+                default: // Triangles
+                {
+                    batchVertices.insert(batchVertices.end(), m_transformedVertices.begin(),
+                                         m_transformedVertices.begin() + static_cast<std::ptrdiff_t>(vertexCount - (vertexCount % 3)));
+                    break;
+                }
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void BatchRenderer::flush()
+        {
+            if (m_batchCount == 0)
+                return;
+
+            // Each batch is drawn with the view that was active when its geometry was added
+            const sf::View oldView = m_target->getView();
+            const sf::View* currentView = &oldView;
+            for (std::size_t i = 0; i < m_batchCount; ++i)
+            {
+                const Batch& batch = m_batches[i];
+                if (!isSameView(*currentView, batch.view))
+                {
+                    m_target->setView(batch.view);
+                    currentView = &batch.view;
+                }
+
+                m_target->draw(batch.vertices.data(), batch.vertices.size(), sf::PrimitiveType::Triangles,
+                               sf::RenderStates{batch.blendMode, sf::Transform::Identity, batch.texture, batch.shader});
+                m_drawCallCount++;
+            }
+
+            if (currentView != &oldView)
+                m_target->setView(oldView);
+
+            m_batchCount = 0;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
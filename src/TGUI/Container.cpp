@@ -27,9 +27,14 @@
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
+#include <TGUI/BatchRenderer.hpp>
+#include <TGUI/Clipping.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <fstream>
+#include <iterator>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -58,6 +63,78 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+        bool isInsideContainer(const Widget& widget, const Container& container)
+        {
+            const Container* parent = widget.getParent();
+            while (parent && (parent != &container))
+                parent = parent->getParent();
+
+            return parent != nullptr;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns the index of the widget in its parent, preceded by the index of that parent in its own parent, etc.
+        std::vector<std::size_t> getPathInsideContainer(const Widget& widget, const Container& container)
+        {
+            std::vector<std::size_t> path;
+            const Widget* child = &widget;
+            while (child != &container)
+            {
+                const Container* parent = child->getParent();
+                const auto& siblings = parent->getWidgets();
+                for (std::size_t i = 0; i < siblings.size(); ++i)
+                {
+                    if (siblings[i].get() == child)
+                    {
+                        path.push_back(i);
+                        break;
+                    }
+                }
+
+                child = parent;
+            }
+
+            std::reverse(path.begin(), path.end());
+            return path;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // A container first checks its direct children and only then searches inside its child containers, in the order
+        // in which they were added. This returns whether the widget at the first path is found before the one at the second.
+        bool isFoundBefore(const std::vector<std::size_t>& path, const std::vector<std::size_t>& otherPath)
+        {
+            for (std::size_t depth = 0; (depth < path.size()) && (depth < otherPath.size()); ++depth)
+            {
+                const bool isLast = (depth + 1 == path.size());
+                const bool otherIsLast = (depth + 1 == otherPath.size());
+                if (isLast != otherIsLast)
+                    return isLast;
+
+                if (path[depth] != otherPath[depth])
+                    return path[depth] < otherPath[depth];
+            }
+
+            return false;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void scheduleUpdates(GuiContainer& gui, const Container* container)
+        {
+            for (const auto& child : container->getWidgets())
+            {
+                gui.scheduleWidgetUpdate(*child, {});
+
+                Container* childContainer = dynamic_cast<Container*>(child.get());
+                if (childContainer)
+                    scheduleUpdates(gui, childContainer);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         std::unique_ptr<DataIO::Node> saveRenderer(RendererData* renderer, const std::string& name)
         {
             auto node = make_unique<DataIO::Node>();
@@ -68,18 +145,9 @@ namespace tgui
                 if (pair.first == "font" && ObjectConverter{pair.second}.getString() == "null")
                     continue;
 
+                // Nested renderers are saved directly as child nodes instead of being converted to text and parsed again
                 if (pair.second.getType() == ObjectConverter::Type::RendererData)
-                {
-                    std::stringstream ss{ObjectConverter{pair.second}.getString()};
-                    auto rendererRootNode = DataIO::parse(ss);
-
-                    // If there are braces around the renderer string, then the child node is the one we need
-                    if (rendererRootNode->propertyValuePairs.empty() && (rendererRootNode->children.size() == 1))
-                        rendererRootNode = std::move(rendererRootNode->children[0]);
-
-                    rendererRootNode->name = pair.first;
-                    node->children.push_back(std::move(rendererRootNode));
-                }
+                    node->children.push_back(saveRenderer(ObjectConverter{pair.second}.getRenderer().get(), pair.first));
                 else
                     node->propertyValuePairs[pair.first] = make_unique<DataIO::ValueNode>(ObjectConverter{pair.second}.getString());
             }
@@ -102,6 +170,11 @@ namespace tgui
     Container::Container(const Container& other) :
         Widget{other}
     {
+        if (other.m_spatialIndex)
+            setSpatialIndexEnabled(true);
+        if (other.m_renderCache)
+            setRenderCacheEnabled(true);
+
         // Copy all the widgets
         for (std::size_t i = 0; i < other.m_widgets.size(); ++i)
             add(other.m_widgets[i]->clone(), other.m_widgetNames[i]);
@@ -115,7 +188,9 @@ namespace tgui
         m_widgetNames         {std::move(other.m_widgetNames)},
         m_widgetBelowMouse    {std::move(other.m_widgetBelowMouse)},
         m_focusedWidget       {std::move(other.m_focusedWidget)},
-        m_handingMouseReleased{std::move(other.m_handingMouseReleased)}
+        m_handingMouseReleased{std::move(other.m_handingMouseReleased)},
+        m_spatialIndex        {std::move(other.m_spatialIndex)},
+        m_renderCache         {std::move(other.m_renderCache)}
     {
         for (auto& widget : m_widgets)
             widget->setParent(this);
@@ -149,6 +224,9 @@ namespace tgui
             // Remove all the old widgets
             Container::removeAllWidgets();
 
+            setSpatialIndexEnabled(right.isSpatialIndexEnabled());
+            setRenderCacheEnabled(right.isRenderCacheEnabled());
+
             // Copy all the widgets
             for (std::size_t i = 0; i < right.m_widgets.size(); ++i)
             {
@@ -173,6 +251,8 @@ namespace tgui
             m_widgetBelowMouse     = std::move(right.m_widgetBelowMouse);
             m_focusedWidget        = std::move(right.m_focusedWidget);
             m_handingMouseReleased = std::move(right.m_handingMouseReleased);
+            m_spatialIndex         = std::move(right.m_spatialIndex);
+            m_renderCache          = std::move(right.m_renderCache);
 
             for (auto& widget : m_widgets)
                 widget->setParent(this);
@@ -193,6 +273,13 @@ namespace tgui
         m_widgets.push_back(widgetPtr);
         m_widgetNames.push_back(widgetName);
 
+        priv::NameIndex* nameIndex = getGuiNameIndex();
+        if (nameIndex)
+            addToNameIndex(*nameIndex, widgetPtr, widgetName);
+
+        if (m_spatialIndex)
+            m_spatialIndex->insert(widgetPtr.get(), m_widgets.size() - 1, widgetPtr->getHitTestBounds());
+
         if (m_fontCached != getGlobalFont())
             widgetPtr->setInheritedFont(m_fontCached);
 
@@ -204,23 +291,20 @@ namespace tgui
 
     Widget::Ptr Container::get(const sf::String& widgetName) const
     {
-        for (std::size_t i = 0; i < m_widgetNames.size(); ++i)
-        {
-            if (m_widgetNames[i] == widgetName)
-                return m_widgets[i];
-        }
+        const Widget::Ptr widget = findWidgetByName(widgetName);
+        if (widget)
+            return widget;
 
-        for (std::size_t i = 0; i < m_widgetNames.size(); ++i)
-        {
-            if (m_widgets[i]->isContainer())
-            {
-                Widget::Ptr widget = std::static_pointer_cast<Container>(m_widgets[i])->get(widgetName);
-                if (widget != nullptr)
-                    return widget;
-            }
-        }
+        // The name may be a path, in which case the rest of the path is searched inside the container with the first name
+        const std::size_t dotPos = widgetName.find(".");
+        if (dotPos == sf::String::InvalidPos)
+            return nullptr;
 
-        return nullptr;
+        const Widget::Ptr container = findWidgetByName(widgetName.substring(0, dotPos));
+        if (!container || !container->isContainer())
+            return nullptr;
+
+        return std::static_pointer_cast<Container>(container)->get(widgetName.substring(dotPos + 1));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -245,6 +329,13 @@ namespace tgui
                     widget->setFocused(false);
                 }
 
+                if (m_spatialIndex)
+                    m_spatialIndex->remove(widget.get());
+
+                priv::NameIndex* nameIndex = getGuiNameIndex();
+                if (nameIndex)
+                    removeFromNameIndex(*nameIndex, widget, m_widgetNames[i]);
+
                 // Remove the widget
                 widget->setParent(nullptr);
                 m_widgets.erase(m_widgets.begin() + i);
@@ -260,12 +351,22 @@ namespace tgui
 
     void Container::removeAllWidgets()
     {
+        priv::NameIndex* nameIndex = getGuiNameIndex();
+        if (nameIndex)
+        {
+            for (std::size_t i = 0; i < m_widgets.size(); ++i)
+                removeFromNameIndex(*nameIndex, m_widgets[i], m_widgetNames[i]);
+        }
+
         for (const auto& widget : m_widgets)
             widget->setParent(nullptr);
 
         m_widgets.clear();
         m_widgetNames.clear();
 
+        if (m_spatialIndex)
+            m_spatialIndex->clear();
+
         m_widgetBelowMouse = nullptr;
         m_focusedWidget = nullptr;
     }
@@ -278,6 +379,13 @@ namespace tgui
         {
             if (m_widgets[i] == widget)
             {
+                priv::NameIndex* nameIndex = getGuiNameIndex();
+                if (nameIndex)
+                {
+                    nameIndex->remove(m_widgetNames[i], widget.get());
+                    nameIndex->insert(name, widget);
+                }
+
                 m_widgetNames[i] = name;
                 return true;
             }
@@ -319,9 +427,8 @@ namespace tgui
         if (!in.is_open())
             throw Exception{"Failed to open '" + filename + "' to load the widgets from it."};
 
-        std::stringstream stream;
-        stream << in.rdbuf();
-        loadWidgetsFromStream(stream);
+        const std::string contents{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+        loadWidgetsFromNodeTree(DataIO::parseWithCache(contents));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -342,8 +449,53 @@ namespace tgui
 
     void Container::loadWidgetsFromStream(std::stringstream& stream)
     {
-        auto rootNode = DataIO::parse(stream);
+        loadWidgetsFromNodeTree(DataIO::parse(stream));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::loadWidgetsFromStream(std::stringstream&& stream)
+    {
+        loadWidgetsFromStream(stream);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::saveWidgetsToStream(std::stringstream& stream) const
+    {
+        DataIO::emit(saveWidgetsToNodeTree(), stream);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::loadWidgetsFromBinary(const std::string& filename)
+    {
+        std::ifstream in{filename, std::ios::binary};
+        if (!in.is_open())
+            throw Exception{"Failed to open '" + filename + "' to load the widgets from it."};
+
+        const std::string contents{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+        loadWidgetsFromNodeTree(DataIO::parseBinary(contents.data(), contents.size()));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::saveWidgetsToBinary(const std::string& filename) const
+    {
+        std::string contents;
+        DataIO::emitBinary(saveWidgetsToNodeTree(), contents);
+
+        std::ofstream out{filename, std::ios::binary};
+        if (!out.is_open())
+            throw Exception{"Failed to open '" + filename + "' for saving the widgets to it."};
+
+        out.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::loadWidgetsFromNodeTree(const std::unique_ptr<DataIO::Node>& rootNode)
+    {
         removeAllWidgets(); // The existing widgets will be replaced by the ones that will be loaded
 
         if (rootNode->propertyValuePairs.size() != 0)
@@ -381,14 +533,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::loadWidgetsFromStream(std::stringstream&& stream)
-    {
-        loadWidgetsFromStream(stream);
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    void Container::saveWidgetsToStream(std::stringstream& stream) const
+    std::unique_ptr<DataIO::Node> Container::saveWidgetsToNodeTree() const
     {
         auto node = make_unique<DataIO::Node>();
 
@@ -417,7 +562,7 @@ namespace tgui
         for (const auto& child : getWidgets())
             node->children.emplace_back(child->save(renderersMap));
 
-        DataIO::emit(node, stream);
+        return node;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -437,6 +582,9 @@ namespace tgui
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + i);
             m_widgetNames.erase(m_widgetNames.begin() + i);
+
+            // The widget may now be drawn on top of or below other widgets
+            widget->invalidate();
             break;
         }
     }
@@ -460,12 +608,70 @@ namespace tgui
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + i + 1);
             m_widgetNames.erase(m_widgetNames.begin() + i + 1);
+
+            // The widget may now be drawn on top of or below other widgets
+            widget->invalidate();
             break;
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::setSpatialIndexEnabled(bool enabled)
+    {
+        if (enabled == isSpatialIndexEnabled())
+            return;
+
+        if (enabled)
+        {
+            m_spatialIndex = make_unique<priv::SpatialIndex>();
+            for (std::size_t i = 0; i < m_widgets.size(); ++i)
+                m_spatialIndex->insert(m_widgets[i].get(), i, m_widgets[i]->getHitTestBounds());
+        }
+        else
+        {
+            m_spatialIndex = nullptr;
+            m_spatialIndexCandidates.clear();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isSpatialIndexEnabled() const
+    {
+        return m_spatialIndex != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setRenderCacheEnabled(bool enabled)
+    {
+        if (enabled == isRenderCacheEnabled())
+            return;
+
+        if (enabled)
+            m_renderCache = make_unique<RenderCache>();
+        else
+            m_renderCache = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isRenderCacheEnabled() const
+    {
+        return m_renderCache != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::invalidateRenderCache()
+    {
+        if (m_renderCache)
+            m_renderCache->valid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::focusNextWidget()
     {
         // If the focused widget is a container then try to focus the next widget inside it
@@ -560,6 +766,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::setVisible(bool visible)
+    {
+        const bool wasVisible = isVisible();
+
+        Widget::setVisible(visible);
+
+        // The child widgets didn't receive time while the container was hidden, so they may have been waiting for it
+        if (visible && !wasVisible)
+        {
+            Container* root = this;
+            while (root->getParent())
+                root = root->getParent();
+
+            GuiContainer* gui = dynamic_cast<GuiContainer*>(root);
+            if (gui)
+                scheduleUpdates(*gui, this);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::childWidgetFocused(const Widget::Ptr& child)
     {
         if (m_focusedWidget != child)
@@ -576,6 +803,135 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::childWidgetBoundsChanged(const Widget* child)
+    {
+        if (m_spatialIndex)
+            m_spatialIndex->update(child, child->getHitTestBounds());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    priv::NameIndex* Container::getGuiNameIndex() const
+    {
+        Container* root = const_cast<Container*>(this);
+        while (root->getParent())
+            root = root->getParent();
+
+        GuiContainer* gui = dynamic_cast<GuiContainer*>(root);
+        if (gui)
+            return &gui->getNameIndex();
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::addToNameIndex(priv::NameIndex& nameIndex, const Widget::Ptr& widget, const sf::String& widgetName)
+    {
+        nameIndex.insert(widgetName, widget);
+
+        if (widget->isContainer())
+        {
+            const auto& container = static_cast<const Container&>(*widget);
+            for (std::size_t i = 0; i < container.m_widgets.size(); ++i)
+                addToNameIndex(nameIndex, container.m_widgets[i], container.m_widgetNames[i]);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::removeFromNameIndex(priv::NameIndex& nameIndex, const Widget::Ptr& widget, const sf::String& widgetName)
+    {
+        nameIndex.remove(widgetName, widget.get());
+
+        if (widget->isContainer())
+        {
+            const auto& container = static_cast<const Container&>(*widget);
+            for (std::size_t i = 0; i < container.m_widgets.size(); ++i)
+                removeFromNameIndex(nameIndex, container.m_widgets[i], container.m_widgetNames[i]);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr Container::findWidgetByName(const sf::String& widgetName) const
+    {
+        // Unnamed widgets aren't stored in the name index
+        const priv::NameIndex* nameIndex = widgetName.isEmpty() ? nullptr : getGuiNameIndex();
+        if (!nameIndex)
+        {
+            for (std::size_t i = 0; i < m_widgetNames.size(); ++i)
+            {
+                if (m_widgetNames[i] == widgetName)
+                    return m_widgets[i];
+            }
+
+            for (std::size_t i = 0; i < m_widgetNames.size(); ++i)
+            {
+                if (m_widgets[i]->isContainer())
+                {
+                    Widget::Ptr widget = std::static_pointer_cast<Container>(m_widgets[i])->findWidgetByName(widgetName);
+                    if (widget != nullptr)
+                        return widget;
+                }
+            }
+
+            return nullptr;
+        }
+
+        const auto* indexedWidgets = nameIndex->find(widgetName);
+        if (!indexedWidgets)
+            return nullptr;
+
+        // The index contains the widgets with this name in the entire gui, only the ones inside this container can be returned
+        std::vector<Widget::Ptr> candidates;
+        for (const auto& weakWidget : *indexedWidgets)
+        {
+            Widget::Ptr widget = weakWidget.lock();
+            if (widget && isInsideContainer(*widget, *this))
+                candidates.push_back(std::move(widget));
+        }
+
+        if (candidates.empty())
+            return nullptr;
+        if (candidates.size() == 1)
+            return candidates[0];
+
+        // When multiple widgets have the same name, return the one that a recursive search would have found first
+        std::size_t bestIndex = 0;
+        std::vector<std::size_t> bestPath = getPathInsideContainer(*candidates[0], *this);
+        for (std::size_t i = 1; i < candidates.size(); ++i)
+        {
+            std::vector<std::size_t> path = getPathInsideContainer(*candidates[i], *this);
+            if (isFoundBefore(path, bestPath))
+            {
+                bestIndex = i;
+                bestPath = std::move(path);
+            }
+        }
+
+        return candidates[bestIndex];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setParent(Container* parent)
+    {
+        Widget::setParent(parent);
+
+        // Widgets only receive time while they are part of the gui, so the child widgets that were animating while the
+        // container wasn't part of the gui would otherwise never continue
+        Container* root = parent;
+        while (root && root->getParent())
+            root = root->getParent();
+
+        GuiContainer* gui = dynamic_cast<GuiContainer*>(root);
+        if (gui)
+            scheduleUpdates(*gui, this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::leftMousePressed(Vector2f pos)
     {
         sf::Event event;
@@ -697,7 +1053,7 @@ namespace tgui
                     return toolTip;
             }
 
-            if (m_toolTip)
+            if (m_sideStorage && m_sideStorage->toolTip)
                 return getToolTip();
         }
 
@@ -708,14 +1064,16 @@ namespace tgui
 
     void Container::rendererChanged(const std::string& property)
     {
+        const priv::PropertyId id = priv::makePropertyId(property);
+
         Widget::rendererChanged(property);
 
-        if (property == "opacity")
+        if (id == priv::makePropertyId("opacity"))
         {
             for (std::size_t i = 0; i < m_widgets.size(); ++i)
                 m_widgets[i]->setInheritedOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (id == priv::makePropertyId("font"))
         {
             for (const auto& widget : m_widgets)
             {
@@ -766,23 +1124,6 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::update(sf::Time elapsedTime)
-    {
-        Widget::update(elapsedTime);
-
-        // Loop through all widgets
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
-        {
-            // Update the elapsed time in widgets that need it
-            if (m_widgets[i]->isVisible())
-                m_widgets[i]->update(elapsedTime);
-        }
-
-        m_animationTimeElapsed = {};
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
     bool Container::handleEvent(sf::Event& event)
     {
         // Check if a mouse button has moved
@@ -803,6 +1144,7 @@ namespace tgui
                     // Some widgets should always receive mouse move events while dragging them, even if the mouse is no longer on top of them.
                     if (widget->m_draggableWidget || widget->isContainer())
                     {
+                        widget->invalidate();
                         widget->mouseMoved(mousePos);
                         return true;
                     }
@@ -813,6 +1155,10 @@ namespace tgui
             Widget::Ptr widget = mouseOnWhichWidget(mousePos);
             if (widget != nullptr)
             {
+                // A container only changes when the mouse enters or leaves it, its child widgets are marked when needed
+                if (!widget->isContainer())
+                    widget->invalidate();
+
                 // Send the event to the widget
                 widget->mouseMoved(mousePos);
                 return true;
@@ -843,6 +1189,7 @@ namespace tgui
                 if (!widget->isContainer())
                     widget->setFocused(true);
 
+                widget->invalidate();
                 if (((event.type == sf::Event::MouseButtonPressed) && (event.mouseButton.button == sf::Mouse::Left))
                  || ((event.type == sf::Event::TouchBegan) && (event.touch.finger == 0)))
                 {
@@ -880,7 +1227,10 @@ namespace tgui
             // Check if the mouse is on top of a widget
             Widget::Ptr widgetBelowMouse = mouseOnWhichWidget(mousePos);
             if (widgetBelowMouse != nullptr)
+            {
+                widgetBelowMouse->invalidate();
                 widgetBelowMouse->leftMouseReleased(mousePos);
+            }
 
             // Tell all widgets that the mouse has gone up
             // But don't do this when leftMouseReleased was called on this container because
@@ -888,7 +1238,12 @@ namespace tgui
             if (!m_handingMouseReleased)
             {
                 for (auto& widget : m_widgets)
+                {
+                    if (widget->m_mouseDown)
+                        widget->invalidate();
+
                     widget->mouseNoLongerDown();
+                }
             }
 
             if (widgetBelowMouse != nullptr)
@@ -913,6 +1268,9 @@ namespace tgui
                 #endif
 
                     // Tell the widget that the key was pressed
+                    if (!m_focusedWidget->isContainer())
+                        m_focusedWidget->invalidate();
+
                     m_focusedWidget->keyPressed(event.key);
                     return true;
                 }
@@ -930,6 +1288,9 @@ namespace tgui
                 // Tell the widget that the key was pressed
                 if (m_focusedWidget && m_focusedWidget->isFocused())
                 {
+                    if (!m_focusedWidget->isContainer())
+                        m_focusedWidget->invalidate();
+
                     m_focusedWidget->textEntered(event.text.unicode);
                     return true;
                 }
@@ -946,6 +1307,7 @@ namespace tgui
             if (widget != nullptr)
             {
                 // Send the event to the widget
+                widget->invalidate();
                 widget->mouseWheelScrolled(event.mouseWheelScroll.delta, {static_cast<float>(event.mouseWheelScroll.x), static_cast<float>(event.mouseWheelScroll.y)});
                 return true;
             }
@@ -961,16 +1323,52 @@ namespace tgui
     Widget::Ptr Container::mouseOnWhichWidget(Vector2f mousePos)
     {
         Widget::Ptr widget = nullptr;
-        for (auto it = m_widgets.rbegin(); it != m_widgets.rend(); ++it)
+        if (m_spatialIndex)
         {
-            if ((*it)->isVisible())
+            m_spatialIndex->query(mousePos, m_spatialIndexCandidates);
+
+            // The index in m_widgets that is stored for each widget is outdated when widgets were removed or reordered
+            const bool orderOutdated = std::any_of(m_spatialIndexCandidates.begin(), m_spatialIndexCandidates.end(),
+                [this](const std::pair<std::size_t, const Widget*>& candidate){
+                    return (candidate.first >= m_widgets.size()) || (m_widgets[candidate.first].get() != candidate.second);
+                });
+
+            if (orderOutdated)
+            {
+                for (std::size_t i = 0; i < m_widgets.size(); ++i)
+                    m_spatialIndex->setOrder(m_widgets[i].get(), i);
+
+                m_spatialIndex->query(mousePos, m_spatialIndexCandidates);
+            }
+
+            for (const auto& candidate : m_spatialIndexCandidates)
+            {
+                const auto& child = m_widgets[candidate.first];
+                if (child->isVisible())
+                {
+                    if (child->mouseOnWidget(mousePos))
+                    {
+                        if (child->isEnabled())
+                            widget = child;
+
+                        break;
+                    }
+                }
+            }
+        }
+        else
+        {
+            for (auto it = m_widgets.rbegin(); it != m_widgets.rend(); ++it)
             {
-                if ((*it)->mouseOnWidget(mousePos))
+                if ((*it)->isVisible())
                 {
-                    if ((*it)->isEnabled())
-                        widget = *it;
+                    if ((*it)->mouseOnWidget(mousePos))
+                    {
+                        if ((*it)->isEnabled())
+                            widget = *it;
 
-                    break;
+                        break;
+                    }
                 }
             }
         }
@@ -987,12 +1385,98 @@ namespace tgui
 
     void Container::drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states) const
     {
+        if (m_renderCache && drawRenderCache(*target, states))
+            return;
+
         // Draw all widgets when they are visible
         for (const auto& widget : m_widgets)
         {
             if (widget->isVisible())
+            {
+                priv::BatchRenderer::OpacityScope opacityScope{widget->getAnimatedOpacity()};
                 widget->draw(*target, states);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::drawRenderCache(sf::RenderTarget& target, const sf::RenderStates& states) const
+    {
+        // Nothing has to be drawn while the container is completely faded out
+        const float opacity = priv::BatchRenderer::getDrawOpacity();
+        if (opacity <= 0)
+            return true;
+
+        const Vector2f size = getRenderCacheSize();
+        const sf::Vector2u textureSize{static_cast<unsigned int>(std::max(1.f, std::ceil(size.x))),
+                                       static_cast<unsigned int>(std::max(1.f, std::ceil(size.y)))};
+
+        sf::RenderTexture& texture = m_renderCache->texture;
+        if (texture.getSize() != textureSize)
+        {
+            if (!texture.create(textureSize.x, textureSize.y))
+            {
+                TGUI_PRINT_WARNING("failed to create texture for the render cache, the widgets will be drawn directly instead.");
+                m_renderCache = nullptr;
+                return false;
+            }
+
+            m_renderCache->valid = false;
+        }
+
+        // The opacity of the parents is applied when drawing the texture, so the widgets inside it shouldn't be faded as well
+        const priv::BatchRenderer::OpacityScope opacityScope{1, false};
+
+        if (!m_renderCache->valid)
+        {
+            const sf::View view{{0, 0, static_cast<float>(textureSize.x), static_cast<float>(textureSize.y)}};
+            texture.setView(view);
+            texture.clear(sf::Color::Transparent);
+
+            // Clipping inside the child widgets has to be calculated relative to the texture instead of to the gui view
+            const sf::View oldGuiView = Clipping::getGuiView();
+            Clipping::setGuiView(view);
+
+            m_renderCache->batchRenderer.begin(texture);
+            for (const auto& widget : m_widgets)
+            {
+                if (widget->isVisible())
+                {
+                    priv::BatchRenderer::OpacityScope widgetOpacityScope{widget->getAnimatedOpacity()};
+                    widget->draw(texture, sf::RenderStates::Default);
+                }
+            }
+            m_renderCache->batchRenderer.end();
+
+            Clipping::setGuiView(oldGuiView);
+            texture.display();
+            m_renderCache->valid = true;
         }
+
+        // The colors in the texture are premultiplied with their alpha because the texture was cleared with a transparent color
+        const sf::Uint8 alpha = static_cast<sf::Uint8>(opacity * 255);
+        const sf::Color color{alpha, alpha, alpha, alpha};
+        const sf::Vector2f textureEnd{static_cast<float>(textureSize.x), static_cast<float>(textureSize.y)};
+        const sf::Vertex vertices[] = {
+            {{0, 0}, color, {0, 0}},
+            {{textureEnd.x, 0}, color, {textureEnd.x, 0}},
+            {{0, textureEnd.y}, color, {0, textureEnd.y}},
+            {textureEnd, color, textureEnd}
+        };
+
+        sf::RenderStates textureStates = states;
+        textureStates.texture = &texture.getTexture();
+        textureStates.blendMode = sf::BlendMode{sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha};
+        priv::BatchRenderer::draw(target, vertices, 4, sf::PrimitiveType::TrianglesStrip, textureStates);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2f Container::getRenderCacheSize() const
+    {
+        return getSize();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1048,6 +1532,7 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     GuiContainer::GuiContainer()
@@ -1080,6 +1565,49 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void GuiContainer::scheduleWidgetUpdate(Widget& widget, sf::Time delay)
+    {
+        m_updateScheduler.schedule(widget, delay);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::invalidateRegion(const FloatRect& region)
+    {
+        if ((region.width <= 0) || (region.height <= 0))
+            return;
+
+        if (!m_dirty)
+        {
+            m_dirtyRegion = region;
+            m_dirty = true;
+            return;
+        }
+
+        // Keep a single rectangle that contains all changed areas
+        const float left = std::min(m_dirtyRegion.left, region.left);
+        const float top = std::min(m_dirtyRegion.top, region.top);
+        const float right = std::max(m_dirtyRegion.left + m_dirtyRegion.width, region.left + region.width);
+        const float bottom = std::max(m_dirtyRegion.top + m_dirtyRegion.height, region.top + region.height);
+        m_dirtyRegion = {left, top, right - left, bottom - top};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::drawRegion(sf::RenderTarget& target, const FloatRect& region) const
+    {
+        for (const auto& widget : m_widgets)
+        {
+            if (widget->isVisible() && widget->getHitTestBounds().intersects(region))
+            {
+                priv::BatchRenderer::OpacityScope opacityScope{widget->getAnimatedOpacity()};
+                widget->draw(target, sf::RenderStates::Default);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void GuiContainer::draw(sf::RenderTarget&, sf::RenderStates) const
     {
     }
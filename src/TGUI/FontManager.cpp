@@ -0,0 +1,102 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/FontManager.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    std::unordered_map<std::string, std::weak_ptr<sf::Font>> FontManager::m_fonts;
+    std::size_t FontManager::m_loadCount = 0;
+    std::size_t FontManager::m_reuseCount = 0;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<sf::Font> FontManager::getFont(const std::string& filename)
+    {
+        // Reuse the font when it is still alive
+        const auto it = m_fonts.find(filename);
+        if (it != m_fonts.end())
+        {
+            auto font = it->second.lock();
+            if (font)
+            {
+                ++m_reuseCount;
+                return font;
+            }
+
+            m_fonts.erase(it);
+        }
+
+        ++m_loadCount;
+        auto font = std::make_shared<sf::Font>();
+        if (font->loadFromFile(filename))
+            m_fonts[filename] = font;
+
+        return font;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FontManager::flushCache(const std::string& filename)
+    {
+        if (filename != "")
+            m_fonts.erase(filename);
+        else
+        {
+            m_fonts.clear();
+            m_loadCount = 0;
+            m_reuseCount = 0;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FontManager::Statistics FontManager::getStatistics()
+    {
+        Statistics statistics;
+        for (auto it = m_fonts.begin(); it != m_fonts.end();)
+        {
+            // Fonts that are no longer used are removed from the cache
+            if (it->second.expired())
+                it = m_fonts.erase(it);
+            else
+            {
+                ++statistics.fontCount;
+                ++it;
+            }
+        }
+
+        statistics.loadCount = m_loadCount;
+        statistics.reuseCount = m_reuseCount;
+        return statistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
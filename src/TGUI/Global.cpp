@@ -41,6 +41,7 @@ namespace tgui
         unsigned int globalTextSize = 13;
         unsigned int globalDoubleClickTime = 500;
         std::string globalResourcePath = "";
+        std::string globalBinaryCachePath = "";
         Font globalFont = nullptr;
     }
 
@@ -118,6 +119,26 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void setBinaryCachePath(const std::string& path)
+    {
+        globalBinaryCachePath = path;
+
+        if (!globalBinaryCachePath.empty())
+        {
+            if (globalBinaryCachePath[globalBinaryCachePath.length()-1] != '/')
+                globalBinaryCachePath.push_back('/');
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::string& getBinaryCachePath()
+    {
+        return globalBinaryCachePath;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool compareFloats(float x, float y)
     {
         return (std::abs(x - y) < 0.0000001f);
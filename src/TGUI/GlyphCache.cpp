@@ -0,0 +1,160 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/GlyphCache.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        namespace
+        {
+            struct FontCaches
+            {
+                std::weak_ptr<sf::Font> font;
+                std::unordered_map<std::uint64_t, std::unique_ptr<GlyphCache>> caches;
+            };
+
+            std::unordered_map<const sf::Font*, FontCaches> fontCaches;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        GlyphCache& GlyphCache::get(const std::shared_ptr<sf::Font>& font, unsigned int characterSize, bool bold)
+        {
+            auto fontIt = fontCaches.find(font.get());
+            if (fontIt == fontCaches.end())
+            {
+                // Forget about the fonts that no longer exist
+                for (auto it = fontCaches.begin(); it != fontCaches.end();)
+                {
+                    if (it->second.font.expired())
+                        it = fontCaches.erase(it);
+                    else
+                        ++it;
+                }
+
+                fontIt = fontCaches.insert({font.get(), FontCaches{}}).first;
+                fontIt->second.font = font;
+            }
+            else if (fontIt->second.font.expired())
+            {
+                // The font was destroyed and a new one was created at the same address
+                fontIt->second.caches.clear();
+                fontIt->second.font = font;
+            }
+
+            auto& cache = fontIt->second.caches[(std::uint64_t{characterSize} << 1) | (bold ? 1 : 0)];
+            if (!cache)
+                cache = std::unique_ptr<GlyphCache>(new GlyphCache(*font, characterSize, bold));
+
+            return *cache;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void GlyphCache::invalidate(const sf::Font* font)
+        {
+            fontCaches.erase(font);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void GlyphCache::clear()
+        {
+            fontCaches.clear();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t GlyphCache::getFontCount()
+        {
+            return fontCaches.size();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        GlyphCache::GlyphCache(const sf::Font& font, unsigned int characterSize, bool bold) :
+            m_font         (font),
+            m_characterSize(characterSize),
+            m_bold         (bold)
+        {
+            m_latinAdvances.fill(-1);
+
+            // Calculate the height of the first line (char size = everything above baseline, height + top = part below baseline)
+            const sf::Glyph& glyph = font.getGlyph('g', characterSize, bold);
+            m_lineSpacing = font.getLineSpacing(characterSize);
+            m_extraVerticalSpace = characterSize + glyph.bounds.height + glyph.bounds.top - m_lineSpacing;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float GlyphCache::getKerning(std::uint32_t first, std::uint32_t second)
+        {
+            // There is no kerning at the start of a line
+            if (first == 0)
+                return 0;
+
+            const std::uint64_t key = (std::uint64_t{first} << 32) | second;
+            const auto it = m_kernings.find(key);
+            if (it != m_kernings.end())
+                return it->second;
+
+            const float kerning = static_cast<float>(m_font.getKerning(first, second, m_characterSize));
+            m_kernings.insert({key, kerning});
+            return kerning;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float GlyphCache::loadAdvance(std::uint32_t codePoint) const
+        {
+            if (codePoint == '\t')
+                return static_cast<float>(m_font.getGlyph(' ', m_characterSize, m_bold).advance) * 4;
+            else
+                return static_cast<float>(m_font.getGlyph(codePoint, m_characterSize, m_bold).advance);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float GlyphCache::getNonLatinAdvance(std::uint32_t codePoint)
+        {
+            const auto it = m_advances.find(codePoint);
+            if (it != m_advances.end())
+                return it->second;
+
+            const float advance = loadAdvance(codePoint);
+            m_advances.insert({codePoint, advance});
+            return advance;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,11 +25,15 @@
 #include <TGUI/Gui.hpp>
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/ToolTip.hpp>
+#include <TGUI/LayoutScheduler.hpp>
 #include <TGUI/Clipping.hpp>
 
 #include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/Sprite.hpp>
 
 #include <cassert>
+#include <limits>
 
 #ifdef SFML_SYSTEM_WINDOWS
     #define NOMB
@@ -45,6 +49,17 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    namespace
+    {
+        FloatRect getViewArea(const sf::View& view)
+        {
+            return {view.getCenter().x - (view.getSize().x / 2.f), view.getCenter().y - (view.getSize().y / 2.f),
+                    view.getSize().x, view.getSize().y};
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Gui::Gui() :
     #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
         m_target(nullptr)
@@ -131,12 +146,13 @@ namespace tgui
             m_container->m_size = view.getSize();
             m_container->onSizeChange.emit(m_container.get(), m_container->getSize());
 
-            for (auto& layout : m_container->m_boundSizeLayouts)
-                layout->recalculateValue();
+            LayoutScheduler::widgetResized(m_container.get());
         }
         else // Set it anyway in case something changed that we didn't care to check
             m_view = view;
 
+        m_container->invalidateRegion(getViewArea(m_view));
+
         Clipping::setGuiView(m_view);
     }
 
@@ -153,6 +169,9 @@ namespace tgui
     {
         assert(m_target != nullptr);
 
+        // Widgets must be at their correct position before finding out which widget is below the mouse
+        LayoutScheduler::update();
+
         // Check if the event has something to do with the mouse
         if ((event.type == sf::Event::MouseMoved) || (event.type == sf::Event::TouchMoved)
          || (event.type == sf::Event::MouseButtonPressed) || (event.type == sf::Event::TouchBegan)
@@ -282,15 +301,83 @@ namespace tgui
         else
             m_clock.restart();
 
-        // Change the view
-        const sf::View oldView = m_target->getView();
-        m_target->setView(m_view);
+        // Recalculate the layouts that were changed since the last frame, in case their updates are deferred
+        LayoutScheduler::update();
 
-        // Draw the widgets
-        m_container->drawWidgetContainer(m_target, sf::RenderStates::Default);
+        if (!m_partialRedrawEnabled || !drawDirtyRegion())
+        {
+            // Change the view
+            const sf::View oldView = m_target->getView();
+            m_target->setView(m_view);
 
-        // Restore the old view
-        m_target->setView(oldView);
+            // Draw the widgets
+            m_batchRenderer.begin(*m_target);
+            m_container->drawWidgetContainer(m_target, sf::RenderStates::Default);
+            m_batchRenderer.end();
+
+            // Restore the old view
+            m_target->setView(oldView);
+        }
+
+        // Everything that changed is now visible on the screen
+        m_container->m_dirty = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setDrawBatchingEnabled(bool enabled)
+    {
+        m_batchRenderer.setEnabled(enabled);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isDrawBatchingEnabled() const
+    {
+        return m_batchRenderer.isEnabled();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Gui::getDrawCallCount() const
+    {
+        return m_batchRenderer.getDrawCallCount();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setPartialRedrawEnabled(bool enabled)
+    {
+        m_partialRedrawEnabled = enabled;
+
+        // The texture would no longer be up-to-date when partial redrawing gets enabled again
+        m_redrawTexture = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isPartialRedrawEnabled() const
+    {
+        return m_partialRedrawEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isDirty() const
+    {
+        return m_container->m_dirty;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect Gui::getDirtyRegion() const
+    {
+        // Changes outside the view don't have to be redrawn
+        FloatRect region;
+        if (!m_container->m_dirty || !m_container->m_dirtyRegion.intersects(getViewArea(m_view), region))
+            return {};
+
+        return region;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -449,10 +536,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::loadWidgetsFromBinary(const std::string& filename)
+    {
+        m_container->loadWidgetsFromBinary(filename);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::saveWidgetsToBinary(const std::string& filename) const
+    {
+        m_container->saveWidgetsToBinary(filename);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::updateTime(const sf::Time& elapsedTime)
     {
-        m_container->m_animationTimeElapsed = elapsedTime;
-        m_container->update(elapsedTime);
+        m_container->m_updateScheduler.update(elapsedTime, *m_container);
 
         if (m_tooltipPossible)
         {
@@ -476,6 +576,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::Time Gui::getNextWakeupTime() const
+    {
+        sf::Time time = sf::microseconds(std::numeric_limits<sf::Int64>::max());
+        m_container->m_updateScheduler.getTimeUntilNextUpdate(time);
+
+        if (m_tooltipPossible)
+        {
+            const sf::Time timeUntilToolTip = (m_tooltipTime < ToolTip::getTimeToDisplay()) ? (ToolTip::getTimeToDisplay() - m_tooltipTime) : sf::Time::Zero;
+            if (timeUntilToolTip < time)
+                time = timeUntilToolTip;
+        }
+
+        return time;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::init()
     {
     #ifdef SFML_SYSTEM_WINDOWS
@@ -486,6 +603,62 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::drawDirtyRegion()
+    {
+        const sf::Vector2u targetSize = m_target->getSize();
+        if (!m_redrawTexture || (m_redrawTexture->getSize() != targetSize))
+        {
+            m_redrawTexture = make_unique<sf::RenderTexture>();
+            if (!m_redrawTexture->create(targetSize.x, targetSize.y))
+            {
+                TGUI_PRINT_WARNING("failed to create texture for partial redrawing, all widgets will be drawn instead.");
+                m_redrawTexture = nullptr;
+                m_partialRedrawEnabled = false;
+                return false;
+            }
+
+            // Nothing has been drawn on the new texture yet
+            m_redrawTexture->clear(sf::Color::Transparent);
+            m_container->invalidateRegion(getViewArea(m_view));
+        }
+
+        FloatRect region = getDirtyRegion();
+        if ((region.width > 0) && (region.height > 0))
+        {
+            // Extend the region to whole pixels so that no pixel that is partially covered by a change is left behind
+            const sf::Vector2i topLeftPixel = m_redrawTexture->mapCoordsToPixel({region.left, region.top}, m_view) - sf::Vector2i{1, 1};
+            const sf::Vector2i bottomRightPixel = m_redrawTexture->mapCoordsToPixel({region.left + region.width, region.top + region.height}, m_view) + sf::Vector2i{1, 1};
+            const sf::Vector2f topLeft = m_redrawTexture->mapPixelToCoords(topLeftPixel, m_view);
+            const sf::Vector2f bottomRight = m_redrawTexture->mapPixelToCoords(bottomRightPixel, m_view);
+            region = {topLeft.x, topLeft.y, bottomRight.x - topLeft.x, bottomRight.y - topLeft.y};
+
+            m_redrawTexture->setView(m_view);
+            {
+                const Clipping clipping{*m_redrawTexture, {}, region.getPosition(), region.getSize()};
+
+                // Erase what was previously drawn in the region
+                sf::RectangleShape eraser{region.getSize()};
+                eraser.setPosition(region.getPosition());
+                eraser.setFillColor(sf::Color::Transparent);
+                m_redrawTexture->draw(eraser, sf::BlendNone);
+
+                m_batchRenderer.begin(*m_redrawTexture);
+                m_container->drawRegion(*m_redrawTexture, region);
+                m_batchRenderer.end();
+            }
+            m_redrawTexture->display();
+        }
+
+        // The colors in the texture are premultiplied with their alpha because the texture was cleared with a transparent color
+        const sf::View oldView = m_target->getView();
+        m_target->setView(m_target->getDefaultView());
+        m_target->draw(sf::Sprite{m_redrawTexture->getTexture()}, sf::BlendMode{sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha});
+        m_target->setView(oldView);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
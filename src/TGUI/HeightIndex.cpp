@@ -0,0 +1,247 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/HeightIndex.hpp>
+
+#include <cassert>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t HeightIndex::getSize() const
+        {
+            return m_size;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void HeightIndex::clear()
+        {
+            m_heights.clear();
+            m_tree.clear();
+            m_head = 0;
+            m_size = 0;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void HeightIndex::pushBack(float height)
+        {
+            if (m_size == m_heights.size())
+                rebuild(m_heights.empty() ? 16 : m_heights.size() * 2);
+
+            ++m_size;
+            setHeight(m_size - 1, height);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void HeightIndex::pushFront(float height)
+        {
+            if (m_size == m_heights.size())
+                rebuild(m_heights.empty() ? 16 : m_heights.size() * 2);
+
+            m_head = (m_head + m_heights.size() - 1) & (m_heights.size() - 1);
+            ++m_size;
+            setHeight(0, height);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void HeightIndex::popBack()
+        {
+            assert(m_size > 0);
+
+            setHeight(m_size - 1, 0);
+            --m_size;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void HeightIndex::popFront()
+        {
+            assert(m_size > 0);
+
+            setHeight(0, 0);
+            m_head = getSlot(1);
+            --m_size;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void HeightIndex::erase(std::size_t index)
+        {
+            assert(index < m_size);
+
+            if (index == 0)
+                popFront();
+            else if (index == m_size - 1)
+                popBack();
+            else
+            {
+                // Move the items below the removed one up by one slot and rebuild the tree
+                for (std::size_t i = index; i + 1 < m_size; ++i)
+                    m_heights[getSlot(i)] = m_heights[getSlot(i + 1)];
+
+                m_heights[getSlot(m_size - 1)] = 0;
+                --m_size;
+                rebuild(m_heights.size());
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void HeightIndex::setHeight(std::size_t index, float height)
+        {
+            assert(index < m_size);
+
+            const std::size_t slot = getSlot(index);
+            addToSlot(slot, static_cast<double>(height) - m_heights[slot]);
+            m_heights[slot] = height;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float HeightIndex::getHeight(std::size_t index) const
+        {
+            assert(index < m_size);
+            return m_heights[getSlot(index)];
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float HeightIndex::getOffset(std::size_t index) const
+        {
+            assert(index <= m_size);
+            if (index == 0)
+                return 0;
+
+            if (m_head + index <= m_heights.size())
+                return static_cast<float>(getSlotSum(m_head + index) - getSlotSum(m_head));
+            else // The items wrap around the end of the ring buffer
+                return static_cast<float>(getSlotSum(m_heights.size()) - getSlotSum(m_head) + getSlotSum(m_head + index - m_heights.size()));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float HeightIndex::getTotalHeight() const
+        {
+            return getOffset(m_size);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t HeightIndex::findIndex(float offset) const
+        {
+            if ((m_size == 0) || (offset < 0))
+                return 0;
+
+            if (offset >= getTotalHeight())
+                return m_size;
+
+            // Search in the part of the ring buffer behind the head first and continue at the start of the buffer when needed
+            std::size_t index;
+            const double headSum = getSlotSum(m_head);
+            const double sumUntilBufferEnd = getSlotSum(m_heights.size()) - headSum;
+            if (offset < sumUntilBufferEnd)
+                index = findSlot(headSum + offset) - m_head;
+            else
+                index = (m_heights.size() - m_head) + findSlot(offset - sumUntilBufferEnd);
+
+            // Rounding errors could cause the index to point just past the last item
+            return (index < m_size) ? index : m_size - 1;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        double HeightIndex::getSlotSum(std::size_t slotEnd) const
+        {
+            double sum = 0;
+            for (std::size_t i = slotEnd; i > 0; i -= (i & (~i + 1)))
+                sum += m_tree[i];
+
+            return sum;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t HeightIndex::findSlot(double sum) const
+        {
+            std::size_t slot = 0;
+            for (std::size_t step = m_heights.size(); step > 0; step /= 2)
+            {
+                if ((slot + step <= m_heights.size()) && (m_tree[slot + step] <= sum))
+                {
+                    slot += step;
+                    sum -= m_tree[slot];
+                }
+            }
+
+            return slot;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void HeightIndex::addToSlot(std::size_t slot, double height)
+        {
+            for (std::size_t i = slot + 1; i < m_tree.size(); i += (i & (~i + 1)))
+                m_tree[i] += height;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void HeightIndex::rebuild(std::size_t capacity)
+        {
+            // Place the items at the start of the new ring buffer
+            std::vector<float> heights(capacity, 0);
+            for (std::size_t i = 0; i < m_size; ++i)
+                heights[i] = m_heights[getSlot(i)];
+
+            m_heights = std::move(heights);
+            m_head = 0;
+
+            // Build the tree in linear time by passing each sum to its parent
+            m_tree.assign(capacity + 1, 0);
+            for (std::size_t i = 1; i <= capacity; ++i)
+            {
+                m_tree[i] += m_heights[i - 1];
+
+                const std::size_t parent = i + (i & (~i + 1));
+                if (parent <= capacity)
+                    m_tree[parent] += m_tree[i];
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,862 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+#include <TGUI/InputValidator.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        namespace
+        {
+            using Ranges = std::vector<std::pair<std::uint32_t, std::uint32_t>>;
+
+            const std::uint32_t maxCharacter = 0xFFFFFFFF;
+
+            // Limits above which the pattern is left to std::regex instead
+            const unsigned int maxRepetitions = 1000;
+            const std::size_t maxNfaStates = 4096;
+            const std::size_t maxDfaStates = 1024;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            // Sorts the ranges and merges the ones that overlap or touch
+            void normalizeRanges(Ranges& ranges)
+            {
+                std::sort(ranges.begin(), ranges.end());
+
+                Ranges merged;
+                for (const auto& range : ranges)
+                {
+                    if (!merged.empty() && ((merged.back().second == maxCharacter) || (range.first <= merged.back().second + 1)))
+                        merged.back().second = std::max(merged.back().second, range.second);
+                    else
+                        merged.push_back(range);
+                }
+
+                ranges = std::move(merged);
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            Ranges invertRanges(Ranges ranges)
+            {
+                normalizeRanges(ranges);
+
+                Ranges inverted;
+                std::uint32_t start = 0;
+                for (const auto& range : ranges)
+                {
+                    if (range.first > start)
+                        inverted.push_back({start, range.first - 1});
+
+                    if (range.second == maxCharacter)
+                        return inverted;
+
+                    start = range.second + 1;
+                }
+
+                inverted.push_back({start, maxCharacter});
+                return inverted;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            bool rangesContain(const Ranges& ranges, std::uint32_t character)
+            {
+                for (const auto& range : ranges)
+                {
+                    if ((character >= range.first) && (character <= range.second))
+                        return true;
+                }
+
+                return false;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            struct RegexNode
+            {
+                enum class Type
+                {
+                    Empty,
+                    Set,
+                    Concatenation,
+                    Alternation,
+                    Repetition
+                };
+
+                Type type = Type::Empty;
+                Ranges ranges;
+                std::vector<std::size_t> children;
+                unsigned int min = 0;
+                unsigned int max = 0; // Only used when not infinite
+                bool infinite = false;
+            };
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            // Parses the subset of the ECMAScript syntax that can be turned into a DFA.
+            // Every function returns false when the pattern uses something else or is invalid.
+            class PatternParser
+            {
+            public:
+
+                PatternParser(const std::string& pattern, std::vector<RegexNode>& nodes) :
+                    m_pattern(pattern),
+                    m_nodes(nodes)
+                {
+                }
+
+                bool parse(std::size_t& root)
+                {
+                    return parseAlternation(root) && (m_pos == m_pattern.length());
+                }
+
+            private:
+
+                std::size_t addNode(RegexNode::Type type)
+                {
+                    m_nodes.emplace_back();
+                    m_nodes.back().type = type;
+                    return m_nodes.size() - 1;
+                }
+
+                bool parseAlternation(std::size_t& result)
+                {
+                    std::size_t branch;
+                    if (!parseConcatenation(branch))
+                        return false;
+
+                    if ((m_pos == m_pattern.length()) || (m_pattern[m_pos] != '|'))
+                    {
+                        result = branch;
+                        return true;
+                    }
+
+                    result = addNode(RegexNode::Type::Alternation);
+                    m_nodes[result].children.push_back(branch);
+                    while ((m_pos < m_pattern.length()) && (m_pattern[m_pos] == '|'))
+                    {
+                        ++m_pos;
+                        if (!parseConcatenation(branch))
+                            return false;
+
+                        m_nodes[result].children.push_back(branch);
+                    }
+
+                    return true;
+                }
+
+                bool parseConcatenation(std::size_t& result)
+                {
+                    result = addNode(RegexNode::Type::Concatenation);
+                    while ((m_pos < m_pattern.length()) && (m_pattern[m_pos] != '|') && (m_pattern[m_pos] != ')'))
+                    {
+                        std::size_t child;
+                        if (!parseRepetition(child))
+                            return false;
+
+                        m_nodes[result].children.push_back(child);
+                    }
+
+                    return true;
+                }
+
+                bool parseRepetition(std::size_t& result)
+                {
+                    std::size_t atom;
+                    if (!parseAtom(atom))
+                        return false;
+
+                    if (m_pos == m_pattern.length())
+                    {
+                        result = atom;
+                        return true;
+                    }
+
+                    unsigned int min = 0;
+                    unsigned int max = 0;
+                    bool infinite = false;
+                    switch (m_pattern[m_pos])
+                    {
+                    case '*':
+                        infinite = true;
+                        ++m_pos;
+                        break;
+                    case '+':
+                        min = 1;
+                        infinite = true;
+                        ++m_pos;
+                        break;
+                    case '?':
+                        max = 1;
+                        ++m_pos;
+                        break;
+                    case '{':
+                        ++m_pos;
+                        if (!parseNumber(min))
+                            return false;
+
+                        if ((m_pos < m_pattern.length()) && (m_pattern[m_pos] == ','))
+                        {
+                            ++m_pos;
+                            if ((m_pos < m_pattern.length()) && (m_pattern[m_pos] == '}'))
+                                infinite = true;
+                            else if (!parseNumber(max) || (max < min))
+                                return false;
+                        }
+                        else
+                            max = min;
+
+                        if ((m_pos == m_pattern.length()) || (m_pattern[m_pos] != '}'))
+                            return false;
+
+                        ++m_pos;
+                        break;
+                    default:
+                        result = atom;
+                        return true;
+                    }
+
+                    // A lazy quantifier accepts the same texts when the whole text has to match
+                    if ((m_pos < m_pattern.length()) && (m_pattern[m_pos] == '?'))
+                        ++m_pos;
+
+                    // A quantifier can't directly follow another one
+                    if ((m_pos < m_pattern.length())
+                     && ((m_pattern[m_pos] == '*') || (m_pattern[m_pos] == '+') || (m_pattern[m_pos] == '?') || (m_pattern[m_pos] == '{')))
+                        return false;
+
+                    result = addNode(RegexNode::Type::Repetition);
+                    m_nodes[result].children.push_back(atom);
+                    m_nodes[result].min = min;
+                    m_nodes[result].max = max;
+                    m_nodes[result].infinite = infinite;
+                    return true;
+                }
+
+                bool parseNumber(unsigned int& number)
+                {
+                    const std::size_t start = m_pos;
+                    number = 0;
+                    while ((m_pos < m_pattern.length()) && (m_pattern[m_pos] >= '0') && (m_pattern[m_pos] <= '9'))
+                    {
+                        number = (number * 10) + static_cast<unsigned int>(m_pattern[m_pos] - '0');
+                        if (number > maxRepetitions)
+                            return false;
+
+                        ++m_pos;
+                    }
+
+                    return (m_pos > start);
+                }
+
+                bool parseAtom(std::size_t& result)
+                {
+                    const char c = m_pattern[m_pos++];
+                    switch (c)
+                    {
+                    case '(':
+                    {
+                        if ((m_pos < m_pattern.length()) && (m_pattern[m_pos] == '?'))
+                        {
+                            // Only non-capturing groups are supported, lookaheads are not
+                            if ((m_pos + 1 >= m_pattern.length()) || (m_pattern[m_pos + 1] != ':'))
+                                return false;
+
+                            m_pos += 2;
+                        }
+
+                        if (!parseAlternation(result))
+                            return false;
+
+                        if ((m_pos == m_pattern.length()) || (m_pattern[m_pos] != ')'))
+                            return false;
+
+                        ++m_pos;
+                        return true;
+                    }
+                    case '[':
+                    {
+                        result = addNode(RegexNode::Type::Set);
+                        return parseCharacterClass(m_nodes[result].ranges);
+                    }
+                    case '.':
+                    {
+                        result = addNode(RegexNode::Type::Set);
+                        m_nodes[result].ranges = invertRanges({{'\n', '\n'}, {'\r', '\r'}});
+                        return true;
+                    }
+                    case '\\':
+                    {
+                        result = addNode(RegexNode::Type::Set);
+                        return parseEscape(m_nodes[result].ranges, false);
+                    }
+                    case '^':
+                    case '$':
+                    case '*':
+                    case '+':
+                    case '?':
+                    case '{':
+                    case '}':
+                    case ']':
+                    case ')':
+                    case '|':
+                        return false;
+                    default:
+                    {
+                        result = addNode(RegexNode::Type::Set);
+                        const auto character = static_cast<std::uint32_t>(static_cast<unsigned char>(c));
+                        m_nodes[result].ranges.push_back({character, character});
+                        return true;
+                    }
+                    }
+                }
+
+                bool parseCharacterClass(Ranges& ranges)
+                {
+                    bool negated = false;
+                    if ((m_pos < m_pattern.length()) && (m_pattern[m_pos] == '^'))
+                    {
+                        negated = true;
+                        ++m_pos;
+                    }
+
+                    while (true)
+                    {
+                        if (m_pos == m_pattern.length())
+                            return false;
+
+                        if (m_pattern[m_pos] == ']')
+                        {
+                            ++m_pos;
+                            break;
+                        }
+
+                        std::uint32_t first;
+                        if (!parseClassCharacter(ranges, first))
+                            return false;
+
+                        // A '-' between two characters creates a range, otherwise it is a literal
+                        if ((first != maxCharacter) && (m_pos + 1 < m_pattern.length())
+                         && (m_pattern[m_pos] == '-') && (m_pattern[m_pos + 1] != ']'))
+                        {
+                            ++m_pos;
+
+                            std::uint32_t last;
+                            if (!parseClassCharacter(ranges, last) || (last == maxCharacter) || (last < first))
+                                return false;
+
+                            ranges.push_back({first, last});
+                        }
+                        else if (first != maxCharacter)
+                            ranges.push_back({first, first});
+                    }
+
+                    if (negated)
+                        ranges = invertRanges(ranges);
+                    else
+                        normalizeRanges(ranges);
+
+                    return true;
+                }
+
+                // Reads a single character inside a class. Escapes such as \d are added to the ranges directly,
+                // in which case maxCharacter is returned as character.
+                bool parseClassCharacter(Ranges& ranges, std::uint32_t& character)
+                {
+                    const char c = m_pattern[m_pos++];
+                    if (c != '\\')
+                    {
+                        character = static_cast<unsigned char>(c);
+                        return true;
+                    }
+
+                    Ranges escaped;
+                    if (!parseEscape(escaped, true))
+                        return false;
+
+                    if ((escaped.size() == 1) && (escaped[0].first == escaped[0].second))
+                        character = escaped[0].first;
+                    else
+                    {
+                        ranges.insert(ranges.end(), escaped.begin(), escaped.end());
+                        character = maxCharacter;
+                    }
+
+                    return true;
+                }
+
+                bool parseEscape(Ranges& ranges, bool insideClass)
+                {
+                    if (m_pos == m_pattern.length())
+                        return false;
+
+                    const Ranges digits = {{'0', '9'}};
+                    const Ranges wordCharacters = {{'0', '9'}, {'A', 'Z'}, {'_', '_'}, {'a', 'z'}};
+                    const Ranges whitespace = {{'\t', '\r'}, {' ', ' '}};
+
+                    const char c = m_pattern[m_pos++];
+                    switch (c)
+                    {
+                    case 'd': ranges = digits; return true;
+                    case 'D': ranges = invertRanges(digits); return true;
+                    case 'w': ranges = wordCharacters; return true;
+                    case 'W': ranges = invertRanges(wordCharacters); return true;
+                    case 's': ranges = whitespace; return true;
+                    case 'S': ranges = invertRanges(whitespace); return true;
+                    case 'n': ranges = {{'\n', '\n'}}; return true;
+                    case 'r': ranges = {{'\r', '\r'}}; return true;
+                    case 't': ranges = {{'\t', '\t'}}; return true;
+                    case 'f': ranges = {{'\f', '\f'}}; return true;
+                    case 'v': ranges = {{'\v', '\v'}}; return true;
+                    case 'b':
+                    {
+                        // Inside a class this is a backspace, outside it is a word boundary which isn't supported
+                        if (!insideClass)
+                            return false;
+
+                        ranges = {{'\b', '\b'}};
+                        return true;
+                    }
+                    default:
+                    {
+                        // Other letters and digits have a special meaning (back-references, hex codes, ...)
+                        if (((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || ((c >= '0') && (c <= '9')))
+                            return false;
+
+                        const auto character = static_cast<std::uint32_t>(static_cast<unsigned char>(c));
+                        ranges = {{character, character}};
+                        return true;
+                    }
+                    }
+                }
+
+            private:
+
+                const std::string& m_pattern;
+                std::vector<RegexNode>& m_nodes;
+                std::size_t m_pos = 0;
+            };
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            struct NfaState
+            {
+                std::vector<std::size_t> epsilonTransitions;
+                Ranges ranges; // Characters that lead to the next state
+                std::size_t next = 0;
+            };
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            // Thompson construction of an NFA from the parsed pattern
+            class NfaBuilder
+            {
+            public:
+
+                NfaBuilder(const std::vector<RegexNode>& nodes, std::vector<NfaState>& states) :
+                    m_nodes(nodes),
+                    m_states(states)
+                {
+                }
+
+                // Creates the states for a node and returns its start and end state
+                bool build(std::size_t nodeIndex, std::size_t& start, std::size_t& end)
+                {
+                    if (m_states.size() > maxNfaStates)
+                        return false;
+
+                    const RegexNode& node = m_nodes[nodeIndex];
+                    switch (node.type)
+                    {
+                    case RegexNode::Type::Empty:
+                    {
+                        start = end = addState();
+                        return true;
+                    }
+                    case RegexNode::Type::Set:
+                    {
+                        start = addState();
+                        end = addState();
+                        m_states[start].ranges = node.ranges;
+                        m_states[start].next = end;
+                        return true;
+                    }
+                    case RegexNode::Type::Concatenation:
+                    {
+                        start = end = addState();
+                        for (const auto child : node.children)
+                        {
+                            std::size_t childStart;
+                            std::size_t childEnd;
+                            if (!build(child, childStart, childEnd))
+                                return false;
+
+                            m_states[end].epsilonTransitions.push_back(childStart);
+                            end = childEnd;
+                        }
+                        return true;
+                    }
+                    case RegexNode::Type::Alternation:
+                    {
+                        start = addState();
+                        end = addState();
+                        for (const auto child : node.children)
+                        {
+                            std::size_t childStart;
+                            std::size_t childEnd;
+                            if (!build(child, childStart, childEnd))
+                                return false;
+
+                            m_states[start].epsilonTransitions.push_back(childStart);
+                            m_states[childEnd].epsilonTransitions.push_back(end);
+                        }
+                        return true;
+                    }
+                    case RegexNode::Type::Repetition:
+                    {
+                        // The mandatory repetitions are placed behind each other
+                        start = end = addState();
+                        for (unsigned int i = 0; i < node.min; ++i)
+                        {
+                            std::size_t childStart;
+                            std::size_t childEnd;
+                            if (!build(node.children[0], childStart, childEnd))
+                                return false;
+
+                            m_states[end].epsilonTransitions.push_back(childStart);
+                            end = childEnd;
+                        }
+
+                        if (node.infinite)
+                        {
+                            std::size_t childStart;
+                            std::size_t childEnd;
+                            if (!build(node.children[0], childStart, childEnd))
+                                return false;
+
+                            const std::size_t loop = addState();
+                            m_states[end].epsilonTransitions.push_back(loop);
+                            m_states[loop].epsilonTransitions.push_back(childStart);
+                            m_states[childEnd].epsilonTransitions.push_back(loop);
+                            end = loop;
+                        }
+                        else if (node.max > node.min)
+                        {
+                            // Each optional repetition can skip directly to the end
+                            const std::size_t optionalEnd = addState();
+                            for (unsigned int i = node.min; i < node.max; ++i)
+                            {
+                                std::size_t childStart;
+                                std::size_t childEnd;
+                                if (!build(node.children[0], childStart, childEnd))
+                                    return false;
+
+                                m_states[end].epsilonTransitions.push_back(childStart);
+                                m_states[end].epsilonTransitions.push_back(optionalEnd);
+                                end = childEnd;
+                            }
+
+                            m_states[end].epsilonTransitions.push_back(optionalEnd);
+                            end = optionalEnd;
+                        }
+                        return true;
+                    }
+                    }
+
+                    return false;
+                }
+
+            private:
+
+                std::size_t addState()
+                {
+                    m_states.emplace_back();
+                    return m_states.size() - 1;
+                }
+
+            private:
+
+                const std::vector<RegexNode>& m_nodes;
+                std::vector<NfaState>& m_states;
+            };
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            // Replaces the set of states by all states that can be reached from them without reading a character
+            void addEpsilonClosure(const std::vector<NfaState>& nfa, std::vector<std::size_t>& states)
+            {
+                std::vector<bool> included(nfa.size(), false);
+                for (const auto state : states)
+                    included[state] = true;
+
+                for (std::size_t i = 0; i < states.size(); ++i)
+                {
+                    for (const auto next : nfa[states[i]].epsilonTransitions)
+                    {
+                        if (!included[next])
+                        {
+                            included[next] = true;
+                            states.push_back(next);
+                        }
+                    }
+                }
+
+                std::sort(states.begin(), states.end());
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void InputValidator::setPattern(const std::string& pattern)
+        {
+            m_pattern = pattern;
+            m_characterSet.clear();
+            m_classBoundaries.clear();
+            m_transitions.clear();
+            m_acceptingStates.clear();
+            m_prefixStates.clear();
+            m_regex = std::regex{};
+
+            if (pattern == ".*")
+            {
+                m_kind = Kind::All;
+                return;
+            }
+
+            std::vector<RegexNode> nodes;
+            std::size_t root;
+            PatternParser parser{pattern, nodes};
+            if (!parser.parse(root))
+            {
+                // Patterns that can't be compiled are still supported, but slower
+                m_regex = std::regex{pattern};
+                m_kind = Kind::Regex;
+                return;
+            }
+
+            // Skip the concatenation with a single child that the parser creates around every branch
+            while ((nodes[root].type == RegexNode::Type::Concatenation) && (nodes[root].children.size() == 1))
+                root = nodes[root].children[0];
+
+            if ((nodes[root].type == RegexNode::Type::Repetition) && (nodes[root].min == 0) && nodes[root].infinite)
+            {
+                std::size_t child = nodes[root].children[0];
+                while ((nodes[child].type == RegexNode::Type::Concatenation) && (nodes[child].children.size() == 1))
+                    child = nodes[child].children[0];
+
+                if (nodes[child].type == RegexNode::Type::Set)
+                {
+                    m_characterSet = nodes[child].ranges;
+                    normalizeRanges(m_characterSet);
+                    m_kind = Kind::CharacterSet;
+                    return;
+                }
+            }
+
+            std::vector<NfaState> nfa;
+            std::size_t nfaStart;
+            std::size_t nfaEnd;
+            if (!NfaBuilder{nodes, nfa}.build(root, nfaStart, nfaEnd))
+            {
+                m_regex = std::regex{pattern};
+                m_kind = Kind::Regex;
+                return;
+            }
+
+            // Split the characters in classes that are treated the same by every state
+            for (const auto& state : nfa)
+            {
+                for (const auto& range : state.ranges)
+                {
+                    m_classBoundaries.push_back(range.first);
+                    if (range.second != maxCharacter)
+                        m_classBoundaries.push_back(range.second + 1);
+                }
+            }
+            std::sort(m_classBoundaries.begin(), m_classBoundaries.end());
+            m_classBoundaries.erase(std::unique(m_classBoundaries.begin(), m_classBoundaries.end()), m_classBoundaries.end());
+            m_classCount = m_classBoundaries.size() + 1;
+
+            for (std::uint32_t c = 0; c < m_asciiClasses.size(); ++c)
+                m_asciiClasses[c] = static_cast<std::uint16_t>(std::upper_bound(m_classBoundaries.begin(), m_classBoundaries.end(), c) - m_classBoundaries.begin());
+
+            // Subset construction, with the dead state as state 0
+            std::map<std::vector<std::size_t>, std::uint16_t> dfaStateIds;
+            std::vector<std::vector<std::size_t>> dfaStates;
+            dfaStateIds[{}] = 0;
+            dfaStates.emplace_back();
+
+            std::vector<std::size_t> startState{nfaStart};
+            addEpsilonClosure(nfa, startState);
+            dfaStateIds[startState] = 1;
+            dfaStates.push_back(startState);
+
+            for (std::size_t i = 0; i < dfaStates.size(); ++i)
+            {
+                m_acceptingStates.push_back(std::binary_search(dfaStates[i].begin(), dfaStates[i].end(), nfaEnd));
+                for (std::size_t characterClass = 0; characterClass < m_classCount; ++characterClass)
+                {
+                    // Every character in a class behaves the same, so the first one can represent the class
+                    const std::uint32_t character = (characterClass > 0) ? m_classBoundaries[characterClass - 1] : 0;
+
+                    std::vector<std::size_t> nextState;
+                    for (const auto nfaState : dfaStates[i])
+                    {
+                        if (rangesContain(nfa[nfaState].ranges, character))
+                            nextState.push_back(nfa[nfaState].next);
+                    }
+                    addEpsilonClosure(nfa, nextState);
+                    nextState.erase(std::unique(nextState.begin(), nextState.end()), nextState.end());
+
+                    auto it = dfaStateIds.find(nextState);
+                    if (it == dfaStateIds.end())
+                    {
+                        if (dfaStates.size() >= maxDfaStates)
+                        {
+                            m_classBoundaries.clear();
+                            m_transitions.clear();
+                            m_acceptingStates.clear();
+                            m_regex = std::regex{pattern};
+                            m_kind = Kind::Regex;
+                            return;
+                        }
+
+                        it = dfaStateIds.insert({nextState, static_cast<std::uint16_t>(dfaStates.size())}).first;
+                        dfaStates.push_back(nextState);
+                    }
+
+                    m_transitions.push_back(it->second);
+                }
+            }
+
+            m_kind = Kind::Dfa;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool InputValidator::isValid(const sf::String& text) const
+        {
+            switch (m_kind)
+            {
+            case Kind::All:
+                return true;
+
+            case Kind::CharacterSet:
+                return std::all_of(text.begin(), text.end(), [this](std::uint32_t c){ return isInCharacterSet(c); });
+
+            case Kind::Dfa:
+            {
+                std::uint16_t state = 1;
+                for (auto it = text.begin(); (it != text.end()) && (state != 0); ++it)
+                    state = getNextState(state, *it);
+
+                return m_acceptingStates[state];
+            }
+
+            case Kind::Regex:
+                return std::regex_match(text.toAnsiString(), m_regex);
+            }
+
+            return false;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool InputValidator::isValidEdit(const sf::String& text, std::size_t pos, std::size_t erased, const std::uint32_t* inserted, std::size_t insertedCount)
+        {
+            switch (m_kind)
+            {
+            case Kind::All:
+                return true;
+
+            case Kind::CharacterSet:
+                return std::all_of(inserted, inserted + insertedCount, [this](std::uint32_t c){ return isInCharacterSet(c); });
+
+            case Kind::Dfa:
+            {
+                // Extend the remembered states up to the position of the edit
+                if (m_prefixStates.empty())
+                    m_prefixStates.push_back(1);
+                while (m_prefixStates.size() <= pos)
+                    m_prefixStates.push_back(getNextState(m_prefixStates.back(), text[m_prefixStates.size() - 1]));
+
+                std::uint16_t state = m_prefixStates[pos];
+                for (std::size_t i = 0; (i < insertedCount) && (state != 0); ++i)
+                    state = getNextState(state, inserted[i]);
+                for (std::size_t i = pos + erased; (i < text.getSize()) && (state != 0); ++i)
+                    state = getNextState(state, text[i]);
+
+                return m_acceptingStates[state];
+            }
+
+            case Kind::Regex:
+            {
+                sf::String newText = text;
+                newText.erase(pos, erased);
+                newText.insert(pos, sf::String::fromUtf32(inserted, inserted + insertedCount));
+                return std::regex_match(newText.toAnsiString(), m_regex);
+            }
+            }
+
+            return false;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::uint16_t InputValidator::getNextState(std::uint16_t state, std::uint32_t character) const
+        {
+            std::size_t characterClass;
+            if (character < m_asciiClasses.size())
+                characterClass = m_asciiClasses[character];
+            else
+                characterClass = static_cast<std::size_t>(std::upper_bound(m_classBoundaries.begin(), m_classBoundaries.end(), character) - m_classBoundaries.begin());
+
+            return m_transitions[(state * m_classCount) + characterClass];
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool InputValidator::isInCharacterSet(std::uint32_t character) const
+        {
+            auto it = std::upper_bound(m_characterSet.begin(), m_characterSet.end(), std::make_pair(character, maxCharacter));
+            return (it != m_characterSet.begin()) && (character <= std::prev(it)->second);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
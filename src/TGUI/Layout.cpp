@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Layout.hpp>
+#include <TGUI/LayoutScheduler.hpp>
 #include <TGUI/Widget.hpp>
 #include <TGUI/Gui.hpp>
 #include <TGUI/to_string.hpp>
@@ -34,6 +35,43 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // Returns the child of the container whose lowercase name matches the part of the expression, without allocating memory
+        Widget* findWidgetByName(const Container& container, const std::string& expression, std::size_t nameStart, std::size_t nameLength)
+        {
+            const auto& widgets = container.getWidgets();
+            const auto& widgetNames = container.getWidgetNames();
+            for (std::size_t i = 0; i < widgets.size(); ++i)
+            {
+                const sf::String& name = widgetNames[i];
+                if (name.getSize() != nameLength)
+                    continue;
+
+                bool match = true;
+                for (std::size_t j = 0; (j < nameLength) && match; ++j)
+                {
+                    sf::Uint32 c = name[j];
+                    if (c >= 128) // Non-ASCII names are compared the way they were always compared
+                    {
+                        match = (toLower(name) == expression.substr(nameStart, nameLength));
+                        break;
+                    }
+
+                    if ((c >= 'A') && (c <= 'Z'))
+                        c += 'a' - 'A';
+
+                    match = (c == static_cast<unsigned char>(expression[nameStart + j]));
+                }
+
+                if (match)
+                    return widgets[i].get();
+            }
+
+            return nullptr;
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout::Layout(std::string expression)
@@ -60,8 +98,8 @@ namespace tgui
                 else // value is a fraction of parent size
                 {
                     *this = Layout{Layout::Operation::Multiplies,
-                                   make_unique<Layout>(tgui::stof(expression.substr(0, expression.length()-1)) / 100.f),
-                                   make_unique<Layout>("&.size")};
+                                   std::make_shared<Layout>(tgui::stof(expression.substr(0, expression.length()-1)) / 100.f),
+                                   std::make_shared<Layout>("&.size")};
                 }
             }
             else
@@ -87,14 +125,14 @@ namespace tgui
                 else if (expression.size() >= 5 && expression.substr(expression.size()-5) == "right")
                 {
                     *this = Layout{Operation::Plus,
-                                   make_unique<Layout>(expression.substr(0, expression.size()-5) + "left"),
-                                   make_unique<Layout>(expression.substr(0, expression.size()-5) + "width")};
+                                   std::make_shared<Layout>(expression.substr(0, expression.size()-5) + "left"),
+                                   std::make_shared<Layout>(expression.substr(0, expression.size()-5) + "width")};
                 }
                 else if (expression.size() >= 6 && expression.substr(expression.size()-6) == "bottom")
                 {
                     *this = Layout{Operation::Plus,
-                                   make_unique<Layout>(expression.substr(0, expression.size()-6) + "top"),
-                                   make_unique<Layout>(expression.substr(0, expression.size()-6) + "height")};
+                                   std::make_shared<Layout>(expression.substr(0, expression.size()-6) + "top"),
+                                   std::make_shared<Layout>(expression.substr(0, expression.size()-6) + "height")};
                 }
                 else // Constant value
                     m_value = tgui::stof(expression);
@@ -188,8 +226,8 @@ namespace tgui
                 std::advance(nextOperandIt, 1);
 
                 (*operandIt) = Layout{operators[i],
-                                      make_unique<Layout>(*operandIt),
-                                      make_unique<Layout>(*nextOperandIt)};
+                                      std::make_shared<Layout>(std::move(*operandIt)),
+                                      std::make_shared<Layout>(std::move(*nextOperandIt))};
 
                 operands.erase(nextOperandIt);
             }
@@ -211,15 +249,15 @@ namespace tgui
                 assert(nextOperandIt != operands.end());
 
                 (*operandIt) = Layout{operators[i],
-                                      make_unique<Layout>(*operandIt),
-                                      make_unique<Layout>(*nextOperandIt)};
+                                      std::make_shared<Layout>(std::move(*operandIt)),
+                                      std::make_shared<Layout>(std::move(*nextOperandIt))};
 
                 operands.erase(nextOperandIt);
             }
         }
 
         assert(operands.size() == 1);
-        *this = operands.front();
+        *this = std::move(operands.front());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -246,7 +284,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Layout::Layout(Operation operation, std::unique_ptr<Layout> leftOperand, std::unique_ptr<Layout> rightOperand) :
+    Layout::Layout(Operation operation, std::shared_ptr<Layout> leftOperand, std::shared_ptr<Layout> rightOperand) :
         m_operation   {operation},
         m_leftOperand {std::move(leftOperand)},
         m_rightOperand{std::move(rightOperand)}
@@ -263,11 +301,12 @@ namespace tgui
         m_value          {other.m_value},
         m_parent         {other.m_parent},
         m_operation      {other.m_operation},
-        m_leftOperand    {other.m_leftOperand ? make_unique<Layout>(*other.m_leftOperand) : nullptr},
-        m_rightOperand   {other.m_rightOperand ? make_unique<Layout>(*other.m_rightOperand) : nullptr},
         m_boundWidget    {other.m_boundWidget},
         m_boundString    {other.m_boundString}
     {
+        copyOperand(m_leftOperand, other.m_leftOperand);
+        copyOperand(m_rightOperand, other.m_rightOperand);
+
         // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
         if (!m_boundString.empty())
             m_boundWidget = nullptr;
@@ -300,11 +339,13 @@ namespace tgui
             m_value           = other.m_value;
             m_parent          = other.m_parent;
             m_operation       = other.m_operation;
-            m_leftOperand     = other.m_leftOperand ? make_unique<Layout>(*other.m_leftOperand) : nullptr;
-            m_rightOperand    = other.m_rightOperand ? make_unique<Layout>(*other.m_rightOperand) : nullptr;
             m_boundWidget     = other.m_boundWidget;
             m_boundString     = other.m_boundString;
 
+            // Share or reuse the existing operands when possible, so that assigning a layout with the same structure doesn't allocate
+            copyOperand(m_leftOperand, other.m_leftOperand);
+            copyOperand(m_rightOperand, other.m_rightOperand);
+
             // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
             if (!m_boundString.empty())
                 m_boundWidget = nullptr;
@@ -382,6 +423,32 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Layout::copyOperand(std::shared_ptr<Layout>& operand, const std::shared_ptr<Layout>& otherOperand)
+    {
+        if (!otherOperand)
+            operand = nullptr;
+        else if (otherOperand->isConstant())
+            operand = otherOperand;
+        else if (operand && (operand.use_count() == 1))
+            *operand = *otherOperand;
+        else
+            operand = std::make_shared<Layout>(*otherOperand);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Layout::isConstant() const
+    {
+        if (m_operation == Operation::Value)
+            return true;
+        else if (m_leftOperand)
+            return m_leftOperand->isConstant() && m_rightOperand->isConstant();
+        else
+            return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Layout::unbindLayout()
     {
         if (m_boundWidget)
@@ -403,8 +470,11 @@ namespace tgui
         {
             assert(m_rightOperand != nullptr);
 
-            m_leftOperand->m_parent = this;
-            m_rightOperand->m_parent = this;
+            // Constant operands may be shared with other layouts. They don't need a parent as their value never changes.
+            if (!m_leftOperand->isConstant())
+                m_leftOperand->m_parent = this;
+            if (!m_rightOperand->isConstant())
+                m_rightOperand->m_parent = this;
         }
 
         if (m_boundWidget)
@@ -426,11 +496,13 @@ namespace tgui
 
         // No callbacks must be made while parsing, a single callback will be made when done if needed
         m_connectedWidgetCallback = nullptr;
+        m_connectedWidget = nullptr;
 
         parseBindingStringRecursive(widget, xAxis);
 
         // Restore the callback function
         m_connectedWidgetCallback = valueChangedCallbackHandler;
+        m_connectedWidget = widget;
 
         if (m_value != oldValue)
         {
@@ -504,8 +576,11 @@ namespace tgui
                 m_parent->recalculateValue();
             else
             {
-                // The topmost layout must tell the connected widget about the new value
-                if (m_connectedWidgetCallback)
+                // The topmost layout must tell the connected widget about the new value. When a widget is connected, the
+                // scheduler will update it once all widgets on which it depends have been updated.
+                if (m_connectedWidget)
+                    LayoutScheduler::layoutChanged(m_connectedWidget, this);
+                else if (m_connectedWidgetCallback)
                     m_connectedWidgetCallback();
             }
         }
@@ -532,84 +607,66 @@ namespace tgui
 
     void Layout::parseBindingString(const std::string& expression, Widget* widget, bool xAxis)
     {
-        if (expression == "x" || expression == "left")
-        {
-            m_operation = Operation::BindingLeft;
-            m_boundWidget = widget;
-        }
-        else if (expression == "y" || expression == "top")
-        {
-            m_operation = Operation::BindingTop;
-            m_boundWidget = widget;
-        }
-        else if (expression == "w" || expression == "width")
-        {
-            m_operation = Operation::BindingWidth;
-            m_boundWidget = widget;
-        }
-        else if (expression == "h" || expression == "height")
-        {
-            m_operation = Operation::BindingHeight;
-            m_boundWidget = widget;
-        }
-        else if (expression == "size")
-        {
-            if (xAxis)
-                return parseBindingString("width", widget, xAxis);
-            else
-                return parseBindingString("height", widget, xAxis);
-        }
-        else if ((expression == "pos") || (expression == "position"))
-        {
-            if (xAxis)
-                return parseBindingString("x", widget, xAxis);
+        // Find the widget that is referred to by the names in front of the property.
+        // The expression is inspected in place, this function is called every time the position or size of a widget is set.
+        std::size_t nameStart = 0;
+        std::size_t dotPos = expression.find('.');
+        while (dotPos != std::string::npos)
+        {
+            const std::size_t nameLength = dotPos - nameStart;
+            if (nameLength == 0)
+                return;
+
+            if (((nameLength == 6) && (expression.compare(nameStart, nameLength, "parent") == 0))
+             || ((nameLength == 1) && (expression[nameStart] == '&')))
+            {
+                if (!widget->getParent())
+                    return;
+
+                widget = widget->getParent();
+            }
             else
-                return parseBindingString("y", widget, xAxis);
-        }
-        else
-        {
-            const auto dotPos = expression.find('.');
-            if (dotPos != std::string::npos)
             {
-                const std::string widgetName = expression.substr(0, dotPos);
-                if (widgetName == "parent" || widgetName == "&")
-                {
-                    if (widget->getParent())
-                        return parseBindingString(expression.substr(dotPos+1), widget->getParent(), xAxis);
-                }
-                else if (!widgetName.empty())
-                {
-                    // If the widget is a container, search in its children first
-                    Container* container = dynamic_cast<Container*>(widget);
-                    if (container != nullptr)
-                    {
-                        const auto& widgets = container->getWidgets();
-                        const auto& widgetNames = container->getWidgetNames();
-                        for (std::size_t i = 0; i < widgets.size(); ++i)
-                        {
-                            if (toLower(widgetNames[i]) == widgetName)
-                                return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis);
-                        }
-                    }
+                Widget* foundWidget = nullptr;
 
-                    // If the widget has a parent, look for a sibling
-                    if (widget->getParent())
-                    {
-                        const auto& widgets = widget->getParent()->getWidgets();
-                        const auto& widgetNames = widget->getParent()->getWidgetNames();
-                        for (std::size_t i = 0; i < widgets.size(); ++i)
-                        {
-                            if (toLower(widgetNames[i]) == widgetName)
-                                return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis);
-                        }
-                    }
-                }
+                // If the widget is a container, search in its children first
+                Container* container = dynamic_cast<Container*>(widget);
+                if (container != nullptr)
+                    foundWidget = findWidgetByName(*container, expression, nameStart, nameLength);
+
+                // If the widget has a parent, look for a sibling
+                if (!foundWidget && widget->getParent())
+                    foundWidget = findWidgetByName(*widget->getParent(), expression, nameStart, nameLength);
+
+                // The referred widget was not found
+                if (!foundWidget)
+                    return;
+
+                widget = foundWidget;
             }
 
-            // The referred widget was not found or there was something wrong with the string
-            return;
+            nameStart = dotPos + 1;
+            dotPos = expression.find('.', nameStart);
         }
 
+        const auto propertyIs = [&](const char* property){ return expression.compare(nameStart, std::string::npos, property) == 0; };
+        if (propertyIs("size"))
+            m_operation = xAxis ? Operation::BindingWidth : Operation::BindingHeight;
+        else if (propertyIs("pos") || propertyIs("position"))
+            m_operation = xAxis ? Operation::BindingLeft : Operation::BindingTop;
+        else if (propertyIs("x") || propertyIs("left"))
+            m_operation = Operation::BindingLeft;
+        else if (propertyIs("y") || propertyIs("top"))
+            m_operation = Operation::BindingTop;
+        else if (propertyIs("w") || propertyIs("width"))
+            m_operation = Operation::BindingWidth;
+        else if (propertyIs("h") || propertyIs("height"))
+            m_operation = Operation::BindingHeight;
+        else // There is something wrong with the string
+            return;
+
+        m_boundWidget = widget;
+
         resetPointers();
         recalculateValue();
     }
@@ -619,35 +676,35 @@ namespace tgui
 
     Layout operator-(Layout right)
     {
-        return Layout{Layout::Operation::Minus, make_unique<Layout>(), make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Minus, std::make_shared<Layout>(), std::make_shared<Layout>(std::move(right))};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator+(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Plus, make_unique<Layout>(std::move(left)), make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Plus, std::make_shared<Layout>(std::move(left)), std::make_shared<Layout>(std::move(right))};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator-(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Minus, make_unique<Layout>(std::move(left)), make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Minus, std::make_shared<Layout>(std::move(left)), std::make_shared<Layout>(std::move(right))};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator*(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Multiplies, make_unique<Layout>(std::move(left)), make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Multiplies, std::make_shared<Layout>(std::move(left)), std::make_shared<Layout>(std::move(right))};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator/(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Divides, make_unique<Layout>(std::move(left)), make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Divides, std::make_shared<Layout>(std::move(left)), std::make_shared<Layout>(std::move(right))};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -730,8 +787,8 @@ namespace tgui
         Layout bindRight(Widget::Ptr widget)
         {
             return Layout{Layout::Operation::Plus,
-                          make_unique<Layout>(Layout::Operation::BindingLeft, widget.get()),
-                          make_unique<Layout>(Layout::Operation::BindingWidth, widget.get())};
+                          std::make_shared<Layout>(Layout::Operation::BindingLeft, widget.get()),
+                          std::make_shared<Layout>(Layout::Operation::BindingWidth, widget.get())};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -739,8 +796,8 @@ namespace tgui
         Layout bindBottom(Widget::Ptr widget)
         {
             return Layout{Layout::Operation::Plus,
-                          make_unique<Layout>(Layout::Operation::BindingTop, widget.get()),
-                          make_unique<Layout>(Layout::Operation::BindingHeight, widget.get())};
+                          std::make_shared<Layout>(Layout::Operation::BindingTop, widget.get()),
+                          std::make_shared<Layout>(Layout::Operation::BindingHeight, widget.get())};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,281 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/LayoutScheduler.hpp>
+#include <TGUI/Layout.hpp>
+#include <TGUI/Widget.hpp>
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Widgets only have to be updated more than once when there is a circular dependency or when a container moves its
+        // children while it is being resized. The scheduler gives up when the layouts keep changing after this many passes.
+        const unsigned int maxUpdatePasses = 100;
+    }
+
+    std::unordered_map<Widget*, LayoutScheduler::PendingChanges> LayoutScheduler::m_pendingChanges;
+    bool LayoutScheduler::m_deferred = false;
+    bool LayoutScheduler::m_updating = false;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void LayoutScheduler::setDeferred(bool deferred)
+    {
+        m_deferred = deferred;
+
+        if (!m_deferred)
+            update();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool LayoutScheduler::isDeferred()
+    {
+        return m_deferred;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void LayoutScheduler::update()
+    {
+        // Changes made while updating are handled by the update that is already in progress
+        if (m_updating || m_pendingChanges.empty())
+            return;
+
+        m_updating = true;
+
+        bool circularDependencyFound = false;
+        unsigned int passes = 0;
+        std::vector<Widget*> order;
+        while (!m_pendingChanges.empty())
+        {
+            if (++passes > maxUpdatePasses)
+            {
+                if (!circularDependencyFound)
+                    TGUI_PRINT_WARNING("layouts kept changing while updating them, some widgets may have the wrong position or size.");
+
+                m_pendingChanges.clear();
+                break;
+            }
+
+            order.clear();
+            if (!findUpdateOrder(order))
+                circularDependencyFound = true;
+
+            for (Widget* widget : order)
+                updateWidget(widget);
+        }
+
+        m_updating = false;
+
+        if (circularDependencyFound)
+            TGUI_PRINT_WARNING("circular dependency found between layouts, some widgets may have the wrong position or size.");
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool LayoutScheduler::hasPendingUpdates()
+    {
+        return !m_pendingChanges.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void LayoutScheduler::widgetMoved(Widget* widget)
+    {
+        m_pendingChanges[widget].moved = true;
+
+        if (!m_deferred)
+            update();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void LayoutScheduler::widgetResized(Widget* widget)
+    {
+        m_pendingChanges[widget].resized = true;
+
+        if (!m_deferred)
+            update();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void LayoutScheduler::layoutChanged(Widget* widget, const Layout* layout)
+    {
+        auto& changes = m_pendingChanges[widget];
+        if ((layout == &widget->getPositionLayout().x) || (layout == &widget->getPositionLayout().y))
+            changes.positionLayoutChanged = true;
+        else
+            changes.sizeLayoutChanged = true;
+
+        if (!m_deferred)
+            update();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void LayoutScheduler::widgetDestroyed(Widget* widget)
+    {
+        m_pendingChanges.erase(widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool LayoutScheduler::findUpdateOrder(std::vector<Widget*>& order)
+    {
+        // Depth-first search through the dependencies. A widget is only added to the list after all widgets that depend on it,
+        // so reversing the list gives an order in which each widget comes after all the widgets on which it depends.
+        struct SearchState
+        {
+            Widget* widget;
+            std::vector<Widget*> dependents;
+            std::size_t nextDependent;
+        };
+
+        bool circularDependencyFound = false;
+        std::unordered_map<Widget*, bool> visited; // Value is false while the dependents of the widget are still being visited
+        std::vector<SearchState> stack;
+        for (const auto& pair : m_pendingChanges)
+        {
+            if (visited.find(pair.first) != visited.end())
+                continue;
+
+            visited[pair.first] = false;
+            stack.push_back({pair.first, {}, 0});
+            getDependentWidgets(pair.first, stack.back().dependents);
+
+            while (!stack.empty())
+            {
+                SearchState& state = stack.back();
+                if (state.nextDependent < state.dependents.size())
+                {
+                    Widget* dependent = state.dependents[state.nextDependent++];
+                    const auto visitedIt = visited.find(dependent);
+                    if (visitedIt == visited.end())
+                    {
+                        visited[dependent] = false;
+                        stack.push_back({dependent, {}, 0});
+                        getDependentWidgets(dependent, stack.back().dependents);
+                    }
+                    else if (!visitedIt->second)
+                        circularDependencyFound = true;
+                }
+                else
+                {
+                    visited[state.widget] = true;
+                    order.push_back(state.widget);
+                    stack.pop_back();
+                }
+            }
+        }
+
+        std::reverse(order.begin(), order.end());
+        return !circularDependencyFound;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void LayoutScheduler::getDependentWidgets(Widget* widget, std::vector<Widget*>& dependents)
+    {
+        if (!widget->m_sideStorage)
+            return;
+
+        for (const auto* boundLayouts : {&widget->m_sideStorage->boundPositionLayouts, &widget->m_sideStorage->boundSizeLayouts})
+        {
+            for (const Layout* layout : *boundLayouts)
+            {
+                // The widget that uses the layout is connected to the topmost layout
+                while (layout->m_parent)
+                    layout = layout->m_parent;
+
+                if (layout->m_connectedWidget)
+                    dependents.push_back(layout->m_connectedWidget);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void LayoutScheduler::updateWidget(Widget* widget)
+    {
+        auto it = m_pendingChanges.find(widget);
+        if (it == m_pendingChanges.end())
+            return;
+
+        // Setting the position or size again will mark the widget as moved or resized if the value changed
+        const bool positionLayoutChanged = it->second.positionLayoutChanged;
+        const bool sizeLayoutChanged = it->second.sizeLayoutChanged;
+        it->second.positionLayoutChanged = false;
+        it->second.sizeLayoutChanged = false;
+
+        if (positionLayoutChanged)
+            widget->setPosition(widget->getPositionLayout());
+        if (sizeLayoutChanged)
+            widget->setSize(widget->getSizeLayout());
+
+        // The widget may have been destroyed by a signal handler
+        it = m_pendingChanges.find(widget);
+        if (it == m_pendingChanges.end())
+            return;
+
+        const bool moved = it->second.moved;
+        const bool resized = it->second.resized;
+        if (it->second.positionLayoutChanged || it->second.sizeLayoutChanged)
+        {
+            it->second.moved = false;
+            it->second.resized = false;
+        }
+        else
+            m_pendingChanges.erase(it);
+
+        // Recalculating the layouts will mark the widgets that depend on them as changed, they come later in the update order
+        if (!widget->m_sideStorage)
+            return;
+
+        if (moved)
+        {
+            for (auto& layout : widget->m_sideStorage->boundPositionLayouts)
+                layout->recalculateValue();
+        }
+
+        if (resized)
+        {
+            for (auto& layout : widget->m_sideStorage->boundSizeLayouts)
+                layout->recalculateValue();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
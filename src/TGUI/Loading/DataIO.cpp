@@ -27,42 +27,44 @@
 #include <TGUI/Global.hpp>
 #include <TGUI/to_string.hpp>
 
-#include <cctype>
+#include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <random>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #define REMOVE_WHITESPACE_AND_COMMENTS(ReturnErrorOnEOF) \
     for (;;) \
     { \
-        stream >> std::ws; \
-        if (stream.peek() == EOF) \
+        input.skipWhitespace(); \
+        if (input.peek() == EOF) \
             break; \
         \
-        if (stream.peek() == '/') \
+        if (input.peek() == '/') \
         { \
-            char c; \
-            stream.read(&c, 1); \
-            if (stream.peek() == '/') \
+            input.get(); \
+            if (input.peek() == '/') \
             { \
-                while (stream.peek() != EOF) \
+                while (input.peek() != EOF) \
                 { \
-                    stream.read(&c, 1); \
-                    if (c == '\n') \
+                    if (input.get() == '\n') \
                         break; \
                 } \
             } \
-            else if (stream.peek() == '*') \
+            else if (input.peek() == '*') \
             { \
-                while (stream.peek() != EOF) \
+                while (input.peek() != EOF) \
                 { \
-                    stream.read(&c, 1); \
-                    if (stream.peek() == '*') \
+                    input.get(); \
+                    if (input.peek() == '*') \
                     { \
-                        stream.read(&c, 1); \
-                        if (stream.peek() == '/') \
+                        input.get(); \
+                        if (input.peek() == '/') \
                         { \
-                            stream.read(&c, 1); \
+                            input.get(); \
                             break; \
                         } \
                     } \
@@ -77,7 +79,7 @@
         break; \
     } \
     \
-    if (stream.peek() == EOF) \
+    if (input.peek() == EOF) \
     { \
         if (ReturnErrorOnEOF) \
             return "Unexpected EOF while parsing."; \
@@ -91,48 +93,120 @@ namespace tgui
 {
     namespace
     {
+        bool isWhitespace(char c)
+        {
+            return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\v') || (c == '\f') || (c == '\r');
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Part of the input (or of the buffer when the value had to be modified) that hasn't been converted to a string yet
+        struct Slice
+        {
+            const char* begin = nullptr;
+            const char* end = nullptr;
+
+            bool empty() const
+            {
+                return begin == end;
+            }
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Contiguous buffer that is being parsed
+        struct Input
+        {
+            const char* pos;
+            const char* end;
+
+            // Storage for values from which comments had to be removed or in which whitespace had to be collapsed
+            std::string buffer;
+
+            int peek() const
+            {
+                return (pos < end) ? static_cast<unsigned char>(*pos) : EOF;
+            }
+
+            char get()
+            {
+                return *pos++;
+            }
+
+            void skipWhitespace()
+            {
+                while ((pos < end) && isWhitespace(*pos))
+                    ++pos;
+            }
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        Slice trimSlice(Slice slice)
+        {
+            while ((slice.begin < slice.end) && isWhitespace(*slice.begin))
+                ++slice.begin;
+            while ((slice.begin < slice.end) && isWhitespace(*(slice.end - 1)))
+                --slice.end;
+            return slice;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        sf::String sliceToString(Slice slice)
+        {
+            for (const char* c = slice.begin; c < slice.end; ++c)
+            {
+                if (static_cast<unsigned char>(*c) >= 128)
+                    return sf::String{std::string(slice.begin, slice.end)};
+            }
+
+            // ASCII characters can be copied directly without the locale conversion that sf::String would perform
+            return sf::String{std::basic_string<sf::Uint32>(slice.begin, slice.end)};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         // Forward declare one of the functions to solve circular dependency
-        std::string parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const std::string& sectionName);
+        std::string parseSection(Input& input, const std::unique_ptr<DataIO::Node>& node, const std::string& sectionName);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string readWord(std::stringstream& stream)
+        std::string readWord(Input& input)
         {
             std::string word = "";
-            while (stream.peek() != EOF)
+            while (input.peek() != EOF)
             {
-                char c = stream.peek();
+                char c = static_cast<char>(input.peek());
                 if (c == '\r')
                 {
-                    stream.read(&c, 1);
+                    input.get();
                     return word;
                 }
-                else if (!::isspace(c) && (c != '=') && (c != ';') && (c != '{') && (c != '}'))
+                else if (!isWhitespace(c) && (c != '=') && (c != ';') && (c != '{') && (c != '}'))
                 {
-                    stream.read(&c, 1);
+                    input.get();
 
-                    if ((c == '/') && (stream.peek() == '/'))
+                    if ((c == '/') && (input.peek() == '/'))
                     {
-                        while (stream.peek() != EOF)
+                        while (input.peek() != EOF)
                         {
-                            stream.read(&c, 1);
-                            if (c == '\n')
+                            if (input.get() == '\n')
                             {
                                 assert(!word.empty()); // No known case in which you can pass here with an empty word
                                 return word;
                             }
                         }
                     }
-                    else if ((c == '/') && (stream.peek() == '*'))
+                    else if ((c == '/') && (input.peek() == '*'))
                     {
-                        while (stream.peek() != EOF)
+                        while (input.peek() != EOF)
                         {
-                            stream.read(&c, 1);
-                            if (c == '*')
+                            if (input.get() == '*')
                             {
-                                if (stream.peek() == '/')
+                                if (input.peek() == '/')
                                 {
-                                    stream.read(&c, 1);
+                                    input.get();
                                     break;
                                 }
                             }
@@ -140,13 +214,12 @@ namespace tgui
                     }
                     else if (c == '"')
                     {
-                        word.push_back(c);
+                        // Copy the quoted part at once
+                        const char* const quoteStart = input.pos - 1;
                         bool backslash = false;
-                        while (stream.peek() != EOF)
+                        while (input.peek() != EOF)
                         {
-                            stream.read(&c, 1);
-                            word.push_back(c);
-
+                            c = input.get();
                             if (c == '"' && !backslash)
                                 break;
 
@@ -155,6 +228,8 @@ namespace tgui
                             else
                                 backslash = false;
                         }
+
+                        word.append(quoteStart, input.pos);
                     }
                     else
                         word.push_back(c);
@@ -168,37 +243,104 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string readLine(std::stringstream& stream)
+        // Reads a value from the input, without removing the whitespace in front of it. Comments are removed and consecutive
+        // whitespace is replaced by a single space. The returned slice points directly into the input when no such changes
+        // were needed, which is the case for almost all values. An empty slice is returned when no value could be read.
+        Slice readLine(Input& input)
         {
-            std::string line;
+            // Try to find the end of the value without having to modify anything
+            const char* const start = input.pos;
+            const char* pos = start;
             bool whitespaceFound = false;
-            while (stream.peek() != EOF)
+            while (pos < input.end)
+            {
+                const char c = *pos;
+                if (c == '"')
+                {
+                    ++pos;
+                    bool backslash = false;
+                    while (pos < input.end)
+                    {
+                        const char quotedChar = *pos++;
+                        if (quotedChar == '"' && !backslash)
+                            break;
+
+                        if (quotedChar == '\\' && !backslash)
+                            backslash = true;
+                        else
+                            backslash = false;
+                    }
+
+                    // A quote directly behind the quoted part doesn't start a new one
+                    if ((pos < input.end) && (*pos == '"'))
+                    {
+                        whitespaceFound = false;
+                        ++pos;
+                    }
+                }
+                else if ((c == '=') || (c == '{'))
+                {
+                    input.pos = pos;
+                    return {};
+                }
+                else if ((c == ';') || (c == '}'))
+                {
+                    input.pos = pos;
+                    return trimSlice({start, pos});
+                }
+                else if (c == '/')
+                    break;
+                else if (isWhitespace(c))
+                {
+                    if ((c != ' ') || whitespaceFound)
+                        break;
+
+                    whitespaceFound = true;
+                    ++pos;
+                }
+                else
+                {
+                    whitespaceFound = false;
+                    ++pos;
+                }
+            }
+
+            if (pos == input.end)
             {
-                char c = stream.peek();
+                input.pos = pos;
+                return {};
+            }
+
+            // The value contains comments or whitespace that has to be collapsed, so copy it into the buffer
+            std::string& line = input.buffer;
+            line.clear();
+            whitespaceFound = false;
+            while (input.peek() != EOF)
+            {
+                char c = static_cast<char>(input.peek());
 
-                if (stream.peek() == '/')
+                if (input.peek() == '/')
                 {
-                    stream.read(&c, 1);
-                    if (stream.peek() == '/')
+                    input.get();
+                    if (input.peek() == '/')
                     {
-                        while (stream.peek() != EOF)
+                        while (input.peek() != EOF)
                         {
-                            stream.read(&c, 1);
-                            if (c == '\n')
+                            if (input.get() == '\n')
                                 break;
                         }
                     }
-                    else if (stream.peek() == '*')
+                    else if (input.peek() == '*')
                     {
-                        while (stream.peek() != EOF)
+                        while (input.peek() != EOF)
                         {
-                            stream.read(&c, 1);
-                            if (stream.peek() == '*')
+                            input.get();
+                            if (input.peek() == '*')
                             {
-                                stream.read(&c, 1);
-                                if (stream.peek() == '/')
+                                input.get();
+                                if (input.peek() == '/')
                                 {
-                                    stream.read(&c, 1);
+                                    input.get();
                                     break;
                                 }
                             }
@@ -206,20 +348,19 @@ namespace tgui
                         continue;
                     }
                     else
-                        return "";
+                        return {};
 
                     continue;
                 }
 
                 if (c == '"')
                 {
-                    stream.read(&c, 1);
-                    line.push_back(c);
+                    line.push_back(input.get());
 
                     bool backslash = false;
-                    while (stream.peek() != EOF)
+                    while (input.peek() != EOF)
                     {
-                        stream.read(&c, 1);
+                        c = input.get();
                         line.push_back(c);
 
                         if (c == '"' && !backslash)
@@ -231,23 +372,19 @@ namespace tgui
                             backslash = false;
                     }
 
-                    if (stream.peek() == EOF)
-                        return "";
+                    if (input.peek() == EOF)
+                        return {};
 
-                    c = stream.peek();
+                    c = static_cast<char>(input.peek());
                 }
 
                 if ((c == '=') || (c == '{'))
-                    return "";
+                    return {};
                 else if ((c == ';') || (c == '}'))
+                    return trimSlice({line.data(), line.data() + line.size()});
+                else if (isWhitespace(c))
                 {
-                    // Remove trailing whitespace before returning the line
-                    line.erase(line.find_last_not_of(" \n\r\t")+1);
-                    return line;
-                }
-                else if (::isspace(c))
-                {
-                    stream.read(&c, 1);
+                    input.get();
                     if (!whitespaceFound)
                     {
                         whitespaceFound = true;
@@ -258,88 +395,79 @@ namespace tgui
                 {
                     whitespaceFound = false;
                     line.push_back(c);
-                    stream.read(&c, 1);
+                    input.get();
                 }
             }
 
-            return "";
+            return {};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string parseKeyValue(std::stringstream& stream, std::unique_ptr<DataIO::Node>& node, const std::string& key)
+        std::string parseKeyValue(Input& input, const std::unique_ptr<DataIO::Node>& node, const std::string& key)
         {
-            // Read the assignment symbol from the stream and remove the whitespace behind it
-            char chr;
-            stream.read(&chr, 1);
+            // Read the assignment symbol from the input and remove the whitespace behind it
+            input.get();
 
             REMOVE_WHITESPACE_AND_COMMENTS(true)
 
             // Check for subsection as value
-            if (stream.peek() == '{')
-                return parseSection(stream, node, key);
+            if (input.peek() == '{')
+                return parseSection(input, node, key);
 
             // Read the value
-            std::string line = trim(readLine(stream));
+            const Slice line = readLine(input);
             if (!line.empty())
             {
                 // Remove the ';' if it is there
-                if (stream.peek() == ';')
-                    stream.read(&chr, 1);
+                if (input.peek() == ';')
+                    input.get();
 
                 // Create a value node to store the value
                 auto valueNode = make_unique<DataIO::ValueNode>();
-                valueNode->value = line;
+                valueNode->value = sliceToString(line);
 
                 // It might be a list node
-                if ((line.size() >= 2) && (line[0] == '[') && (line.back() == ']'))
+                const std::size_t lineSize = static_cast<std::size_t>(line.end - line.begin);
+                if ((lineSize >= 2) && (*line.begin == '[') && (*(line.end - 1) == ']'))
                 {
                     valueNode->listNode = true;
-                    if (line.size() >= 3)
+                    if (lineSize >= 3)
                     {
-                        valueNode->valueList.push_back("");
-
-                        std::size_t i = 1;
-                        while (i < line.size()-1)
+                        // Split the list on the commas that aren't part of a quoted string
+                        const char* const listEnd = line.end - 1;
+                        const char* elementStart = line.begin + 1;
+                        const char* pos = elementStart;
+                        while (pos < listEnd)
                         {
-                            if (line[i] == ',')
+                            if (*pos == ',')
                             {
-                                i++;
-                                valueNode->valueList.back() = trim(valueNode->valueList.back());
-                                valueNode->valueList.push_back("");
+                                valueNode->valueList.push_back(sliceToString(trimSlice({elementStart, pos})));
+                                ++pos;
+                                elementStart = pos;
                             }
-                            else if (line[i] == '"')
+                            else if (*pos == '"')
                             {
-                                valueNode->valueList.back().insert(valueNode->valueList.back().getSize(), line[i]);
-                                i++;
+                                ++pos;
 
                                 bool backslash = false;
-                                while (i < line.size()-1)
+                                while (pos < listEnd)
                                 {
-                                    valueNode->valueList.back().insert(valueNode->valueList.back().getSize(), line[i]);
-
-                                    if (line[i] == '"' && !backslash)
-                                    {
-                                        i++;
+                                    const char c = *pos++;
+                                    if (c == '"' && !backslash)
                                         break;
-                                    }
 
-                                    if (line[i] == '\\' && !backslash)
+                                    if (c == '\\' && !backslash)
                                         backslash = true;
                                     else
                                         backslash = false;
-
-                                    i++;
                                 }
                             }
                             else
-                            {
-                                valueNode->valueList.back().insert(valueNode->valueList.back().getSize(), line[i]);
-                                i++;
-                            }
+                                ++pos;
                         }
 
-                        valueNode->valueList.back() = trim(valueNode->valueList.back());
+                        valueNode->valueList.push_back(sliceToString(trimSlice({elementStart, listEnd})));
                     }
                 }
 
@@ -348,11 +476,11 @@ namespace tgui
             }
             else
             {
-                if (stream.peek() == EOF)
+                if (input.peek() == EOF)
                     return "Found EOF while trying to read a value.";
                 else
                 {
-                    chr = stream.peek();
+                    const int chr = input.peek();
                     if (chr == '=')
                         return "Found '=' while trying to read a value.";
                     else if (chr == '{')
@@ -365,59 +493,58 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const std::string& sectionName)
+        std::string parseSection(Input& input, const std::unique_ptr<DataIO::Node>& node, const std::string& sectionName)
         {
             // Create a new node for this section
             auto sectionNode = make_unique<DataIO::Node>();
             sectionNode->parent = node.get();
             sectionNode->name = sectionName;
 
-            // Read the brace from the stream
-            char chr;
-            stream.read(&chr, 1);
+            // Read the brace from the input
+            input.get();
 
-            while (stream.peek() != EOF)
+            while (input.peek() != EOF)
             {
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
 
-                std::string word = readWord(stream);
+                std::string word = readWord(input);
                 if (word == "")
                 {
-                    if (stream.peek() == EOF)
+                    if (input.peek() == EOF)
                         return "Found EOF while trying to read property or nested section name.";
-                    else if (stream.peek() == '}')
+                    else if (input.peek() == '}')
                     {
                         node->children.push_back(std::move(sectionNode));
 
-                        stream.read(&chr, 1);
+                        input.get();
 
                         // Ignore semicolon behind closing brace
                         REMOVE_WHITESPACE_AND_COMMENTS(false)
-                        if (stream.peek() == ';')
-                            stream.read(&chr, 1);
+                        if (input.peek() == ';')
+                            input.get();
 
                         REMOVE_WHITESPACE_AND_COMMENTS(false)
                         return "";
                     }
-                    else if (stream.peek() != '{')
-                        return "Expected property or nested section name, found '" + std::string(1, stream.peek()) + "' instead.";
+                    else if (input.peek() != '{')
+                        return "Expected property or nested section name, found '" + std::string(1, static_cast<char>(input.peek())) + "' instead.";
                 }
 
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
-                if (stream.peek() == '{')
+                if (input.peek() == '{')
                 {
-                    std::string error = parseSection(stream, sectionNode, word);
+                    std::string error = parseSection(input, sectionNode, word);
                     if (!error.empty())
                         return error;
                 }
-                else if (stream.peek() == '=')
+                else if (input.peek() == '=')
                 {
-                    std::string error = parseKeyValue(stream, sectionNode, word);
+                    std::string error = parseKeyValue(input, sectionNode, word);
                     if (!error.empty())
                         return error;
                 }
                 else
-                    return "Expected '{' or '=', found '" + std::string(1, stream.peek()) + "' instead.";
+                    return "Expected '{' or '=', found '" + std::string(1, static_cast<char>(input.peek())) + "' instead.";
             }
 
             return "Found EOF while reading section.";
@@ -425,25 +552,25 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string parseRootSection(std::stringstream& stream, std::unique_ptr<DataIO::Node>& root)
+        std::string parseRootSection(Input& input, const std::unique_ptr<DataIO::Node>& root)
         {
             REMOVE_WHITESPACE_AND_COMMENTS(false)
 
-            std::string word = readWord(stream);
+            std::string word = readWord(input);
             if (word == "")
             {
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
-                if (stream.peek() != '{')
-                    return "Expected section name, found '" + std::string(1, stream.peek()) + "' instead.";
+                if (input.peek() != '{')
+                    return "Expected section name, found '" + std::string(1, static_cast<char>(input.peek())) + "' instead.";
             }
 
             REMOVE_WHITESPACE_AND_COMMENTS(true)
-            if (stream.peek() == '{')
-                return parseSection(stream, root, word);
-            else if (stream.peek() == '=')
-                return parseKeyValue(stream, root, word);
+            if (input.peek() == '{')
+                return parseSection(input, root, word);
+            else if (input.peek() == '=')
+                return parseKeyValue(input, root, word);
             else
-                return "Expected '{' or '=', found '" + std::string(1, stream.peek()) + "' instead.";
+                return "Expected '{' or '=', found '" + std::string(1, static_cast<char>(input.peek())) + "' instead.";
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -482,25 +609,199 @@ namespace tgui
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Identifies the binary format, the last character is the version of the format
+        const char binaryHeader[] = {'T', 'G', 'U', 'I', 'B', 'I', 'N', 1};
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void writeUint32(std::string& output, std::uint32_t value)
+        {
+            // The bytes are always stored in little-endian order
+            for (unsigned int i = 0; i < 4; ++i)
+                output.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void writeString(std::string& output, const std::string& str)
+        {
+            writeUint32(output, static_cast<std::uint32_t>(str.size()));
+            output.append(str);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void writeString(std::string& output, const sf::String& str)
+        {
+            const std::basic_string<sf::Uint8> utf8 = str.toUtf8();
+            writeUint32(output, static_cast<std::uint32_t>(utf8.size()));
+            output.append(utf8.begin(), utf8.end());
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void writeNode(std::string& output, const DataIO::Node& node)
+        {
+            writeString(output, node.name);
+
+            writeUint32(output, static_cast<std::uint32_t>(node.propertyValuePairs.size()));
+            for (const auto& pair : node.propertyValuePairs)
+            {
+                writeString(output, pair.first);
+                writeString(output, pair.second->value);
+                output.push_back(pair.second->listNode ? 1 : 0);
+
+                writeUint32(output, static_cast<std::uint32_t>(pair.second->valueList.size()));
+                for (const auto& listValue : pair.second->valueList)
+                    writeString(output, listValue);
+            }
+
+            writeUint32(output, static_cast<std::uint32_t>(node.children.size()));
+            for (const auto& child : node.children)
+                writeNode(output, *child);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Binary data that is being loaded, every read is checked against the end of the data
+        struct BinaryInput
+        {
+            const char* pos;
+            const char* end;
+
+            void require(std::size_t size) const
+            {
+                if (static_cast<std::size_t>(end - pos) < size)
+                    throw Exception{"Error while loading binary data. Unexpected end of data."};
+            }
+
+            char readByte()
+            {
+                require(1);
+                return *pos++;
+            }
+
+            std::uint32_t readUint32()
+            {
+                require(4);
+                std::uint32_t value = 0;
+                for (unsigned int i = 0; i < 4; ++i)
+                    value |= static_cast<std::uint32_t>(static_cast<unsigned char>(*pos++)) << (8 * i);
+                return value;
+            }
+
+            std::string readString()
+            {
+                const std::uint32_t size = readUint32();
+                require(size);
+                std::string str(pos, size);
+                pos += size;
+                return str;
+            }
+
+            sf::String readUtf8String()
+            {
+                const std::uint32_t size = readUint32();
+                require(size);
+                const sf::String str = sf::String::fromUtf8(pos, pos + size);
+                pos += size;
+                return str;
+            }
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Nodes in damaged data could be nested deep enough to overflow the stack while they are read recursively
+        const unsigned int maxBinaryNodeDepth = 1000;
+
+        void readNode(BinaryInput& input, DataIO::Node& node, unsigned int depth)
+        {
+            if (depth > maxBinaryNodeDepth)
+                throw Exception{"Error while loading binary data. Nodes are nested too deep."};
+
+            node.name = input.readString();
+
+            const std::uint32_t propertyCount = input.readUint32();
+            for (std::uint32_t i = 0; i < propertyCount; ++i)
+            {
+                std::string key = input.readString();
+
+                auto valueNode = make_unique<DataIO::ValueNode>(input.readUtf8String());
+                valueNode->listNode = (input.readByte() != 0);
+
+                const std::uint32_t listSize = input.readUint32();
+                for (std::uint32_t j = 0; j < listSize; ++j)
+                    valueNode->valueList.push_back(input.readUtf8String());
+
+                node.propertyValuePairs[std::move(key)] = std::move(valueNode);
+            }
+
+            const std::uint32_t childCount = input.readUint32();
+            for (std::uint32_t i = 0; i < childCount; ++i)
+            {
+                auto child = make_unique<DataIO::Node>();
+                child->parent = &node;
+                readNode(input, *child, depth + 1);
+                node.children.push_back(std::move(child));
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Filename in the binary cache for a widget file with the given contents
+        std::string getCacheFilename(const std::string& contents)
+        {
+            // 64-bit FNV-1a hash
+            std::uint64_t hash = 14695981039346656037ULL;
+            for (const char c : contents)
+            {
+                hash ^= static_cast<unsigned char>(c);
+                hash *= 1099511628211ULL;
+            }
+
+            const char hexDigits[] = "0123456789abcdef";
+            std::string filename = getBinaryCachePath();
+            for (int i = 60; i >= 0; i -= 4)
+                filename.push_back(hexDigits[(hash >> i) & 0xF]);
+
+            return filename + "-" + to_string(contents.size()) + ".tguibin";
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::unique_ptr<DataIO::Node> DataIO::parse(std::stringstream& stream)
+    {
+        const std::string contents = stream.str();
+
+        // Only the part of the stream that wasn't read yet has to be parsed
+        const auto position = stream.tellg();
+        std::size_t start = contents.size();
+        if (position != std::stringstream::pos_type(-1))
+            start = std::min(contents.size(), static_cast<std::size_t>(position));
+
+        stream.seekg(0, std::ios_base::end);
+        return parse(contents.data() + start, contents.size() - start);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> DataIO::parse(const char* data, std::size_t size)
     {
         auto root = make_unique<Node>();
 
-        std::string error;
-        while (stream.peek() != EOF)
+        Input input{data, data + size, {}};
+        while (input.peek() != EOF)
         {
-            error = parseRootSection(stream, root);
+            const std::string error = parseRootSection(input, root);
             if (!error.empty())
             {
-                if (stream.tellg() != std::stringstream::pos_type(-1))
+                if (input.pos < input.end)
                 {
-                    std::string str = stream.str();
-                    auto position = static_cast<std::iterator_traits<std::string::const_iterator>::difference_type>(stream.tellg());
-                    std::size_t lineNumber = std::count(str.begin(), str.begin() + position, '\n') + 1;
+                    const std::size_t lineNumber = std::count(data, input.pos, '\n') + 1;
                     throw Exception{"Error while parsing input at line " + to_string(lineNumber) + ". " + error};
                 }
                 else
@@ -536,6 +837,84 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::emitBinary(const std::unique_ptr<Node>& rootNode, std::string& output)
+    {
+        output.append(binaryHeader, sizeof(binaryHeader));
+        writeNode(output, *rootNode);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> DataIO::parseBinary(const char* data, std::size_t size)
+    {
+        if ((size < sizeof(binaryHeader)) || !std::equal(binaryHeader, binaryHeader + sizeof(binaryHeader), data))
+            throw Exception{"Error while loading binary data. The data wasn't created by this version of TGUI."};
+
+        BinaryInput input{data + sizeof(binaryHeader), data + size};
+
+        auto root = make_unique<Node>();
+        readNode(input, *root, 0);
+
+        if (input.pos != input.end)
+            throw Exception{"Error while loading binary data. Unexpected data found after the root node."};
+
+        return root;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> DataIO::parseWithCache(const std::string& contents)
+    {
+        if (getBinaryCachePath().empty())
+            return parse(contents.data(), contents.size());
+
+        const std::string cacheFilename = getCacheFilename(contents);
+        std::ifstream cacheFile{cacheFilename, std::ios::binary};
+        if (cacheFile.is_open())
+        {
+            const std::string binary{std::istreambuf_iterator<char>{cacheFile}, std::istreambuf_iterator<char>{}};
+            try
+            {
+                return parseBinary(binary.data(), binary.size());
+            }
+            catch (const Exception&)
+            {
+                // The cached file is damaged or outdated, it will be replaced below
+            }
+        }
+
+        auto root = parse(contents.data(), contents.size());
+
+        // Failing to write the cache is not an error, the file will just have to be parsed again next time
+        std::string binary;
+        emitBinary(root, binary);
+
+        // The data is written to a temporary file that is renamed afterwards, so that another process that loads the same
+        // contents never reads a cache file that is only partially written
+        const std::string tempFilename = cacheFilename + "." + to_string(std::random_device{}()) + ".tmp";
+        {
+            std::ofstream output{tempFilename, std::ios::binary};
+            if (!output.is_open())
+                return root;
+
+            output.write(binary.data(), static_cast<std::streamsize>(binary.size()));
+            if (!output)
+            {
+                output.close();
+                std::remove(tempFilename.c_str());
+                return root;
+            }
+        }
+
+        // Renaming fails on some systems when the cache file was created by another process in the meantime
+        if (std::rename(tempFilename.c_str(), cacheFilename.c_str()) != 0)
+            std::remove(tempFilename.c_str());
+
+        return root;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
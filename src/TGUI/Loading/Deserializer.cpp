@@ -25,6 +25,7 @@
 
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/FontManager.hpp>
 #include <TGUI/Renderers/WidgetRenderer.hpp>
 #include <TGUI/Global.hpp>
 #include <cstdint>
@@ -95,18 +96,16 @@ namespace tgui
             if (filename.isEmpty())
                 return Font{};
 
-            // Load the font but insert the resource path into the filename unless the filename is an absolute path
-            auto font = std::make_shared<sf::Font>();
+            // Load the font but insert the resource path into the filename unless the filename is an absolute path.
+            // Fonts are shared between all widgets that load the same file.
         #ifdef SFML_SYSTEM_WINDOWS
             if ((filename[0] != '/') && (filename[0] != '\\') && ((filename.getSize() <= 1) || (filename[1] != ':')))
         #else
             if (filename[0] != '/')
         #endif
-                font->loadFromFile(getResourcePath() + filename);
+                return Font(FontManager::getFont(getResourcePath() + filename));
             else
-                font->loadFromFile(filename);
-
-            return Font(font);
+                return Font(FontManager::getFont(filename));
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -388,18 +387,8 @@ namespace tgui
             if (node->propertyValuePairs.empty() && (node->children.size() == 1))
                 node = std::move(node->children[0]);
 
-            auto rendererData = RendererData::create();
-            for (const auto& pair : node->propertyValuePairs)
-                rendererData->propertyValuePairs[pair.first] = ObjectConverter(pair.second->value); // Did not compile with VS2015 Update 2 when using braces
-
-            for (const auto& child : node->children)
-            {
-                std::stringstream ss2;
-                DataIO::emit(child, ss2);
-                rendererData->propertyValuePairs[toLower(child->name)] = {sf::String{"{\n" + ss2.str() + "}"}};
-            }
-
-            return rendererData;
+            // The nested renderers are created from the parsed nodes, so the text is only parsed once
+            return RendererData::createFromDataIONode(node.get());
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
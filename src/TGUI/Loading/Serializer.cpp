@@ -166,7 +166,7 @@ namespace tgui
                             + ", " + to_string(texture.getData()->rect.width) + ", " + to_string(texture.getData()->rect.height) + ")";
             }
 
-            if (texture.getMiddleRect() != sf::IntRect{0, 0, static_cast<int>(texture.getData()->texture.getSize().x), static_cast<int>(texture.getData()->texture.getSize().y)})
+            if (texture.getMiddleRect() != sf::IntRect{0, 0, static_cast<int>(texture.getData()->getSize().x), static_cast<int>(texture.getData()->getSize().y)})
             {
                 result += " Middle(" + to_string(texture.getMiddleRect().left) + ", " + to_string(texture.getMiddleRect().top)
                               + ", " + to_string(texture.getMiddleRect().width) + ", " + to_string(texture.getMiddleRect().height) + ")";
@@ -205,25 +205,34 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string serializeRendererData(ObjectConverter&& value)
+        // Property names in nested renderers are written in lowercase, just like when they would have been parsed
+        std::unique_ptr<DataIO::Node> rendererDataToNode(const RendererData& rendererData, bool nested)
         {
             auto node = make_unique<DataIO::Node>();
-            for (const auto& pair : value.getRenderer()->propertyValuePairs)
+            for (const auto& pair : rendererData.propertyValuePairs)
             {
-                sf::String strValue;
+                // Nested renderers are added as child nodes, so that the whole tree is only emitted once
                 if (pair.second.getType() == ObjectConverter::Type::RendererData)
                 {
-                    std::stringstream ss{ObjectConverter{pair.second}.getString()};
-                    node->children.push_back(DataIO::parse(ss));
+                    node->children.push_back(rendererDataToNode(*ObjectConverter{pair.second}.getRenderer(), true));
                     node->children.back()->name = pair.first;
                 }
                 else
                 {
-                    strValue = ObjectConverter{pair.second}.getString();
-                    node->propertyValuePairs[pair.first] = make_unique<DataIO::ValueNode>(strValue);
+                    const std::string name = nested ? toLower(pair.first) : pair.first;
+                    node->propertyValuePairs[name] = make_unique<DataIO::ValueNode>(ObjectConverter{pair.second}.getString());
                 }
             }
 
+            return node;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::string serializeRendererData(ObjectConverter&& value)
+        {
+            const auto node = rendererDataToNode(*value.getRenderer(), false);
+
             std::stringstream ss;
             DataIO::emit(node, ss);
             return ss.str();
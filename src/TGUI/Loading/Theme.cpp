@@ -259,51 +259,26 @@ namespace tgui
             auto& properties = m_themeLoader->load(m_primary, pair.first);
 
             // Update the property-value pairs of the renderer
-            renderer->propertyValuePairs = std::map<std::string, ObjectConverter>{};
+            renderer->propertyValuePairs.clear();
             for (const auto& property : properties)
                 renderer->propertyValuePairs[property.first] = ObjectConverter(property.second);
 
-            // Tell the widgets that were using this renderer about all the updated properties, both new ones and old ones that were now reset to their default value
-            auto oldIt = oldData->propertyValuePairs.begin();
-            auto newIt = renderer->propertyValuePairs.begin();
-            while (oldIt != oldData->propertyValuePairs.end() && newIt != renderer->propertyValuePairs.end())
+            // Tell the widgets that were using this renderer about all the updated properties, both new ones and old ones that were now reset to their default value.
+            // The properties are accessed by position because the widgets may add default values to the renderer.
+            for (const auto& oldProperty : oldData->propertyValuePairs)
             {
-                if (oldIt->first < newIt->first)
+                if (renderer->propertyValuePairs.find(oldProperty.first) == renderer->propertyValuePairs.end())
                 {
-                    // Update values that no longer exist in the new renderer and are now reset to the default value
                     for (const auto& observer : renderer->observers)
-                        observer.second(oldIt->first);
-
-                    ++oldIt;
-                }
-                else
-                {
-                    // Update changed and new properties
-                    for (const auto& observer : renderer->observers)
-                        observer.second(newIt->first);
-
-                    if (newIt->first < oldIt->first)
-                        ++newIt;
-                    else
-                    {
-                        ++oldIt;
-                        ++newIt;
-                    }
+                        observer.second(oldProperty.first);
                 }
             }
-            while (oldIt != oldData->propertyValuePairs.end())
-            {
-                for (const auto& observer : renderer->observers)
-                    observer.second(oldIt->first);
 
-                ++oldIt;
-            }
-            while (newIt != renderer->propertyValuePairs.end())
+            const std::size_t propertyCount = renderer->propertyValuePairs.size();
+            for (std::size_t i = 0; i < propertyCount; ++i)
             {
                 for (const auto& observer : renderer->observers)
-                    observer.second(newIt->first);
-
-                ++newIt;
+                    observer.second((renderer->propertyValuePairs.begin() + i)->first);
             }
         }
     }
@@ -121,7 +121,9 @@ namespace tgui
                     // Resolve references recursively
                     resolveReferences(sections, sectionsIt->second);
 
-                    // Make a copy of the section
+                    // Make a copy of the section. Theme loaders pass their properties as strings (see BaseThemeLoader::load), so the
+                    // copy is stored as text. It is only parsed once, when the renderer is first used, as the nested renderers in it
+                    // are then created directly from the parsed nodes.
                     std::stringstream ss;
                     DataIO::emit(sectionsIt->second, ss);
                     pair.second->value = "{\n" + ss.str() + "}";
@@ -175,7 +177,7 @@ namespace tgui
             std::stringstream fileContents;
             readFile(filename, fileContents);
 
-            std::unique_ptr<DataIO::Node> root = DataIO::parse(fileContents);
+            std::unique_ptr<DataIO::Node> root = DataIO::parseWithCache(fileContents.str());
 
             if (root->propertyValuePairs.size() != 0)
                 throw Exception{"Unexpected result while loading theme file '" + filename + "'. Root property-value pair found."};
@@ -206,6 +208,7 @@ namespace tgui
                 for (const auto& pair : child.get()->propertyValuePairs)
                     m_propertiesCache[filename][name][toLower(pair.first)] = pair.second->value;
 
+                // Nested sections are stored as text for the same reason as the resolved references
                 for (const auto& nestedProperty : child.get()->children)
                 {
                     std::stringstream ss;
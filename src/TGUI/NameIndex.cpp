@@ -0,0 +1,108 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/NameIndex.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        std::size_t NameIndex::NameHash::operator()(const sf::String& name) const
+        {
+            // FNV-1a over the UTF-32 characters
+            std::uint64_t hash = 14695981039346656037ULL;
+            for (const auto c : name)
+            {
+                hash ^= c;
+                hash *= 1099511628211ULL;
+            }
+
+            return static_cast<std::size_t>(hash);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void NameIndex::insert(const sf::String& name, const std::shared_ptr<Widget>& widget)
+        {
+            if (name.isEmpty())
+                return;
+
+            m_widgets[name].push_back(widget);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void NameIndex::remove(const sf::String& name, const Widget* widget)
+        {
+            auto it = m_widgets.find(name);
+            if (it == m_widgets.end())
+                return;
+
+            auto& widgets = it->second;
+            widgets.erase(std::remove_if(widgets.begin(), widgets.end(), [widget](const std::weak_ptr<Widget>& weakWidget){
+                    const auto sharedWidget = weakWidget.lock();
+                    return !sharedWidget || (sharedWidget.get() == widget);
+                }), widgets.end());
+
+            if (widgets.empty())
+                m_widgets.erase(it);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const std::vector<std::weak_ptr<Widget>>* NameIndex::find(const sf::String& name) const
+        {
+            const auto it = m_widgets.find(name);
+            if (it != m_widgets.end())
+                return &it->second;
+            else
+                return nullptr;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void NameIndex::clear()
+        {
+            m_widgets.clear();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t NameIndex::getNameCount() const
+        {
+            return m_widgets.size();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,265 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/RendererPropertyMap.hpp>
+#include <TGUI/Global.hpp>
+
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        using IdEntry = std::pair<priv::PropertyId, std::size_t>;
+
+        bool compareIds(const IdEntry& left, priv::PropertyId right)
+        {
+            return left.first < right;
+        }
+
+        bool equalsIgnoringCase(const std::string& key, const char* name)
+        {
+            for (const char c : key)
+            {
+                const char n = *name++;
+                if ((n == '\0') || (c != (((n >= 'A') && (n <= 'Z')) ? (n - 'A' + 'a') : n)))
+                    return false;
+            }
+
+            return *name == '\0';
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace priv
+    {
+        PropertyId makePropertyId(const std::string& name)
+        {
+            PropertyId hash = 14695981039346656037ULL;
+            for (const char c : name)
+            {
+                hash ^= static_cast<unsigned char>(((c >= 'A') && (c <= 'Z')) ? (c - 'A' + 'a') : c);
+                hash *= 1099511628211ULL;
+            }
+
+            return hash;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::RendererPropertyMap(const Map& map)
+    {
+        for (const auto& pair : map)
+            add(priv::makePropertyId(pair.first), pair.first)->second = pair.second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter& RendererPropertyMap::operator[](const std::string& property)
+    {
+        const auto it = find(property);
+        if (it != m_properties.end())
+            return it->second;
+        else
+            return add(priv::makePropertyId(property), property)->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::iterator RendererPropertyMap::find(const std::string& property)
+    {
+        const priv::PropertyId id = priv::makePropertyId(property);
+        for (auto it = std::lower_bound(m_ids.begin(), m_ids.end(), id, &compareIds); (it != m_ids.end()) && (it->first == id); ++it)
+        {
+            if (m_properties[it->second].first == property)
+                return m_properties.begin() + it->second;
+        }
+
+        return m_properties.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::const_iterator RendererPropertyMap::find(const std::string& property) const
+    {
+        const priv::PropertyId id = priv::makePropertyId(property);
+        for (auto it = std::lower_bound(m_ids.begin(), m_ids.end(), id, &compareIds); (it != m_ids.end()) && (it->first == id); ++it)
+        {
+            if (m_properties[it->second].first == property)
+                return m_properties.begin() + it->second;
+        }
+
+        return m_properties.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::iterator RendererPropertyMap::find(priv::PropertyId id, const char* name)
+    {
+        // Different names can have the same identifier, so the key is compared to make sure it is the requested property
+        for (auto it = std::lower_bound(m_ids.begin(), m_ids.end(), id, &compareIds); (it != m_ids.end()) && (it->first == id); ++it)
+        {
+            if (equalsIgnoringCase(m_properties[it->second].first, name))
+                return m_properties.begin() + it->second;
+        }
+
+        return m_properties.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::const_iterator RendererPropertyMap::find(priv::PropertyId id, const char* name) const
+    {
+        // Different names can have the same identifier, so the key is compared to make sure it is the requested property
+        for (auto it = std::lower_bound(m_ids.begin(), m_ids.end(), id, &compareIds); (it != m_ids.end()) && (it->first == id); ++it)
+        {
+            if (equalsIgnoringCase(m_properties[it->second].first, name))
+                return m_properties.begin() + it->second;
+        }
+
+        return m_properties.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::iterator RendererPropertyMap::insert(priv::PropertyId id, const char* name)
+    {
+        const auto it = find(id, name);
+        if (it != m_properties.end())
+            return it;
+        else
+            return add(id, toLower(name));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t RendererPropertyMap::erase(const std::string& property)
+    {
+        const auto it = find(property);
+        if (it == m_properties.end())
+            return 0;
+
+        const std::size_t index = static_cast<std::size_t>(it - m_properties.begin());
+        m_ids.erase(findIdEntry(priv::makePropertyId(property), index));
+
+        // Move the last property into the gap so that the positions of the other properties don't change
+        const std::size_t lastIndex = m_properties.size() - 1;
+        if (index != lastIndex)
+        {
+            findIdEntry(priv::makePropertyId(m_properties[lastIndex].first), lastIndex)->second = index;
+            m_properties[index] = std::move(m_properties[lastIndex]);
+        }
+
+        m_properties.pop_back();
+        return 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RendererPropertyMap::clear()
+    {
+        m_properties.clear();
+        m_ids.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t RendererPropertyMap::size() const
+    {
+        return m_properties.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool RendererPropertyMap::empty() const
+    {
+        return m_properties.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::iterator RendererPropertyMap::begin()
+    {
+        return m_properties.begin();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::const_iterator RendererPropertyMap::begin() const
+    {
+        return m_properties.begin();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::iterator RendererPropertyMap::end()
+    {
+        return m_properties.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::const_iterator RendererPropertyMap::end() const
+    {
+        return m_properties.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::Map RendererPropertyMap::getMap() const
+    {
+        return {m_properties.begin(), m_properties.end()};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::iterator RendererPropertyMap::add(priv::PropertyId id, std::string key)
+    {
+        m_ids.insert(std::upper_bound(m_ids.begin(), m_ids.end(), id, [](priv::PropertyId left, const IdEntry& right){ return left < right.first; }),
+                     {id, m_properties.size()});
+
+        m_properties.emplace_back(std::move(key), ObjectConverter{});
+        return m_properties.end() - 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::pair<priv::PropertyId, std::size_t>>::iterator RendererPropertyMap::findIdEntry(priv::PropertyId id, std::size_t index)
+    {
+        auto it = std::lower_bound(m_ids.begin(), m_ids.end(), id, &compareIds);
+        while (it->second != index)
+            ++it;
+
+        return it;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -34,19 +34,19 @@ namespace tgui
 
     void BoxLayoutRenderer::setSpaceBetweenWidgets(float distance)
     {
-        setProperty("spacebetweenwidgets", ObjectConverter{distance});
+        setProperty(priv::makePropertyId("spacebetweenwidgets"), "spacebetweenwidgets", ObjectConverter{distance});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     float BoxLayoutRenderer::getSpaceBetweenWidgets() const
     {
-        auto it = m_data->propertyValuePairs.find("spacebetweenwidgets");
+        auto it = m_data->propertyValuePairs.find(priv::makePropertyId("spacebetweenwidgets"), "spacebetweenwidgets");
         if (it != m_data->propertyValuePairs.end())
             return it->second.getNumber();
         else
         {
-            it = m_data->propertyValuePairs.find("padding");
+            it = m_data->propertyValuePairs.find(priv::makePropertyId("padding"), "padding");
             if (it != m_data->propertyValuePairs.end())
             {
                 const Padding padding = it->second.getOutline();
@@ -41,21 +41,21 @@ namespace tgui
         else if (opacity > 1)
             opacity = 1;
 
-        setProperty("opacity", ObjectConverter{opacity});
+        setProperty(priv::makePropertyId("opacity"), "opacity", ObjectConverter{opacity});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void WidgetRenderer::setFont(Font font)
     {
-        setProperty("font", font);
+        setProperty(priv::makePropertyId("font"), "font", font);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font WidgetRenderer::getFont() const
     {
-        auto it = m_data->propertyValuePairs.find("font");
+        auto it = m_data->propertyValuePairs.find(priv::makePropertyId("font"), "font");
         if (it != m_data->propertyValuePairs.end())
             return it->second.getFont();
         else
@@ -66,12 +66,20 @@ namespace tgui
 
     void WidgetRenderer::setProperty(const std::string& property, ObjectConverter&& value)
     {
-        std::string lowercaseProperty = toLower(property);
+        setProperty(priv::makePropertyId(property), property.c_str(), std::move(value));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        if (m_data->propertyValuePairs[lowercaseProperty] != value)
+    void WidgetRenderer::setProperty(priv::PropertyId id, const char* property, ObjectConverter&& value)
+    {
+        // The stored key is already lowercase, it remains valid while the observers add other properties
+        const auto it = m_data->propertyValuePairs.insert(id, property);
+        if (it->second != value)
         {
-            m_data->propertyValuePairs[lowercaseProperty] = value;
+            it->second = std::move(value);
 
+            const std::string& lowercaseProperty = it->first;
             for (const auto& observer : m_data->observers)
                 observer.second(lowercaseProperty);
         }
@@ -81,7 +89,7 @@ namespace tgui
 
     ObjectConverter WidgetRenderer::getProperty(const std::string& property) const
     {
-        auto it = m_data->propertyValuePairs.find(toLower(property));
+        auto it = m_data->propertyValuePairs.find(priv::makePropertyId(property), property.c_str());
         if (it != m_data->propertyValuePairs.end())
             return it->second;
         else
@@ -90,9 +98,9 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const std::map<std::string, ObjectConverter>& WidgetRenderer::getPropertyValuePairs() const
+    std::map<std::string, ObjectConverter> WidgetRenderer::getPropertyValuePairs() const
     {
-        return m_data->propertyValuePairs;
+        return m_data->propertyValuePairs.getMap();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,7 @@
 #include <TGUI/Widgets/ChildWindow.hpp>
 #include <TGUI/SignalImpl.hpp>
 
+#include <algorithm>
 #include <set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -57,6 +58,11 @@ namespace tgui
         m_name    {other.m_name},
         m_handlers{} // signal handlers are not copied with the widget
     {
+        if (other.m_ownedName)
+        {
+            m_ownedName = make_unique<const std::string>(*other.m_ownedName);
+            m_name = m_ownedName->c_str();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -66,7 +72,15 @@ namespace tgui
         if (this != &other)
         {
             m_name = other.m_name;
-            m_handlers.clear(); // signal handlers are not copied with the widget
+            m_handlers = nullptr; // signal handlers are not copied with the widget
+
+            if (other.m_ownedName)
+            {
+                m_ownedName = make_unique<const std::string>(*other.m_ownedName);
+                m_name = m_ownedName->c_str();
+            }
+            else
+                m_ownedName = nullptr;
         }
 
         return *this;
@@ -77,7 +91,7 @@ namespace tgui
     unsigned int Signal::connect(const Delegate& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = handler;
+        addHandler(id, handler);
         return id;
     }
 
@@ -88,9 +102,9 @@ namespace tgui
         const auto id = generateUniqueId();
     #ifdef TGUI_NO_CPP14
         std::string name = m_name;
-        m_handlers[id] = [handler, name](){ handler(getWidget(), name); };
+        addHandler(id, [handler, name](){ handler(getWidget(), name); });
     #else
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name); };
+        addHandler(id, [handler, name=std::string{m_name}](){ handler(getWidget(), name); });
     #endif
         return id;
     }
@@ -99,14 +113,57 @@ namespace tgui
 
     bool Signal::disconnect(unsigned int id)
     {
-        return m_handlers.erase(id) == 0;
+        if (!m_handlers || (id == 0))
+            return false;
+
+        auto& handlers = m_handlers->handlers;
+        for (auto it = handlers.begin(); it != handlers.end(); ++it)
+        {
+            if (it->id != id)
+                continue;
+
+            // The handler can't be erased while the signal is being emitted, it might be the one that is currently executing
+            if (m_handlers->emitDepth > 0)
+            {
+                it->id = 0;
+                m_handlers->disconnectedWhileEmitting = true;
+            }
+            else
+                handlers.erase(it);
+
+            return true;
+        }
+
+        auto& connectedWhileEmitting = m_handlers->connectedWhileEmitting;
+        for (auto it = connectedWhileEmitting.begin(); it != connectedWhileEmitting.end(); ++it)
+        {
+            if (it->id == id)
+            {
+                connectedWhileEmitting.erase(it);
+                return true;
+            }
+        }
+
+        return false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Signal::disconnectAll()
     {
-        m_handlers.clear();
+        if (!m_handlers)
+            return;
+
+        if (m_handlers->emitDepth > 0)
+        {
+            for (auto& handler : m_handlers->handlers)
+                handler.id = 0;
+
+            m_handlers->connectedWhileEmitting.clear();
+            m_handlers->disconnectedWhileEmitting = true;
+        }
+        else
+            m_handlers->handlers.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -118,12 +175,83 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Signal::addHandler(unsigned int id, std::function<void()> handler)
+    {
+        if (!m_handlers)
+            m_handlers = std::make_shared<HandlerList>();
+
+        // Adding to the list while it is being iterated could move the handler that is currently executing
+        if (m_handlers->emitDepth > 0)
+            m_handlers->connectedWhileEmitting.push_back({id, std::move(handler)});
+        else
+            m_handlers->handlers.push_back({id, std::move(handler)});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Signal::callHandlers(const void* const* parameters, std::size_t parameterCount)
+    {
+        if (!m_handlers || m_handlers->handlers.empty())
+            return false;
+
+        // Keep the handlers alive in case the widget (and this signal) gets destroyed during the handler
+        const std::shared_ptr<HandlerList> handlerList = m_handlers;
+
+        // Apply the changes that were made to the handlers while they were being called
+        const auto finishEmission = [&handlerList]{
+            if (--handlerList->emitDepth > 0)
+                return;
+
+            if (handlerList->disconnectedWhileEmitting)
+            {
+                auto& handlers = handlerList->handlers;
+                handlers.erase(std::remove_if(handlers.begin(), handlers.end(), [](const Handler& handler){ return handler.id == 0; }), handlers.end());
+                handlerList->disconnectedWhileEmitting = false;
+            }
+
+            for (auto& handler : handlerList->connectedWhileEmitting)
+                handlerList->handlers.push_back(std::move(handler));
+
+            handlerList->connectedWhileEmitting.clear();
+        };
+
+        bool handlerCalled = false;
+        const std::size_t handlerCount = handlerList->handlers.size();
+        ++handlerList->emitDepth;
+        try
+        {
+            for (std::size_t i = 0; i < handlerCount; ++i)
+            {
+                const Handler& handler = handlerList->handlers[i];
+                if (handler.id == 0)
+                    continue;
+
+                // A previous handler may have emitted another signal, which overwrote the parameters
+                for (std::size_t j = 0; j < parameterCount; ++j)
+                    internal_signal::parameters[j] = parameters[j];
+
+                handler.function();
+                handlerCalled = true;
+            }
+        }
+        catch (...)
+        {
+            finishEmission();
+            throw;
+        }
+
+        finishEmission();
+        return handlerCalled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     unsigned int Signal::validateTypes(std::initializer_list<std::type_index> unboundParameters)
     {
         if (unboundParameters.size() == 0)
             return 0;
         else
-            throw Exception{"Signal '" + m_name + "' could not provide data for unbound parameters."};
+            throw Exception{"Signal '" + std::string{m_name} + "' could not provide data for unbound parameters."};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -133,7 +261,7 @@ namespace tgui
     unsigned int Signal##TypeName::connect(const Delegate##TypeName& handler) \
     { \
         const auto id = generateUniqueId(); \
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<Type>(internal_signal::parameters[1])); }; \
+        addHandler(id, [handler](){ handler(internal_signal::dereference<Type>(internal_signal::parameters[1])); }); \
         return id; \
     } \
     \
@@ -141,7 +269,7 @@ namespace tgui
     { \
         const auto id = generateUniqueId(); \
         std::string name = m_name; \
-        m_handlers[id] = [handler, name](){ handler(getWidget(), name, internal_signal::dereference<Type>(internal_signal::parameters[1])); }; \
+        addHandler(id, [handler, name](){ handler(getWidget(), name, internal_signal::dereference<Type>(internal_signal::parameters[1])); }); \
         return id; \
     }
 #else
@@ -149,14 +277,14 @@ namespace tgui
     unsigned int Signal##TypeName::connect(const Delegate##TypeName& handler) \
     { \
         const auto id = generateUniqueId(); \
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<Type>(internal_signal::parameters[1])); }; \
+        addHandler(id, [handler](){ handler(internal_signal::dereference<Type>(internal_signal::parameters[1])); }); \
         return id; \
     } \
     \
     unsigned int Signal##TypeName::connect(const Delegate##TypeName##Ex& handler) \
     { \
         const auto id = generateUniqueId(); \
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<Type>(internal_signal::parameters[1])); }; \
+        addHandler(id, [handler, name=std::string{m_name}](){ handler(getWidget(), name, internal_signal::dereference<Type>(internal_signal::parameters[1])); }); \
         return id; \
     }
 #endif
@@ -257,7 +385,7 @@ namespace tgui
     unsigned int SignalRange::connect(const DelegateRange& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); };
+        addHandler(id, [handler](){ handler(internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); });
         return id;
     }
 
@@ -268,9 +396,9 @@ namespace tgui
         const auto id = generateUniqueId();
     #ifdef TGUI_NO_CPP14
         std::string name = m_name;
-        m_handlers[id] = [handler, name](){ handler(getWidget(), name, internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); };
+        addHandler(id, [handler, name](){ handler(getWidget(), name, internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); });
     #else
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); };
+        addHandler(id, [handler, name=std::string{m_name}](){ handler(getWidget(), name, internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); });
     #endif
         return id;
     }
@@ -279,12 +407,8 @@ namespace tgui
 
     bool SignalRange::emit(const Widget* widget, float start, float end)
     {
-        if (m_handlers.empty())
-            return false;
-
-        internal_signal::parameters[1] = static_cast<const void*>(&start);
-        internal_signal::parameters[2] = static_cast<const void*>(&end);
-        return Signal::emit(widget);
+        const void* parameters[] = {&widget, &start, &end};
+        return callHandlers(parameters, 3);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -306,7 +430,7 @@ namespace tgui
     unsigned int SignalChildWindow::connect(const DelegateChildWindow& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(std::static_pointer_cast<ChildWindow>(internal_signal::dereference<ChildWindow*>(internal_signal::parameters[1])->shared_from_this())); };
+        addHandler(id, [handler](){ handler(std::static_pointer_cast<ChildWindow>(internal_signal::dereference<ChildWindow*>(internal_signal::parameters[1])->shared_from_this())); });
         return id;
     }
 
@@ -317,9 +441,9 @@ namespace tgui
         const auto id = generateUniqueId();
     #ifdef TGUI_NO_CPP14
         std::string name = m_name;
-        m_handlers[id] = [handler, name](){ handler(getWidget(), name, std::static_pointer_cast<ChildWindow>(internal_signal::dereference<ChildWindow*>(internal_signal::parameters[1])->shared_from_this())); };
+        addHandler(id, [handler, name](){ handler(getWidget(), name, std::static_pointer_cast<ChildWindow>(internal_signal::dereference<ChildWindow*>(internal_signal::parameters[1])->shared_from_this())); });
     #else
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, std::static_pointer_cast<ChildWindow>(internal_signal::dereference<ChildWindow*>(internal_signal::parameters[1])->shared_from_this())); };
+        addHandler(id, [handler, name=std::string{m_name}](){ handler(getWidget(), name, std::static_pointer_cast<ChildWindow>(internal_signal::dereference<ChildWindow*>(internal_signal::parameters[1])->shared_from_this())); });
     #endif
         return id;
     }
@@ -328,11 +452,9 @@ namespace tgui
 
     bool SignalChildWindow::emit(const ChildWindow* childWindow)
     {
-        if (m_handlers.empty())
-            return false;
-
-        internal_signal::parameters[1] = static_cast<const void*>(&childWindow);
-        return Signal::emit(childWindow);
+        const Widget* widget = childWindow;
+        const void* parameters[] = {&widget, &childWindow};
+        return callHandlers(parameters, 2);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -354,7 +476,7 @@ namespace tgui
     unsigned int SignalItem::connect(const DelegateItem& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
+        addHandler(id, [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1])); });
         return id;
     }
 
@@ -365,9 +487,9 @@ namespace tgui
         const auto id = generateUniqueId();
     #ifdef TGUI_NO_CPP14
         std::string name = m_name;
-        m_handlers[id] = [handler, name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
+        addHandler(id, [handler, name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); });
     #else
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
+        addHandler(id, [handler, name=std::string{m_name}](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); });
     #endif
         return id;
     }
@@ -377,7 +499,7 @@ namespace tgui
     unsigned int SignalItem::connect(const DelegateItemAndId& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); };
+        addHandler(id, [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); });
         return id;
     }
 
@@ -388,9 +510,9 @@ namespace tgui
         const auto id = generateUniqueId();
     #ifdef TGUI_NO_CPP14
         std::string name = m_name;
-        m_handlers[id] = [handler, name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); };
+        addHandler(id, [handler, name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); });
     #else
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); };
+        addHandler(id, [handler, name=std::string{m_name}](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); });
     #endif
         return id;
     }
@@ -425,7 +547,7 @@ namespace tgui
     unsigned int SignalMenuItem::connect(const DelegateMenuItem& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
+        addHandler(id, [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1])); });
         return id;
     }
 
@@ -436,9 +558,9 @@ namespace tgui
         const auto id = generateUniqueId();
     #ifdef TGUI_NO_CPP14
         std::string name = m_name;
-        m_handlers[id] = [handler, name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
+        addHandler(id, [handler, name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); });
     #else
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
+        addHandler(id, [handler, name=std::string{m_name}](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); });
     #endif
         return id;
     }
@@ -448,7 +570,7 @@ namespace tgui
     unsigned int SignalMenuItem::connect(const DelegateMenuItemFull& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); };
+        addHandler(id, [handler](){ handler(internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); });
         return id;
     }
 
@@ -459,9 +581,9 @@ namespace tgui
         const auto id = generateUniqueId();
     #ifdef TGUI_NO_CPP14
         std::string name = m_name;
-        m_handlers[id] = [handler, name](){ handler(getWidget(), name, internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); };
+        addHandler(id, [handler, name](){ handler(getWidget(), name, internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); });
     #else
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); };
+        addHandler(id, [handler, name=std::string{m_name}](){ handler(getWidget(), name, internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); });
     #endif
         return id;
     }
@@ -0,0 +1,215 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/SpatialIndex.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        namespace
+        {
+            // Widgets that cover more cells than this are tested on every query instead of being stored in all their cells
+            const int maxCellsPerWidget = 256;
+
+            // Coordinates beyond this cell index are treated as unbounded to avoid integer overflow
+            const float maxCellCoordinate = 1000000;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        SpatialIndex::SpatialIndex(float cellSize) :
+            m_cellSize{cellSize > 0 ? cellSize : 64}
+        {
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SpatialIndex::insert(const Widget* widget, std::size_t order, const FloatRect& bounds)
+        {
+            auto it = m_entries.find(widget);
+            if (it != m_entries.end())
+            {
+                it->second.order = order;
+                update(widget, bounds);
+                return;
+            }
+
+            Entry& entry = m_entries[widget];
+            entry.order = order;
+            addToCells(widget, entry, bounds);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool SpatialIndex::update(const Widget* widget, const FloatRect& bounds)
+        {
+            auto it = m_entries.find(widget);
+            if (it == m_entries.end())
+                return false;
+
+            removeFromCells(widget, it->second);
+            addToCells(widget, it->second, bounds);
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SpatialIndex::setOrder(const Widget* widget, std::size_t order)
+        {
+            auto it = m_entries.find(widget);
+            if (it != m_entries.end())
+                it->second.order = order;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SpatialIndex::remove(const Widget* widget)
+        {
+            auto it = m_entries.find(widget);
+            if (it == m_entries.end())
+                return;
+
+            removeFromCells(widget, it->second);
+            m_entries.erase(it);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SpatialIndex::clear()
+        {
+            m_entries.clear();
+            m_cells.clear();
+            m_unboundedWidgets.clear();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t SpatialIndex::getWidgetCount() const
+        {
+            return m_entries.size();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SpatialIndex::query(Vector2f point, std::vector<std::pair<std::size_t, const Widget*>>& candidates) const
+        {
+            candidates.clear();
+
+            for (const auto& widget : m_unboundedWidgets)
+                candidates.emplace_back(m_entries.at(widget).order, widget);
+
+            const float cellX = std::floor(point.x / m_cellSize);
+            const float cellY = std::floor(point.y / m_cellSize);
+            if ((std::abs(cellX) < maxCellCoordinate) && (std::abs(cellY) < maxCellCoordinate))
+            {
+                const auto it = m_cells.find(getCellKey(static_cast<int>(cellX), static_cast<int>(cellY)));
+                if (it != m_cells.end())
+                {
+                    for (const auto& widget : it->second)
+                        candidates.emplace_back(m_entries.at(widget).order, widget);
+                }
+            }
+
+            std::sort(candidates.begin(), candidates.end(),
+                      [](const std::pair<std::size_t, const Widget*>& left, const std::pair<std::size_t, const Widget*>& right){ return left.first > right.first; });
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SpatialIndex::addToCells(const Widget* widget, Entry& entry, const FloatRect& bounds)
+        {
+            const float left = std::floor(bounds.left / m_cellSize);
+            const float top = std::floor(bounds.top / m_cellSize);
+            const float right = std::floor((bounds.left + bounds.width) / m_cellSize);
+            const float bottom = std::floor((bounds.top + bounds.height) / m_cellSize);
+
+            // A NaN also fails these checks, in which case the widget is treated as unbounded as well
+            if (!(std::abs(left) < maxCellCoordinate) || !(std::abs(top) < maxCellCoordinate)
+             || !(std::abs(right) < maxCellCoordinate) || !(std::abs(bottom) < maxCellCoordinate)
+             || ((right - left + 1) * (bottom - top + 1) > maxCellsPerWidget))
+            {
+                entry.unbounded = true;
+                m_unboundedWidgets.push_back(widget);
+                return;
+            }
+
+            entry.unbounded = false;
+            entry.left = static_cast<int>(left);
+            entry.top = static_cast<int>(top);
+            entry.right = std::max(entry.left, static_cast<int>(right));
+            entry.bottom = std::max(entry.top, static_cast<int>(bottom));
+
+            for (int y = entry.top; y <= entry.bottom; ++y)
+            {
+                for (int x = entry.left; x <= entry.right; ++x)
+                    m_cells[getCellKey(x, y)].push_back(widget);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SpatialIndex::removeFromCells(const Widget* widget, const Entry& entry)
+        {
+            if (entry.unbounded)
+            {
+                m_unboundedWidgets.erase(std::find(m_unboundedWidgets.begin(), m_unboundedWidgets.end(), widget));
+                return;
+            }
+
+            for (int y = entry.top; y <= entry.bottom; ++y)
+            {
+                for (int x = entry.left; x <= entry.right; ++x)
+                {
+                    auto it = m_cells.find(getCellKey(x, y));
+                    if (it == m_cells.end())
+                        continue;
+
+                    auto& widgets = it->second;
+                    widgets.erase(std::find(widgets.begin(), widgets.end(), widget));
+                    if (widgets.empty())
+                        m_cells.erase(it);
+                }
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::uint64_t SpatialIndex::getCellKey(int x, int y) const
+        {
+            return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
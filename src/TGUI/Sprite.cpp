@@ -26,7 +26,9 @@
 #include <TGUI/Sprite.hpp>
 #include <TGUI/Color.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/BatchRenderer.hpp>
 
+#include <algorithm>
 #include <cassert>
 
 #ifdef TGUI_USE_CPP17
@@ -37,6 +39,153 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // The nine-slice scaling needs the most vertices
+        const std::size_t maxVertexCount = 22;
+
+        // Calculates the vertices needed to draw the texture with the given size and returns how many vertices were written
+        std::size_t calculateVertices(const Texture& texture, Vector2f size, sf::Color color, sf::Vertex* vertices, Sprite::ScalingType& scalingType)
+        {
+            using ScalingType = Sprite::ScalingType;
+            std::size_t vertexCount = 0;
+
+            // Figure out how the image is scaled best
+            Vector2f textureSize{texture.getImageSize()};
+            FloatRect middleRect{sf::FloatRect{texture.getMiddleRect()}};
+            if (middleRect == FloatRect(0, 0, textureSize.x, textureSize.y))
+            {
+                scalingType = ScalingType::Normal;
+            }
+            else if (middleRect.height == textureSize.y)
+            {
+                if (size.x >= (textureSize.x - middleRect.width) * (size.y / textureSize.y))
+                    scalingType = ScalingType::Horizontal;
+                else
+                    scalingType = ScalingType::Normal;
+            }
+            else if (middleRect.width == textureSize.x)
+            {
+                if (size.y >= (textureSize.y - middleRect.height) * (size.x / textureSize.x))
+                    scalingType = ScalingType::Vertical;
+                else
+                    scalingType = ScalingType::Normal;
+            }
+            else
+            {
+                if (size.x >= textureSize.x - middleRect.width)
+                {
+                    if (size.y >= textureSize.y - middleRect.height)
+                        scalingType = ScalingType::NineSlice;
+                    else
+                        scalingType = ScalingType::Horizontal;
+                }
+                else if (size.y >= (textureSize.y - middleRect.height) * (size.x / textureSize.x))
+                    scalingType = ScalingType::Vertical;
+                else
+                    scalingType = ScalingType::Normal;
+            }
+
+            // Calculate the vertices based on the way we are scaling
+            switch (scalingType)
+            {
+            case ScalingType::Normal:
+                ///////////
+                // 0---1 //
+                // |   | //
+                // 2---3 //
+                ///////////
+                vertexCount = 4;
+                vertices[0] = {{0, 0}, color, {0, 0}};
+                vertices[1] = {{size.x, 0}, color, {textureSize.x, 0}};
+                vertices[2] = {{0, size.y}, color, {0, textureSize.y}};
+                vertices[3] = {{size.x, size.y}, color, {textureSize.x, textureSize.y}};
+                break;
+
+            case ScalingType::Horizontal:
+                ///////////////////////
+                // 0---2-------4---6 //
+                // |   |       |   | //
+                // 1---3-------5---7 //
+                ///////////////////////
+                vertexCount = 8;
+                vertices[0] = {{0, 0}, color, {0, 0}};
+                vertices[1] = {{0, size.y}, color, {0, textureSize.y}};
+                vertices[2] = {{middleRect.left * (size.y / textureSize.y), 0}, color, {middleRect.left, 0}};
+                vertices[3] = {{middleRect.left * (size.y / textureSize.y), size.y}, color, {middleRect.left, textureSize.y}};
+                vertices[4] = {{size.x - (textureSize.x - middleRect.left - middleRect.width) * (size.y / textureSize.y), 0}, color, {middleRect.left + middleRect.width, 0}};
+                vertices[5] = {{size.x - (textureSize.x - middleRect.left - middleRect.width) * (size.y / textureSize.y), size.y}, color, {middleRect.left + middleRect.width, textureSize.y}};
+                vertices[6] = {{size.x, 0}, color, {textureSize.x, 0}};
+                vertices[7] = {{size.x, size.y}, color, {textureSize.x, textureSize.y}};
+                break;
+
+            case ScalingType::Vertical:
+                ///////////
+                // 0---1 //
+                // |   | //
+                // 2---3 //
+                // |   | //
+                // |   | //
+                // |   | //
+                // 4---5 //
+                // |   | //
+                // 6---7-//
+                ///////////
+                vertexCount = 8;
+                vertices[0] = {{0, 0}, color, {0, 0}};
+                vertices[1] = {{size.x, 0}, color, {textureSize.x, 0}};
+                vertices[2] = {{0, middleRect.top * (size.x / textureSize.x)}, color, {0, middleRect.top}};
+                vertices[3] = {{size.x, middleRect.top * (size.x / textureSize.x)}, color, {textureSize.x, middleRect.top}};
+                vertices[4] = {{0, size.y - (textureSize.y - middleRect.top - middleRect.height) * (size.x / textureSize.x)}, color, {0, middleRect.top + middleRect.height}};
+                vertices[5] = {{size.x, size.y - (textureSize.y - middleRect.top - middleRect.height) * (size.x / textureSize.x)}, color, {textureSize.x, middleRect.top + middleRect.height}};
+                vertices[6] = {{0, size.y}, color, {0, textureSize.y}};
+                vertices[7] = {{size.x, size.y}, color, {textureSize.x, textureSize.y}};
+                break;
+
+            case ScalingType::NineSlice:
+                //////////////////////////////////
+                // 0---1/13-----------14-----15 //
+                // |    |              |     |  //
+                // 2---3/11----------12/16---17 //
+                // |    |              |     |  //
+                // |    |              |     |  //
+                // |    |              |     |  //
+                // 4---5/9-----------10/18---19 //
+                // |    |              |     |  //
+                // 6----7-------------8/20---21 //
+                //////////////////////////////////
+                vertexCount = 22;
+                vertices[0] = {{0, 0}, color, {0, 0}};
+                vertices[1] = {{middleRect.left, 0}, color, {middleRect.left, 0}};
+                vertices[2] = {{0, middleRect.top}, color, {0, middleRect.top}};
+                vertices[3] = {{middleRect.left, middleRect.top}, color, {middleRect.left, middleRect.top}};
+                vertices[4] = {{0, size.y - (textureSize.y - middleRect.top - middleRect.height)}, color, {0, middleRect.top + middleRect.height}};
+                vertices[5] = {{middleRect.left, size.y - (textureSize.y - middleRect.top - middleRect.height)}, color, {middleRect.left, middleRect.top + middleRect.height}};
+                vertices[6] = {{0, size.y}, color, {0, textureSize.y}};
+                vertices[7] = {{middleRect.left, size.y}, color, {middleRect.left, textureSize.y}};
+                vertices[8] = {{size.x - (textureSize.x - middleRect.left - middleRect.width), size.y}, color, {middleRect.left + middleRect.width, textureSize.y}};
+                vertices[9] = vertices[5];
+                vertices[10] = {{size.x - (textureSize.x - middleRect.left - middleRect.width), size.y - (textureSize.y - middleRect.top - middleRect.height)}, color, {middleRect.left + middleRect.width, middleRect.top + middleRect.height}};
+                vertices[11] = vertices[3];
+                vertices[12] = {{size.x - (textureSize.x - middleRect.left - middleRect.width), middleRect.top}, color, {middleRect.left + middleRect.width, middleRect.top}};
+                vertices[13] = vertices[1];
+                vertices[14] = {{size.x - (textureSize.x - middleRect.left - middleRect.width), 0}, color, {middleRect.left + middleRect.width, 0}};
+                vertices[15] = {{size.x, 0}, color, {textureSize.x, 0}};
+                vertices[16] = vertices[12];
+                vertices[17] = {{size.x, middleRect.top}, color, {textureSize.x, middleRect.top}};
+                vertices[18] = vertices[10];
+                vertices[19] = {{size.x, size.y - (textureSize.y - middleRect.top - middleRect.height)}, color, {textureSize.x, middleRect.top + middleRect.height}};
+                vertices[20] = vertices[8];
+                vertices[21] = {{size.x, size.y}, color, {textureSize.x, textureSize.y}};
+                break;
+            };
+
+            return vertexCount;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Sprite::setTexture(const Texture& texture)
     {
         m_texture = texture;
@@ -149,74 +298,74 @@ namespace tgui
         // Find out on which pixel the mouse is standing
         sf::Vector2u pixel;
         sf::IntRect middleRect = m_texture.getMiddleRect();
-        const sf::Texture& texture = m_texture.getData()->texture;
+        const sf::Vector2u textureSize = m_texture.getData()->getSize();
         switch (m_scalingType)
         {
             case ScalingType::Normal:
             {
-                pixel.x = static_cast<unsigned int>(pos.x / m_size.x * texture.getSize().x);
-                pixel.y = static_cast<unsigned int>(pos.y / m_size.y * texture.getSize().y);
+                pixel.x = static_cast<unsigned int>(pos.x / m_size.x * textureSize.x);
+                pixel.y = static_cast<unsigned int>(pos.y / m_size.y * textureSize.y);
                 break;
             }
             case ScalingType::Horizontal:
             {
-                if (pos.x >= m_size.x - (texture.getSize().x - middleRect.left - middleRect.width) * (m_size.y / texture.getSize().y))
+                if (pos.x >= m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y))
                 {
-                    float xDiff = (pos.x - (m_size.x - (texture.getSize().x - middleRect.left - middleRect.width) * (m_size.y / texture.getSize().y)));
-                    pixel.x = static_cast<unsigned int>(middleRect.left + middleRect.width + (xDiff / m_size.y * texture.getSize().y));
+                    float xDiff = (pos.x - (m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y)));
+                    pixel.x = static_cast<unsigned int>(middleRect.left + middleRect.width + (xDiff / m_size.y * textureSize.y));
                 }
-                else if (pos.x >= middleRect.left * (m_size.y / texture.getSize().y))
+                else if (pos.x >= middleRect.left * (m_size.y / textureSize.y))
                 {
-                    float xDiff = pos.x - (middleRect.left * (m_size.y / texture.getSize().y));
-                    pixel.x = static_cast<unsigned int>(middleRect.left + (xDiff / (m_size.x - ((texture.getSize().x - middleRect.width) * (m_size.y / texture.getSize().y))) * middleRect.width));
+                    float xDiff = pos.x - (middleRect.left * (m_size.y / textureSize.y));
+                    pixel.x = static_cast<unsigned int>(middleRect.left + (xDiff / (m_size.x - ((textureSize.x - middleRect.width) * (m_size.y / textureSize.y))) * middleRect.width));
                 }
                 else // Mouse on the left part
                 {
-                    pixel.x = static_cast<unsigned int>(pos.x / m_size.y * texture.getSize().y);
+                    pixel.x = static_cast<unsigned int>(pos.x / m_size.y * textureSize.y);
                 }
 
-                pixel.y = static_cast<unsigned int>(pos.y / m_size.y * texture.getSize().y);
+                pixel.y = static_cast<unsigned int>(pos.y / m_size.y * textureSize.y);
                 break;
             }
             case ScalingType::Vertical:
             {
-                if (pos.y >= m_size.y - (texture.getSize().y - middleRect.top - middleRect.height) * (m_size.x / texture.getSize().x))
+                if (pos.y >= m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x))
                 {
-                    float yDiff = (pos.y - (m_size.y - (texture.getSize().y - middleRect.top - middleRect.height) * (m_size.x / texture.getSize().x)));
-                    pixel.y = static_cast<unsigned int>(middleRect.top + middleRect.height + (yDiff / m_size.x * texture.getSize().x));
+                    float yDiff = (pos.y - (m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x)));
+                    pixel.y = static_cast<unsigned int>(middleRect.top + middleRect.height + (yDiff / m_size.x * textureSize.x));
                 }
-                else if (pos.y >= middleRect.top * (m_size.x / texture.getSize().x))
+                else if (pos.y >= middleRect.top * (m_size.x / textureSize.x))
                 {
-                    float yDiff = pos.y - (middleRect.top * (m_size.x / texture.getSize().x));
-                    pixel.y = static_cast<unsigned int>(middleRect.top + (yDiff / (m_size.y - ((texture.getSize().y - middleRect.height) * (m_size.x / texture.getSize().x))) * middleRect.height));
+                    float yDiff = pos.y - (middleRect.top * (m_size.x / textureSize.x));
+                    pixel.y = static_cast<unsigned int>(middleRect.top + (yDiff / (m_size.y - ((textureSize.y - middleRect.height) * (m_size.x / textureSize.x))) * middleRect.height));
                 }
                 else // Mouse on the top part
                 {
-                    pixel.y = static_cast<unsigned int>(pos.y / m_size.x * texture.getSize().x);
+                    pixel.y = static_cast<unsigned int>(pos.y / m_size.x * textureSize.x);
                 }
 
-                pixel.x = static_cast<unsigned int>(pos.x / m_size.x * texture.getSize().x);
+                pixel.x = static_cast<unsigned int>(pos.x / m_size.x * textureSize.x);
                 break;
             }
             case ScalingType::NineSlice:
             {
                 if (pos.x < middleRect.left)
                     pixel.x = static_cast<unsigned int>(pos.x);
-                else if (pos.x >= m_size.x - (texture.getSize().x - middleRect.width - middleRect.left))
-                    pixel.x = static_cast<unsigned int>(pos.x - m_size.x + texture.getSize().x);
+                else if (pos.x >= m_size.x - (textureSize.x - middleRect.width - middleRect.left))
+                    pixel.x = static_cast<unsigned int>(pos.x - m_size.x + textureSize.x);
                 else
                 {
-                    float xDiff = (pos.x - middleRect.left) / (m_size.x - (texture.getSize().x - middleRect.width)) * middleRect.width;
+                    float xDiff = (pos.x - middleRect.left) / (m_size.x - (textureSize.x - middleRect.width)) * middleRect.width;
                     pixel.x = static_cast<unsigned int>(middleRect.left + xDiff);
                 }
 
                 if (pos.y < middleRect.top)
                     pixel.y = static_cast<unsigned int>(pos.y);
-                else if (pos.y >= m_size.y - (texture.getSize().y - middleRect.height - middleRect.top))
-                    pixel.y = static_cast<unsigned int>(pos.y - m_size.y + texture.getSize().y);
+                else if (pos.y >= m_size.y - (textureSize.y - middleRect.height - middleRect.top))
+                    pixel.y = static_cast<unsigned int>(pos.y - m_size.y + textureSize.y);
                 else
                 {
-                    float yDiff = (pos.y - middleRect.top) / (m_size.y - (texture.getSize().y - middleRect.height)) * middleRect.height;
+                    float yDiff = (pos.y - middleRect.top) / (m_size.y - (textureSize.y - middleRect.height)) * middleRect.height;
                     pixel.y = static_cast<unsigned int>(middleRect.top + yDiff);
                 }
 
@@ -238,146 +387,44 @@ namespace tgui
 
     void Sprite::updateVertices()
     {
-        // Figure out how the image is scaled best
-        Vector2f textureSize{m_texture.getImageSize()};
-        FloatRect middleRect{sf::FloatRect{m_texture.getMiddleRect()}};
-        if (middleRect == FloatRect(0, 0, textureSize.x, textureSize.y))
-        {
-            m_scalingType = ScalingType::Normal;
-        }
-        else if (middleRect.height == textureSize.y)
-        {
-            if (m_size.x >= (textureSize.x - middleRect.width) * (m_size.y / textureSize.y))
-                m_scalingType = ScalingType::Horizontal;
-            else
-                m_scalingType = ScalingType::Normal;
-        }
-        else if (middleRect.width == textureSize.x)
-        {
-            if (m_size.y >= (textureSize.y - middleRect.height) * (m_size.x / textureSize.x))
-                m_scalingType = ScalingType::Vertical;
-            else
-                m_scalingType = ScalingType::Normal;
-        }
-        else
-        {
-            if (m_size.x >= textureSize.x - middleRect.width)
-            {
-                if (m_size.y >= textureSize.y - middleRect.height)
-                    m_scalingType = ScalingType::NineSlice;
-                else
-                    m_scalingType = ScalingType::Horizontal;
-            }
-            else if (m_size.y >= (textureSize.y - middleRect.height) * (m_size.x / textureSize.x))
-                m_scalingType = ScalingType::Vertical;
-            else
-                m_scalingType = ScalingType::Normal;
-        }
-
-        // Calculate the vertices based on the way we are scaling
-        switch (m_scalingType)
-        {
-        case ScalingType::Normal:
-            ///////////
-            // 0---1 //
-            // |   | //
-            // 2---3 //
-            ///////////
-            m_vertices.resize(4);
-            m_vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
-            m_vertices[1] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
-            m_vertices[2] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
-            m_vertices[3] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
-            break;
-
-        case ScalingType::Horizontal:
-            ///////////////////////
-            // 0---2-------4---6 //
-            // |   |       |   | //
-            // 1---3-------5---7 //
-            ///////////////////////
-            m_vertices.resize(8);
-            m_vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
-            m_vertices[1] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
-            m_vertices[2] = {{middleRect.left * (m_size.y / textureSize.y), 0}, m_vertexColor, {middleRect.left, 0}};
-            m_vertices[3] = {{middleRect.left * (m_size.y / textureSize.y), m_size.y}, m_vertexColor, {middleRect.left, textureSize.y}};
-            m_vertices[4] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y), 0}, m_vertexColor, {middleRect.left + middleRect.width, 0}};
-            m_vertices[5] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y), m_size.y}, m_vertexColor, {middleRect.left + middleRect.width, textureSize.y}};
-            m_vertices[6] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
-            m_vertices[7] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
-            break;
-
-        case ScalingType::Vertical:
-            ///////////
-            // 0---1 //
-            // |   | //
-            // 2---3 //
-            // |   | //
-            // |   | //
-            // |   | //
-            // 4---5 //
-            // |   | //
-            // 6---7-//
-            ///////////
-            m_vertices.resize(8);
-            m_vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
-            m_vertices[1] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
-            m_vertices[2] = {{0, middleRect.top * (m_size.x / textureSize.x)}, m_vertexColor, {0, middleRect.top}};
-            m_vertices[3] = {{m_size.x, middleRect.top * (m_size.x / textureSize.x)}, m_vertexColor, {textureSize.x, middleRect.top}};
-            m_vertices[4] = {{0, m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x)}, m_vertexColor, {0, middleRect.top + middleRect.height}};
-            m_vertices[5] = {{m_size.x, m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x)}, m_vertexColor, {textureSize.x, middleRect.top + middleRect.height}};
-            m_vertices[6] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
-            m_vertices[7] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
-            break;
-
-        case ScalingType::NineSlice:
-            //////////////////////////////////
-            // 0---1/13-----------14-----15 //
-            // |    |              |     |  //
-            // 2---3/11----------12/16---17 //
-            // |    |              |     |  //
-            // |    |              |     |  //
-            // |    |              |     |  //
-            // 4---5/9-----------10/18---19 //
-            // |    |              |     |  //
-            // 6----7-------------8/20---21 //
-            //////////////////////////////////
-            m_vertices.resize(22);
-            m_vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
-            m_vertices[1] = {{middleRect.left, 0}, m_vertexColor, {middleRect.left, 0}};
-            m_vertices[2] = {{0, middleRect.top}, m_vertexColor, {0, middleRect.top}};
-            m_vertices[3] = {{middleRect.left, middleRect.top}, m_vertexColor, {middleRect.left, middleRect.top}};
-            m_vertices[4] = {{0, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {0, middleRect.top + middleRect.height}};
-            m_vertices[5] = {{middleRect.left, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {middleRect.left, middleRect.top + middleRect.height}};
-            m_vertices[6] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
-            m_vertices[7] = {{middleRect.left, m_size.y}, m_vertexColor, {middleRect.left, textureSize.y}};
-            m_vertices[8] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), m_size.y}, m_vertexColor, {middleRect.left + middleRect.width, textureSize.y}};
-            m_vertices[9] = m_vertices[5];
-            m_vertices[10] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {middleRect.left + middleRect.width, middleRect.top + middleRect.height}};
-            m_vertices[11] = m_vertices[3];
-            m_vertices[12] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), middleRect.top}, m_vertexColor, {middleRect.left + middleRect.width, middleRect.top}};
-            m_vertices[13] = m_vertices[1];
-            m_vertices[14] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), 0}, m_vertexColor, {middleRect.left + middleRect.width, 0}};
-            m_vertices[15] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
-            m_vertices[16] = m_vertices[12];
-            m_vertices[17] = {{m_size.x, middleRect.top}, m_vertexColor, {textureSize.x, middleRect.top}};
-            m_vertices[18] = m_vertices[10];
-            m_vertices[19] = {{m_size.x, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {textureSize.x, middleRect.top + middleRect.height}};
-            m_vertices[20] = m_vertices[8];
-            m_vertices[21] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
-            break;
-        };
+        sf::Vertex vertices[maxVertexCount];
+        const std::size_t vertexCount = calculateVertices(m_texture, m_size, Color::calcColorOpacity(m_vertexColor, m_opacity), vertices, m_scalingType);
+        m_vertices.assign(vertices, vertices + vertexCount);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Sprite::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        drawVertices(target, states, getSize(), m_vertices.data(), m_vertices.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Sprite::draw(sf::RenderTarget& target, sf::RenderStates states, Vector2f size) const
+    {
+        if (!isSet())
+            return;
+
+        size.x = std::max(0.f, size.x);
+        size.y = std::max(0.f, size.y);
+
+        // The vertices are calculated on the stack so that the sprite itself doesn't have to be copied or changed
+        sf::Vertex vertices[maxVertexCount];
+        ScalingType scalingType;
+        const std::size_t vertexCount = calculateVertices(m_texture, size, Color::calcColorOpacity(m_vertexColor, m_opacity), vertices, scalingType);
+        drawVertices(target, states, size, vertices, vertexCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Sprite::drawVertices(sf::RenderTarget& target, sf::RenderStates states, Vector2f size, const sf::Vertex* vertices, std::size_t vertexCount) const
     {
         // A rotation can cause the image to be shifted, so we move it upfront so that it ends at the correct location
         if (getRotation() != 0)
         {
-            Vector2f pos = {getTransform().transformRect(FloatRect({}, getSize())).left,
-                           getTransform().transformRect(FloatRect({}, getSize())).top};
+            Vector2f pos = {getTransform().transformRect(FloatRect({}, size)).left,
+                           getTransform().transformRect(FloatRect({}, size)).top};
 
             states.transform.translate(getPosition() - pos);
         }
@@ -397,9 +444,26 @@ namespace tgui
                 clipping = make_unique<Clipping>(target, states, Vector2f{m_visibleRect.left, m_visibleRect.top}, Vector2f{m_visibleRect.width, m_visibleRect.height});
         #endif
 
-            states.shader = m_texture.getData()->shader;
-            states.texture = &m_texture.getData()->texture;
-            target.draw(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+            const TextureData& data = *m_texture.getData();
+            states.shader = data.shader;
+            states.texture = &data.getTexture();
+
+            if (data.atlasTexture)
+            {
+                // The image is stored inside a texture atlas, so the texture coordinates have to be moved to its location
+                sf::Vertex movedVertices[maxVertexCount];
+                vertexCount = std::min(vertexCount, maxVertexCount);
+                const sf::Vector2f offset{data.atlasOffset};
+                for (std::size_t i = 0; i < vertexCount; ++i)
+                {
+                    movedVertices[i] = vertices[i];
+                    movedVertices[i].texCoords += offset;
+                }
+
+                priv::BatchRenderer::draw(target, movedVertices, vertexCount, sf::PrimitiveType::TrianglesStrip, states);
+            }
+            else
+                priv::BatchRenderer::draw(target, vertices, vertexCount, sf::PrimitiveType::TrianglesStrip, states);
         }
     }
 
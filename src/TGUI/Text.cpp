@@ -25,6 +25,8 @@
 
 #include <TGUI/Text.hpp>
 #include <TGUI/Global.hpp>
+#include <TGUI/BatchRenderer.hpp>
+#include <TGUI/GlyphCache.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <cmath>
 
@@ -36,37 +38,41 @@ namespace tgui
 
     Vector2f Text::getSize() const
     {
-        return m_size;
+        const priv::TextLayout* layout = getLayout();
+        if (layout)
+            return layout->getSize();
+        else
+            return {0, 0};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Text::setString(const sf::String& string)
     {
-        m_text.setString(string);
-        recalculateSize();
+        m_string = string;
+        m_layout = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     const sf::String& Text::getString() const
     {
-        return m_text.getString();
+        return m_string;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Text::setCharacterSize(unsigned int size)
     {
-        m_text.setCharacterSize(size);
-        recalculateSize();
+        m_characterSize = size;
+        m_layout = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int Text::getCharacterSize() const
     {
-        return m_text.getCharacterSize();
+        return m_characterSize;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -74,12 +80,7 @@ namespace tgui
     void Text::setColor(Color color)
     {
         m_color = color;
-
-    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-        m_text.setFillColor(Color::calcColorOpacity(color, m_opacity));
-    #else
-        m_text.setColor(Color::calcColorOpacity(color, m_opacity));
-    #endif
+        m_vertexColor = Color::calcColorOpacity(color, m_opacity);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -94,12 +95,7 @@ namespace tgui
     void Text::setOpacity(float opacity)
     {
         m_opacity = opacity;
-
-    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-        m_text.setFillColor(Color::calcColorOpacity(m_color, opacity));
-    #else
-        m_text.setColor(Color::calcColorOpacity(m_color, opacity));
-    #endif
+        m_vertexColor = Color::calcColorOpacity(m_color, opacity);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -114,28 +110,7 @@ namespace tgui
     void Text::setFont(Font font)
     {
         m_font = font;
-
-        if (font)
-            m_text.setFont(*font.getFont());
-        else
-        {
-            // We can't keep using a pointer to the old font (it might be destroyed), but sf::Text has no function to pass an empty font
-            if (m_text.getFont())
-            {
-                m_text = sf::Text();
-                m_text.setString(getString());
-                m_text.setCharacterSize(getCharacterSize());
-                m_text.setStyle(getStyle());
-
-            #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-                m_text.setFillColor(Color::calcColorOpacity(getColor(), getOpacity()));
-            #else
-                m_text.setColor(Color::calcColorOpacity(getColor(), getOpacity()));
-            #endif
-            }
-        }
-
-        recalculateSize();
+        m_layout = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -149,10 +124,10 @@ namespace tgui
 
     void Text::setStyle(TextStyle style)
     {
-        if (style != m_text.getStyle())
+        if (style != m_style)
         {
-            m_text.setStyle(style);
-            recalculateSize();
+            m_style = style;
+            m_layout = nullptr;
         }
     }
 
@@ -160,20 +135,54 @@ namespace tgui
 
     TextStyle Text::getStyle() const
     {
-        return m_text.getStyle();
+        return m_style;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Vector2f Text::findCharacterPos(std::size_t index) const
     {
-        return m_text.findCharacterPos(index);
+        const std::shared_ptr<sf::Font> font = m_font;
+        if (font == nullptr)
+            return {0, 0};
+
+        index = std::min(index, m_string.getSize());
+
+        const bool bold = (m_style & sf::Text::Bold) != 0;
+        priv::GlyphCache& glyphCache = priv::GlyphCache::get(font, m_characterSize, bold);
+
+        Vector2f position;
+        std::uint32_t prevChar = 0;
+        for (std::size_t i = 0; i < index; ++i)
+        {
+            const std::uint32_t curChar = m_string[i];
+            position.x += glyphCache.getKerning(prevChar, curChar);
+            prevChar = curChar;
+
+            if (curChar == '\n')
+            {
+                position.y += glyphCache.getLineSpacing();
+                position.x = 0;
+            }
+            else
+                position.x += glyphCache.getAdvance(curChar);
+        }
+
+        return position;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Text::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        // Don't interrupt the batched draw calls when there is nothing to draw
+        if (m_string.isEmpty())
+            return;
+
+        const priv::TextLayout* layout = getLayout();
+        if (!layout)
+            return;
+
         states.transform *= getTransform();
 
         // Round the position to avoid blurry text
@@ -182,47 +191,30 @@ namespace tgui
                                          matrix[1], matrix[5], std::floor(matrix[13]),
                                          matrix[3], matrix[7], matrix[15]};
 
-        target.draw(m_text, states);
+        // The vertices are shared with other texts, so the color is only applied while drawing them
+        const std::shared_ptr<sf::Font> font = m_font;
+        const std::vector<sf::Vertex>& vertices = layout->getVertices(*font);
+        if (vertices.empty())
+            return;
+
+        states.texture = &font->getTexture(m_characterSize);
+        priv::BatchRenderer::draw(target, vertices.data(), vertices.size(), sf::PrimitiveType::Triangles, states, m_vertexColor);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Text::recalculateSize()
+    const priv::TextLayout* Text::getLayout() const
     {
-        const std::shared_ptr<sf::Font> font = m_font;
-        if (font == nullptr)
-        {
-            m_size = {0, 0};
-            return;
-        }
-
-        float width = 0;
-        float maxWidth = 0;
-        unsigned int lines = 1;
-        std::uint32_t prevChar = 0;
-        const sf::String& string = m_text.getString();
-        const bool bold = (m_text.getStyle() & sf::Text::Bold) != 0;
-        const unsigned int textSize = m_text.getCharacterSize();
-        for (std::size_t i = 0; i < string.getSize(); ++i)
+        if (!m_layout)
         {
-            const float kerning = static_cast<float>(font->getKerning(prevChar, string[i], textSize));
-            if (string[i] == '\n')
-            {
-                maxWidth = std::max(maxWidth, width);
-                width = 0;
-                lines++;
-            }
-            else if (string[i] == '\t')
-                width += (static_cast<float>(font->getGlyph(' ', textSize, bold).advance) * 4) + kerning;
-            else
-                width += static_cast<float>(font->getGlyph(string[i], textSize, bold).advance) + kerning;
+            const std::shared_ptr<sf::Font> font = m_font;
+            if (font == nullptr)
+                return nullptr;
 
-            prevChar = string[i];
+            m_layout = priv::TextLayoutCache::get(font, m_characterSize, m_style, m_string);
         }
 
-        const float extraVerticalSpace = Text::calculateExtraVerticalSpace(m_font, m_text.getCharacterSize(), m_text.getStyle());
-        const float height = lines * font->getLineSpacing(m_text.getCharacterSize()) + extraVerticalSpace;
-        m_size = {std::max(maxWidth, width), height};
+        return m_layout.get();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -277,16 +269,19 @@ namespace tgui
             textSizes[i] = i + 1;
 
         const auto high = std::lower_bound(textSizes.begin(), textSizes.end(), height,
-                                           [&](unsigned int charSize, float h) { return font->getLineSpacing(charSize) + Text::calculateExtraVerticalSpace(font, charSize) < h; });
+                                           [&](unsigned int charSize, float h) {
+                                               const priv::GlyphCache& glyphCache = priv::GlyphCache::get(font, charSize, false);
+                                               return glyphCache.getLineSpacing() + glyphCache.getExtraVerticalSpace() < h;
+                                           });
         if (high == textSizes.end())
             return static_cast<unsigned int>(height);
 
-        const float highLineSpacing = font->getLineSpacing(*high);
+        const float highLineSpacing = priv::GlyphCache::get(font, *high, false).getLineSpacing();
         if (highLineSpacing == height)
             return *high;
 
         const auto low = high - 1;
-        const float lowLineSpacing = font->getLineSpacing(*low);
+        const float lowLineSpacing = priv::GlyphCache::get(font, *low, false).getLineSpacing();
 
         if (fit < 0)
             return *low;
@@ -309,17 +304,7 @@ namespace tgui
             return 0;
 
         const bool bold = (style & sf::Text::Bold) != 0;
-
-        // Calculate the height of the first line (char size = everything above baseline, height + top = part below baseline)
-        const float lineHeight = characterSize
-                                 + font.getFont()->getGlyph('g', characterSize, bold).bounds.height
-                                 + font.getFont()->getGlyph('g', characterSize, bold).bounds.top;
-
-        // Get the line spacing sfml returns
-        const float lineSpacing = font.getFont()->getLineSpacing(characterSize);
-
-        // Calculate the offset of the text
-        return lineHeight - lineSpacing;
+        return priv::GlyphCache::get(font.getFont(), characterSize, bold).getExtraVerticalSpace();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -329,6 +314,8 @@ namespace tgui
         if (font == nullptr)
             return "";
 
+        priv::GlyphCache& glyphCache = priv::GlyphCache::get(font.getFont(), textSize, bold);
+
         sf::String result;
         std::size_t index = 0;
         while (index < text.getSize())
@@ -340,19 +327,15 @@ namespace tgui
             std::uint32_t prevChar = 0;
             for (std::size_t i = index; i < text.getSize(); ++i)
             {
-                float charWidth;
                 const std::uint32_t curChar = text[i];
                 if (curChar == '\n')
                 {
                     index++;
                     break;
                 }
-                else if (curChar == '\t')
-                    charWidth = font.getFont()->getGlyph(' ', textSize, bold).advance * 4;
-                else
-                    charWidth = font.getFont()->getGlyph(curChar, textSize, bold).advance;
 
-                const float kerning = font.getFont()->getKerning(prevChar, curChar, textSize);
+                const float charWidth = glyphCache.getAdvance(curChar);
+                const float kerning = glyphCache.getKerning(prevChar, curChar);
                 if ((maxWidth == 0) || (width + charWidth + kerning <= maxWidth))
                 {
                     width += kerning + charWidth;
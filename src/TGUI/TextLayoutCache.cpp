@@ -0,0 +1,419 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/TextLayoutCache.hpp>
+#include <TGUI/GlyphCache.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <unordered_map>
+#include <iterator>
+#include <list>
+#include <algorithm>
+#include <cstdint>
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        namespace
+        {
+            struct Entry
+            {
+                const sf::Font* fontPtr;
+                std::weak_ptr<sf::Font> font;
+                std::size_t hash;
+                std::size_t memoryUsage;
+                std::shared_ptr<TextLayout> layout;
+            };
+
+            // The most recently used entry is stored at the front of the list
+            std::list<Entry> entries;
+            std::unordered_multimap<std::size_t, std::list<Entry>::iterator> entryLookup;
+            std::size_t maxEntries = 1000;
+            std::size_t maxMemoryUsage = 4 * 1024 * 1024;
+            std::size_t totalMemoryUsage = 0;
+            TextLayoutCache::Statistics statistics;
+
+            // Longer strings are rarely displayed by more than one text, caching them would only push other layouts out
+            const std::size_t maxStringLength = 1024;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            std::size_t calculateHash(const sf::Font* font, unsigned int characterSize, sf::Uint32 style, const sf::String& string)
+            {
+                // FNV-1a over the parts of the key and the code points of the string
+                std::uint64_t hash = 14695981039346656037ULL;
+                const auto addValue = [&hash](std::uint64_t value){
+                        hash ^= value;
+                        hash *= 1099511628211ULL;
+                    };
+
+                addValue(reinterpret_cast<std::uintptr_t>(font));
+                addValue(characterSize);
+                addValue(style);
+                for (const std::uint32_t c : string)
+                    addValue(c);
+
+                return static_cast<std::size_t>(hash);
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            void removeEntry(std::list<Entry>::iterator entryIt)
+            {
+                const auto range = entryLookup.equal_range(entryIt->hash);
+                for (auto it = range.first; it != range.second; ++it)
+                {
+                    if (it->second == entryIt)
+                    {
+                        entryLookup.erase(it);
+                        break;
+                    }
+                }
+
+                totalMemoryUsage -= entryIt->memoryUsage;
+                entries.erase(entryIt);
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            std::size_t estimateMemoryUsage(const sf::String& string)
+            {
+                // Every character is assumed to become a glyph, which is what getVertices reserves memory for
+                return sizeof(Entry) + sizeof(std::pair<const std::size_t, std::list<Entry>::iterator>) + sizeof(TextLayout)
+                     + (string.getSize() * (sizeof(sf::Uint32) + 6 * sizeof(sf::Vertex)));
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            void removeLeastRecentlyUsedEntries()
+            {
+                while (!entries.empty() && ((entries.size() > maxEntries) || (totalMemoryUsage > maxMemoryUsage)))
+                {
+                    removeEntry(std::prev(entries.end()));
+                    statistics.evictions++;
+                }
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            Vector2f measureString(const std::shared_ptr<sf::Font>& font, unsigned int characterSize, sf::Uint32 style, const sf::String& string)
+            {
+                float width = 0;
+                float maxWidth = 0;
+                unsigned int lines = 1;
+                std::uint32_t prevChar = 0;
+                const bool bold = (style & sf::Text::Bold) != 0;
+                GlyphCache& glyphCache = GlyphCache::get(font, characterSize, bold);
+                for (const std::uint32_t curChar : string)
+                {
+                    const float kerning = glyphCache.getKerning(prevChar, curChar);
+                    if (curChar == '\n')
+                    {
+                        maxWidth = std::max(maxWidth, width);
+                        width = 0;
+                        lines++;
+                    }
+                    else
+                        width += glyphCache.getAdvance(curChar) + kerning;
+
+                    prevChar = curChar;
+                }
+
+                const float height = lines * glyphCache.getLineSpacing() + glyphCache.getExtraVerticalSpace();
+                return {std::max(maxWidth, width), height};
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            void addLine(std::vector<sf::Vertex>& vertices, float lineLength, float lineTop, float offset, float thickness)
+            {
+                const float top = std::floor(lineTop + offset - (thickness / 2) + 0.5f);
+                const float bottom = top + std::floor(thickness + 0.5f);
+
+                // The pixel at (1,1) in the texture of the font is always white
+                vertices.emplace_back(sf::Vector2f{0, top}, sf::Color::White, sf::Vector2f{1, 1});
+                vertices.emplace_back(sf::Vector2f{lineLength, top}, sf::Color::White, sf::Vector2f{1, 1});
+                vertices.emplace_back(sf::Vector2f{0, bottom}, sf::Color::White, sf::Vector2f{1, 1});
+                vertices.emplace_back(sf::Vector2f{0, bottom}, sf::Color::White, sf::Vector2f{1, 1});
+                vertices.emplace_back(sf::Vector2f{lineLength, top}, sf::Color::White, sf::Vector2f{1, 1});
+                vertices.emplace_back(sf::Vector2f{lineLength, bottom}, sf::Color::White, sf::Vector2f{1, 1});
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            void addGlyphQuad(std::vector<sf::Vertex>& vertices, sf::Vector2f position, const sf::Glyph& glyph, float italicShear)
+            {
+                const float padding = 1;
+
+                const float left = glyph.bounds.left - padding;
+                const float top = glyph.bounds.top - padding;
+                const float right = glyph.bounds.left + glyph.bounds.width + padding;
+                const float bottom = glyph.bounds.top + glyph.bounds.height + padding;
+
+                const float u1 = static_cast<float>(glyph.textureRect.left) - padding;
+                const float v1 = static_cast<float>(glyph.textureRect.top) - padding;
+                const float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + padding;
+                const float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + padding;
+
+                vertices.emplace_back(sf::Vector2f{position.x + left - italicShear * top, position.y + top}, sf::Color::White, sf::Vector2f{u1, v1});
+                vertices.emplace_back(sf::Vector2f{position.x + right - italicShear * top, position.y + top}, sf::Color::White, sf::Vector2f{u2, v1});
+                vertices.emplace_back(sf::Vector2f{position.x + left - italicShear * bottom, position.y + bottom}, sf::Color::White, sf::Vector2f{u1, v2});
+                vertices.emplace_back(sf::Vector2f{position.x + left - italicShear * bottom, position.y + bottom}, sf::Color::White, sf::Vector2f{u1, v2});
+                vertices.emplace_back(sf::Vector2f{position.x + right - italicShear * top, position.y + top}, sf::Color::White, sf::Vector2f{u2, v1});
+                vertices.emplace_back(sf::Vector2f{position.x + right - italicShear * bottom, position.y + bottom}, sf::Color::White, sf::Vector2f{u2, v2});
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        TextLayout::TextLayout(const sf::String& string, unsigned int characterSize, sf::Uint32 style, Vector2f size) :
+            m_string       (string),
+            m_characterSize(characterSize),
+            m_style        (style),
+            m_size         (size)
+        {
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const std::vector<sf::Vertex>& TextLayout::getVertices(const sf::Font& font) const
+        {
+            if (m_verticesCreated)
+                return m_vertices;
+
+            m_verticesCreated = true;
+            if (m_string.isEmpty())
+                return m_vertices;
+
+            // The geometry is created in the same way as sf::Text does it, so that the text looks exactly the same
+            const bool bold = (m_style & sf::Text::Bold) != 0;
+            const bool underlined = (m_style & sf::Text::Underlined) != 0;
+        #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+            const bool strikeThrough = (m_style & sf::Text::StrikeThrough) != 0;
+        #else
+            const bool strikeThrough = false;
+        #endif
+            const float italicShear = (m_style & sf::Text::Italic) ? 0.209f : 0.f; // 12 degrees
+            const float underlineOffset = font.getUnderlinePosition(m_characterSize);
+            const float underlineThickness = font.getUnderlineThickness(m_characterSize);
+
+            const sf::FloatRect xBounds = font.getGlyph('x', m_characterSize, bold).bounds;
+            const float strikeThroughOffset = xBounds.top + xBounds.height / 2.f;
+
+            const float whitespaceWidth = static_cast<float>(font.getGlyph(' ', m_characterSize, bold).advance);
+            const float lineSpacing = font.getLineSpacing(m_characterSize);
+
+            m_vertices.reserve(m_string.getSize() * 6);
+
+            float x = 0;
+            float y = static_cast<float>(m_characterSize);
+            std::uint32_t prevChar = 0;
+            for (const std::uint32_t curChar : m_string)
+            {
+                if (curChar == '\r')
+                    continue;
+
+                x += font.getKerning(prevChar, curChar, m_characterSize);
+
+                // Finish the underline and strike through at the end of every line
+                if ((curChar == '\n') && (prevChar != '\n'))
+                {
+                    if (underlined)
+                        addLine(m_vertices, x, y, underlineOffset, underlineThickness);
+                    if (strikeThrough)
+                        addLine(m_vertices, x, y, strikeThroughOffset, underlineThickness);
+                }
+
+                prevChar = curChar;
+
+                if (curChar == ' ')
+                    x += whitespaceWidth;
+                else if (curChar == '\t')
+                    x += whitespaceWidth * 4;
+                else if (curChar == '\n')
+                {
+                    y += lineSpacing;
+                    x = 0;
+                }
+                else
+                {
+                    const sf::Glyph& glyph = font.getGlyph(curChar, m_characterSize, bold);
+                    addGlyphQuad(m_vertices, {x, y}, glyph, italicShear);
+                    x += static_cast<float>(glyph.advance);
+                }
+            }
+
+            if (x > 0)
+            {
+                if (underlined)
+                    addLine(m_vertices, x, y, underlineOffset, underlineThickness);
+                if (strikeThrough)
+                    addLine(m_vertices, x, y, strikeThroughOffset, underlineThickness);
+            }
+
+            // The layout is shared and never changes again, so it shouldn't keep more memory than needed
+            m_vertices.shrink_to_fit();
+            return m_vertices;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t TextLayout::getMemoryUsage() const
+        {
+            return sizeof(TextLayout) + (m_string.getSize() * sizeof(sf::Uint32)) + (m_vertices.capacity() * sizeof(sf::Vertex));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::shared_ptr<const TextLayout> TextLayoutCache::get(const std::shared_ptr<sf::Font>& font, unsigned int characterSize,
+                                                               sf::Uint32 style, const sf::String& string)
+        {
+            const std::size_t hash = calculateHash(font.get(), characterSize, style, string);
+            const auto range = entryLookup.equal_range(hash);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                const auto entryIt = it->second;
+                const TextLayout& layout = *entryIt->layout;
+                if ((entryIt->fontPtr != font.get()) || (layout.m_characterSize != characterSize)
+                 || (layout.m_style != style) || (layout.m_string != string))
+                    continue;
+
+                // The font was destroyed and a new one was created at the same address
+                if (entryIt->font.expired())
+                {
+                    removeEntry(entryIt);
+                    break;
+                }
+
+                statistics.hits++;
+                entries.splice(entries.begin(), entries, entryIt);
+                return entryIt->layout;
+            }
+
+            statistics.misses++;
+            auto layout = std::make_shared<TextLayout>(string, characterSize, style, measureString(font, characterSize, style, string));
+            if (maxEntries == 0)
+                return layout;
+
+            if (string.getSize() > maxStringLength)
+            {
+                statistics.uncached++;
+                return layout;
+            }
+
+            const std::size_t entryMemoryUsage = estimateMemoryUsage(string);
+            entries.push_front({font.get(), font, hash, entryMemoryUsage, layout});
+            entryLookup.insert({hash, entries.begin()});
+            totalMemoryUsage += entryMemoryUsage;
+            removeLeastRecentlyUsedEntries();
+            return layout;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void TextLayoutCache::setCapacity(std::size_t capacity)
+        {
+            maxEntries = capacity;
+            removeLeastRecentlyUsedEntries();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t TextLayoutCache::getCapacity()
+        {
+            return maxEntries;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void TextLayoutCache::setMemoryLimit(std::size_t bytes)
+        {
+            maxMemoryUsage = bytes;
+            removeLeastRecentlyUsedEntries();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t TextLayoutCache::getMemoryLimit()
+        {
+            return maxMemoryUsage;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t TextLayoutCache::getMaximumStringLength()
+        {
+            return maxStringLength;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void TextLayoutCache::invalidate(const sf::Font* font)
+        {
+            for (auto it = entries.begin(); it != entries.end();)
+            {
+                const auto entryIt = it++;
+                if (entryIt->fontPtr == font)
+                    removeEntry(entryIt);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void TextLayoutCache::clear()
+        {
+            entryLookup.clear();
+            entries.clear();
+            totalMemoryUsage = 0;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        TextLayoutCache::Statistics TextLayoutCache::getStatistics()
+        {
+            Statistics result = statistics;
+            result.entryCount = entries.size();
+            for (const auto& entry : entries)
+                result.memoryUsage += sizeof(Entry) + sizeof(std::pair<const std::size_t, std::list<Entry>::iterator>) + entry.layout->getMemoryUsage();
+
+            return result;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void TextLayoutCache::resetStatistics()
+        {
+            statistics = {};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
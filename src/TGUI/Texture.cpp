@@ -208,7 +208,7 @@ namespace tgui
     Vector2f Texture::getImageSize() const
     {
         if (m_data)
-            return sf::Vector2f{m_data->texture.getSize()};
+            return sf::Vector2f{m_data->getSize()};
         else
             return {0,0};
     }
@@ -217,8 +217,21 @@ namespace tgui
 
     void Texture::setSmooth(bool smooth)
     {
-        if (m_data)
-            m_data->texture.setSmooth(smooth);
+        if (!m_data)
+            return;
+
+        // The texture atlas is never smoothed, so the image has to be moved to a separate texture
+        if (smooth && m_data->atlasTexture && m_data->image)
+        {
+            if (m_data->texture.loadFromImage(*m_data->image, m_data->rect))
+            {
+                m_data->atlasTexture = nullptr;
+                m_data->atlasOffset = {};
+                m_data->atlasSize = {};
+            }
+        }
+
+        m_data->texture.setSmooth(smooth);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -226,7 +239,7 @@ namespace tgui
     bool Texture::isSmooth() const
     {
         if (m_data)
-            return m_data->texture.isSmooth();
+            return m_data->getTexture().isSmooth();
         else
             return false;
     }
@@ -263,7 +276,7 @@ namespace tgui
         if (!m_data || !m_data->image)
             return false;
 
-        assert(pixel.x < m_data->texture.getSize().x && pixel.y < m_data->texture.getSize().y);
+        assert(pixel.x < m_data->getSize().x && pixel.y < m_data->getSize().y);
 
         if (m_data->image->getPixel(pixel.x + m_data->rect.left, pixel.y + m_data->rect.top).a == 0)
             return true;
@@ -342,7 +355,7 @@ namespace tgui
         m_data = data;
 
         if (middleRect == sf::IntRect{})
-            m_middleRect = {0, 0, static_cast<int>(m_data->texture.getSize().x), static_cast<int>(m_data->texture.getSize().y)};
+            m_middleRect = {0, 0, static_cast<int>(m_data->getSize().x), static_cast<int>(m_data->getSize().y)};
         else
             m_middleRect = middleRect;
     }
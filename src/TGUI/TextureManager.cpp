@@ -27,125 +27,326 @@
 #include <TGUI/TextureManager.hpp>
 #include <TGUI/Exception.hpp>
 
+#include <algorithm>
+#include <functional>
+#include <set>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
-    std::map<std::string, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    namespace
+    {
+        // Images that are loaded completely are only packed into an atlas page when they aren't larger than this
+        const unsigned int maxPackedImageSize = 256;
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Size of the textures in which the small images are packed together
+        const unsigned int atlasPageSize = 1024;
 
-    std::shared_ptr<TextureData> TextureManager::getTexture(Texture& texture, const std::string& filename, const sf::IntRect& partRect)
-    {
-        // Look if we already had this image
-        auto imageIt = m_imageMap.find(filename);
-        if (imageIt != m_imageMap.end())
+        // Amount of empty pixels between images in an atlas page
+        const unsigned int atlasPadding = 1;
+
+        struct AtlasShelf
+        {
+            unsigned int top;
+            unsigned int height;
+            unsigned int width;
+        };
+
+        struct AtlasPage
+        {
+            std::shared_ptr<sf::Texture> texture;
+            std::vector<AtlasShelf> shelves;
+        };
+
+        // Textures containing several small images
+        std::vector<AtlasPage> atlasPages;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        unsigned int getMaximumAtlasSize()
+        {
+            return std::min(atlasPageSize, sf::Texture::getMaximumSize());
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Finds free space in one of the atlas pages and returns the page in which the space was reserved
+        std::shared_ptr<sf::Texture> reserveAtlasSpace(sf::Vector2u size, sf::Vector2u& offset)
         {
-            // Loop all our textures to find the one containing the image
-            for (auto dataIt = imageIt->second.begin(); dataIt != imageIt->second.end(); ++dataIt)
+            const unsigned int pageSize = getMaximumAtlasSize();
+            const unsigned int width = size.x + atlasPadding;
+            const unsigned int height = size.y + atlasPadding;
+            if ((width > pageSize) || (height > pageSize))
+                return nullptr;
+
+            // Pages of which all images were removed are no longer needed
+            atlasPages.erase(std::remove_if(atlasPages.begin(), atlasPages.end(),
+                                            [](const AtlasPage& page){ return page.texture.use_count() == 1; }),
+                             atlasPages.end());
+
+            for (auto& page : atlasPages)
             {
-                // Only reuse the texture when the exact same part of the image is used
-                if (dataIt->data->rect == partRect)
+                // Try to put the image on an existing shelf
+                for (auto& shelf : page.shelves)
                 {
-                    // The texture is now used at multiple places
-                    ++(dataIt->users);
+                    if ((height <= shelf.height) && (shelf.width + width <= pageSize))
+                    {
+                        offset = {shelf.width, shelf.top};
+                        shelf.width += width;
+                        return page.texture;
+                    }
+                }
 
-                    // Let the texture alert the texture manager when it is being copied or destroyed
-                    texture.setCopyCallback(&TextureManager::copyTexture);
-                    texture.setDestructCallback(&TextureManager::removeTexture);
-                    return dataIt->data;
+                // Try to start a new shelf below the existing ones
+                const unsigned int top = page.shelves.empty() ? 0 : page.shelves.back().top + page.shelves.back().height;
+                if (top + height <= pageSize)
+                {
+                    page.shelves.push_back({top, height, width});
+                    offset = {0, top};
+                    return page.texture;
                 }
             }
+
+            // There is no room left in the existing pages, so create a new page
+            AtlasPage page;
+            page.texture = std::make_shared<sf::Texture>();
+            if (!page.texture->create(pageSize, pageSize))
+                return nullptr;
+
+            page.shelves.push_back({0, height, width});
+            offset = {0, 0};
+            atlasPages.push_back(std::move(page));
+            return atlasPages.back().texture;
         }
-        else // The image doesn't exist yet
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Makes the texture data refer to a part of an atlas texture instead of to its own texture.
+        // The image texture is shared between all parts of the same image and is created when it doesn't exist yet.
+        bool storeInAtlas(TextureData& data, std::shared_ptr<sf::Texture>& imageTexture)
         {
-            auto it = m_imageMap.insert({filename, {}});
-            imageIt = it.first;
+            const sf::Vector2u imageSize = data.image->getSize();
+            if ((imageSize.x == 0) || (imageSize.y == 0))
+                return false;
+
+            if (data.rect != sf::IntRect{})
+            {
+                // The part has to lie inside the image, the texture would be cropped otherwise
+                if ((data.rect.left < 0) || (data.rect.top < 0) || (data.rect.width <= 0) || (data.rect.height <= 0)
+                 || (static_cast<unsigned int>(data.rect.left + data.rect.width) > imageSize.x)
+                 || (static_cast<unsigned int>(data.rect.top + data.rect.height) > imageSize.y))
+                    return false;
+
+                // All parts of the same image share a texture containing the entire image
+                if (!imageTexture)
+                {
+                    if ((imageSize.x > sf::Texture::getMaximumSize()) || (imageSize.y > sf::Texture::getMaximumSize()))
+                        return false;
+
+                    auto texture = std::make_shared<sf::Texture>();
+                    if (!texture->loadFromImage(*data.image))
+                        return false;
+
+                    imageTexture = texture;
+                }
+
+                data.atlasTexture = imageTexture;
+                data.atlasOffset = {static_cast<unsigned int>(data.rect.left), static_cast<unsigned int>(data.rect.top)};
+                data.atlasSize = {static_cast<unsigned int>(data.rect.width), static_cast<unsigned int>(data.rect.height)};
+                return true;
+            }
+            else // The entire image is used
+            {
+                if ((imageSize.x > maxPackedImageSize) || (imageSize.y > maxPackedImageSize))
+                    return false;
+
+                sf::Vector2u offset;
+                auto page = reserveAtlasSpace(imageSize, offset);
+                if (!page)
+                    return false;
+
+                page->update(*data.image, offset.x, offset.y);
+
+                data.atlasTexture = page;
+                data.atlasOffset = offset;
+                data.atlasSize = imageSize;
+                return true;
+            }
         }
+    }
 
-        // Add new data to the list
-        TextureDataHolder dataHolder;
-        dataHolder.filename = filename;
-        dataHolder.users = 1;
-        dataHolder.data = std::make_shared<TextureData>();
-        dataHolder.data->rect = partRect;
-        imageIt->second.push_back(std::move(dataHolder));
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unordered_map<TextureManager::TextureKey, TextureDataHolder, TextureManager::TextureKeyHash> TextureManager::m_textureMap;
+    std::unordered_map<const TextureData*, TextureDataHolder*> TextureManager::m_textureDataMap;
+    std::unordered_map<std::string, TextureManager::ImageHolder> TextureManager::m_imageMap;
+    bool TextureManager::m_atlasEnabled = false;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::TextureKeyHash::operator()(const TextureKey& key) const
+    {
+        std::size_t hash = std::hash<std::string>{}(key.filename);
+        for (const int value : {key.rect.left, key.rect.top, key.rect.width, key.rect.height})
+            hash ^= std::hash<int>{}(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+
+        return hash;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::shared_ptr<TextureData> TextureManager::getTexture(Texture& texture, const std::string& filename, const sf::IntRect& partRect)
+    {
         // Let the texture alert the texture manager when it is being copied or destroyed
         texture.setCopyCallback(&TextureManager::copyTexture);
         texture.setDestructCallback(&TextureManager::removeTexture);
 
-        // Load the image
-        auto data = imageIt->second.back().data;
-        data->image = texture.getImageLoader()(filename);
-        if (data->image != nullptr)
+        // Only reuse the texture when the exact same part of the image is used
+        auto textureIt = m_textureMap.find({filename, partRect});
+        if (textureIt != m_textureMap.end())
         {
-            // Create a texture from the image
-            bool loadFromImageSuccess;
-            if (partRect == sf::IntRect{})
-                loadFromImageSuccess = data->texture.loadFromImage(*data->image);
-            else
-                loadFromImageSuccess = data->texture.loadFromImage(*data->image, partRect);
-
-            if (loadFromImageSuccess)
-                return data;
-            else
-                return nullptr;
+            // The texture is now used at multiple places
+            ++(textureIt->second.users);
+            return textureIt->second.data;
         }
 
+        // Other parts of the same image may already contain the pixels, in which case the image doesn't have to be loaded again
+        ImageHolder& imageHolder = m_imageMap[filename];
+        if (!imageHolder.image)
+            imageHolder.image = texture.getImageLoader()(filename);
+
         // The image could not be loaded
-        m_imageMap.erase(imageIt);
-        return nullptr;
+        if (!imageHolder.image)
+        {
+            m_imageMap.erase(filename);
+            return nullptr;
+        }
+
+        // Add new data to the list
+        auto data = std::make_shared<TextureData>();
+        data->rect = partRect;
+        data->image = imageHolder.image;
+        ++imageHolder.textureCount;
+
+        TextureDataHolder& dataHolder = m_textureMap[{filename, partRect}];
+        dataHolder.filename = filename;
+        dataHolder.users = 1;
+        dataHolder.data = data;
+        m_textureDataMap[data.get()] = &dataHolder;
+
+        if (m_atlasEnabled && storeInAtlas(*data, imageHolder.atlasTexture))
+            return data;
+
+        // Create a texture from the image
+        bool loadFromImageSuccess;
+        if (partRect == sf::IntRect{})
+            loadFromImageSuccess = data->texture.loadFromImage(*data->image);
+        else
+            loadFromImageSuccess = data->texture.loadFromImage(*data->image, partRect);
+
+        if (loadFromImageSuccess)
+            return data;
+        else
+            return nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextureManager::copyTexture(std::shared_ptr<TextureData> textureDataToCopy)
     {
-        // Loop all our textures to check if we already have this one
-        for (auto& dataHolder : m_imageMap)
+        auto it = m_textureDataMap.find(textureDataToCopy.get());
+        if (it == m_textureDataMap.end())
+            throw Exception{"Trying to copy texture data that was not loaded by the TextureManager."};
+
+        // The texture is now used at multiple places
+        ++(it->second->users);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeTexture(std::shared_ptr<TextureData> textureDataToRemove)
+    {
+        auto it = m_textureDataMap.find(textureDataToRemove.get());
+        if (it == m_textureDataMap.end())
+            throw Exception{"Trying to remove a texture that was not loaded by the TextureManager."};
+
+        // If this was the only place where the texture is used then delete it
+        TextureDataHolder& dataHolder = *it->second;
+        if (--dataHolder.users == 0)
         {
-            for (auto& data : dataHolder.second)
-            {
-                // Check if the pointer points to our texture
-                if (data.data == textureDataToCopy)
-                {
-                    // The texture is now used at multiple places
-                    ++data.users;
-                    return;
-                }
-            }
+            // The image is no longer needed when no other part of it is still being used
+            auto imageIt = m_imageMap.find(dataHolder.filename);
+            if ((imageIt != m_imageMap.end()) && (--(imageIt->second.textureCount) == 0))
+                m_imageMap.erase(imageIt);
+
+            m_textureDataMap.erase(it);
+            m_textureMap.erase({dataHolder.filename, textureDataToRemove->rect});
         }
+    }
 
-        throw Exception{"Trying to copy texture data that was not loaded by the TextureManager."};
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAtlasEnabled(bool enabled)
+    {
+        m_atlasEnabled = enabled;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextureManager::removeTexture(std::shared_ptr<TextureData> textureDataToRemove)
+    bool TextureManager::isAtlasEnabled()
+    {
+        return m_atlasEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextureManager::Statistics TextureManager::getStatistics()
     {
-        // Loop all our textures to check which one it is
-        for (auto imageIt = m_imageMap.begin(); imageIt != m_imageMap.end(); ++imageIt)
+        Statistics stats;
+
+        std::set<const sf::Texture*> atlasTextures;
+        for (const auto& pair : m_textureMap)
         {
-            for (auto dataIt = imageIt->second.begin(); dataIt != imageIt->second.end(); ++dataIt)
+            const TextureData& data = *pair.second.data;
+            const sf::Vector2u size = data.getSize();
+
+            ++stats.textureCount;
+            stats.gpuMemoryWithoutAtlas += std::size_t{size.x} * size.y * 4;
+
+            if (data.atlasTexture)
             {
-                // Check if the pointer points to our texture
-                if (dataIt->data == textureDataToRemove)
-                {
-                    // If this was the only place where the texture is used then delete it
-                    if (--(dataIt->users) == 0)
-                    {
-                        imageIt->second.erase(dataIt);
-                        if (imageIt->second.empty())
-                            m_imageMap.erase(imageIt);
-                    }
+                ++stats.atlasTextureCount;
+                atlasTextures.insert(data.atlasTexture.get());
+            }
 
-                    return;
-                }
+            // A texture that was moved out of the atlas is uploaded separately
+            if (data.texture.getSize() != sf::Vector2u{})
+            {
+                ++stats.gpuTextureCount;
+                stats.gpuMemory += std::size_t{data.texture.getSize().x} * data.texture.getSize().y * 4;
             }
         }
 
-        throw Exception{"Trying to remove a texture that was not loaded by the TextureManager."};
+        for (const auto& pair : m_imageMap)
+        {
+            ++stats.imageCount;
+            stats.imageMemory += std::size_t{pair.second.image->getSize().x} * pair.second.image->getSize().y * 4;
+        }
+
+        for (const auto& page : atlasPages)
+        {
+            if (atlasTextures.count(page.texture.get()))
+                ++stats.atlasPageCount;
+        }
+
+        for (const auto* atlasTexture : atlasTextures)
+        {
+            ++stats.gpuTextureCount;
+            stats.gpuMemory += std::size_t{atlasTexture->getSize().x} * atlasTexture->getSize().y * 4;
+        }
+
+        return stats;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
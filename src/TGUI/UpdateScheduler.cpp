@@ -0,0 +1,128 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/UpdateScheduler.hpp>
+#include <TGUI/Container.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void UpdateScheduler::schedule(Widget& widget, sf::Time delay)
+        {
+            if (delay < sf::Time::Zero)
+                delay = sf::Time::Zero;
+
+            const auto it = m_scheduledWidgetIndices.find(&widget);
+            if (it != m_scheduledWidgetIndices.end())
+            {
+                // The entry may belong to a destroyed widget that had the same address
+                Entry& entry = m_scheduledWidgets[it->second];
+                if (entry.widget.lock().get() != &widget)
+                {
+                    entry = {widget.shared_from_this(), m_time + delay};
+                    return;
+                }
+
+                if (m_time + delay < entry.deadline)
+                    entry.deadline = m_time + delay;
+
+                return;
+            }
+
+            m_scheduledWidgetIndices[&widget] = m_scheduledWidgets.size();
+            m_scheduledWidgets.push_back({widget.shared_from_this(), m_time + delay});
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void UpdateScheduler::update(sf::Time elapsedTime, const Widget& root)
+        {
+            m_time += elapsedTime;
+
+            if (m_scheduledWidgets.empty())
+                return;
+
+            m_updatingWidgets.swap(m_scheduledWidgets);
+            m_scheduledWidgetIndices.clear();
+
+            for (const auto& entry : m_updatingWidgets)
+            {
+                const auto widget = entry.widget.lock();
+                if (!widget)
+                    continue;
+
+                // Skip the widget if it was removed from the gui after being scheduled.
+                // Hidden widgets don't receive time either, they are scheduled again when they are shown.
+                bool visible = widget->isVisible();
+                const Widget* topWidget = widget.get();
+                while (topWidget->getParent())
+                {
+                    topWidget = topWidget->getParent();
+                    visible = visible && topWidget->isVisible();
+                }
+
+                if ((topWidget == &root) && visible)
+                    widget->update(elapsedTime);
+            }
+
+            m_updatingWidgets.clear();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool UpdateScheduler::getTimeUntilNextUpdate(sf::Time& time) const
+        {
+            if (m_scheduledWidgets.empty())
+                return false;
+
+            sf::Time earliestDeadline = m_scheduledWidgets[0].deadline;
+            for (const auto& entry : m_scheduledWidgets)
+            {
+                if (entry.deadline < earliestDeadline)
+                    earliestDeadline = entry.deadline;
+            }
+
+            time = (earliestDeadline > m_time) ? (earliestDeadline - m_time) : sf::Time::Zero;
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t UpdateScheduler::getScheduledWidgetCount() const
+        {
+            return m_scheduledWidgets.size();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
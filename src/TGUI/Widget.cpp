@@ -26,10 +26,11 @@
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/Animation.hpp>
+#include <TGUI/LayoutScheduler.hpp>
 #include <TGUI/Vector2f.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
 #include <SFML/System/Err.hpp>
-#include <SFML/Graphics/RectangleShape.hpp>
+#include <TGUI/BatchRenderer.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -39,6 +40,14 @@ namespace tgui
 
     namespace
     {
+        GuiContainer* findGui(Container* parent)
+        {
+            while (parent && parent->getParent())
+                parent = parent->getParent();
+
+            return dynamic_cast<GuiContainer*>(parent);
+        }
+
         void addAnimation(std::vector<std::shared_ptr<priv::Animation>>& existingAnimations, std::shared_ptr<priv::Animation> newAnimation)
         {
             const auto type = newAnimation->getType();
@@ -64,7 +73,7 @@ namespace tgui
 
     Widget::Widget()
     {
-        m_renderer->subscribe(this, m_rendererChangedCallback);
+        subscribeToRenderer();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -75,11 +84,16 @@ namespace tgui
         if (m_renderer)
             m_renderer->unsubscribe(this);
 
-        for (auto& layout : m_boundPositionLayouts)
-            layout->unbindWidget();
+        if (m_sideStorage)
+        {
+            for (auto& layout : m_sideStorage->boundPositionLayouts)
+                layout->unbindWidget();
+
+            for (auto& layout : m_sideStorage->boundSizeLayouts)
+                layout->unbindWidget();
+        }
 
-        for (auto& layout : m_boundSizeLayouts)
-            layout->unbindWidget();
+        LayoutScheduler::widgetDestroyed(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -90,25 +104,30 @@ namespace tgui
         m_type                         {other.m_type},
         m_position                     {other.m_position},
         m_size                         {other.m_size},
-        m_boundPositionLayouts         {},
-        m_boundSizeLayouts             {},
         m_enabled                      {other.m_enabled},
         m_visible                      {other.m_visible},
         m_parent                       {nullptr},
         m_draggableWidget              {other.m_draggableWidget},
         m_containerWidget              {other.m_containerWidget},
-        m_toolTip                      {other.m_toolTip ? other.m_toolTip->clone() : nullptr},
         m_renderer                     {other.m_renderer},
-        m_showAnimations               {other.m_showAnimations},
         m_fontCached                   {other.m_fontCached},
-        m_opacityCached                {other.m_opacityCached}
+        m_opacityCached                {other.m_opacityCached},
+        m_animatedOpacity              {other.m_animatedOpacity}
     {
+        // The tool tip and animations are copied, but the layouts bound to the other widget are not
+        if (other.m_sideStorage && (other.m_sideStorage->toolTip || !other.m_sideStorage->showAnimations.empty()))
+        {
+            m_sideStorage = make_unique<SideStorage>();
+            m_sideStorage->toolTip = other.m_sideStorage->toolTip ? other.m_sideStorage->toolTip->clone() : nullptr;
+            m_sideStorage->showAnimations = other.m_sideStorage->showAnimations;
+        }
+
         m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
         m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
         m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
         m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
-        m_renderer->subscribe(this, m_rendererChangedCallback);
+        subscribeToRenderer();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -125,8 +144,6 @@ namespace tgui
         m_type                         {std::move(other.m_type)},
         m_position                     {std::move(other.m_position)},
         m_size                         {std::move(other.m_size)},
-        m_boundPositionLayouts         {std::move(other.m_boundPositionLayouts)},
-        m_boundSizeLayouts             {std::move(other.m_boundSizeLayouts)},
         m_enabled                      {std::move(other.m_enabled)},
         m_visible                      {std::move(other.m_visible)},
         m_parent                       {nullptr},
@@ -136,11 +153,11 @@ namespace tgui
         m_animationTimeElapsed         {std::move(other.m_animationTimeElapsed)},
         m_draggableWidget              {std::move(other.m_draggableWidget)},
         m_containerWidget              {std::move(other.m_containerWidget)},
-        m_toolTip                      {std::move(other.m_toolTip)},
         m_renderer                     {other.m_renderer},
-        m_showAnimations               {std::move(other.m_showAnimations)},
         m_fontCached                   {std::move(other.m_fontCached)},
-        m_opacityCached                {std::move(other.m_opacityCached)}
+        m_opacityCached                {std::move(other.m_opacityCached)},
+        m_animatedOpacity              {std::move(other.m_animatedOpacity)},
+        m_sideStorage                  {std::move(other.m_sideStorage)}
     {
         m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
         m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
@@ -148,7 +165,7 @@ namespace tgui
         m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
         other.m_renderer->unsubscribe(&other);
-        m_renderer->subscribe(this, m_rendererChangedCallback);
+        subscribeToRenderer();
 
         other.m_renderer = nullptr;
     }
@@ -174,8 +191,6 @@ namespace tgui
             m_type                 = other.m_type;
             m_position             = other.m_position;
             m_size                 = other.m_size;
-            m_boundPositionLayouts = {};
-            m_boundSizeLayouts     = {};
             m_enabled              = other.m_enabled;
             m_visible              = other.m_visible;
             m_parent               = nullptr;
@@ -185,18 +200,28 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_draggableWidget      = other.m_draggableWidget;
             m_containerWidget      = other.m_containerWidget;
-            m_toolTip              = other.m_toolTip ? other.m_toolTip->clone() : nullptr;
             m_renderer             = other.m_renderer;
-            m_showAnimations       = {};
             m_fontCached           = other.m_fontCached;
             m_opacityCached        = other.m_opacityCached;
+            m_animatedOpacity      = other.m_animatedOpacity;
+
+            // The user data is kept and the tool tip is copied
+            if (m_sideStorage)
+            {
+                m_sideStorage->boundPositionLayouts = {};
+                m_sideStorage->boundSizeLayouts = {};
+                m_sideStorage->showAnimations = {};
+                m_sideStorage->toolTip = nullptr;
+            }
+            if (other.m_sideStorage && other.m_sideStorage->toolTip)
+                getSideStorage().toolTip = other.m_sideStorage->toolTip->clone();
 
             m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
             m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
             m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
             m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
-            m_renderer->subscribe(this, m_rendererChangedCallback);
+            subscribeToRenderer();
         }
 
         return *this;
@@ -223,8 +248,6 @@ namespace tgui
             m_type                 = std::move(other.m_type);
             m_position             = std::move(other.m_position);
             m_size                 = std::move(other.m_size);
-            m_boundPositionLayouts = std::move(other.m_boundPositionLayouts);
-            m_boundSizeLayouts     = std::move(other.m_boundSizeLayouts);
             m_enabled              = std::move(other.m_enabled);
             m_visible              = std::move(other.m_visible);
             m_parent               = nullptr;
@@ -234,18 +257,18 @@ namespace tgui
             m_animationTimeElapsed = std::move(other.m_animationTimeElapsed);
             m_draggableWidget      = std::move(other.m_draggableWidget);
             m_containerWidget      = std::move(other.m_containerWidget);
-            m_toolTip              = std::move(other.m_toolTip);
             m_renderer             = std::move(other.m_renderer);
-            m_showAnimations       = std::move(other.m_showAnimations);
             m_fontCached           = std::move(other.m_fontCached);
             m_opacityCached        = std::move(other.m_opacityCached);
+            m_animatedOpacity      = std::move(other.m_animatedOpacity);
+            m_sideStorage          = std::move(other.m_sideStorage);
 
             m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
             m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
             m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
             m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
-            m_renderer->subscribe(this, m_rendererChangedCallback);
+            subscribeToRenderer();
 
             other.m_renderer = nullptr;
         }
@@ -265,44 +288,23 @@ namespace tgui
         // Update the data
         m_renderer->unsubscribe(this);
         m_renderer->setData(rendererData);
-        m_renderer->subscribe(this, m_rendererChangedCallback);
+        subscribeToRenderer();
         rendererData->shared = true;
 
-        // Tell the widget about all the updated properties, both new ones and old ones that were now reset to their default value
-        auto oldIt = oldData->propertyValuePairs.begin();
-        auto newIt = rendererData->propertyValuePairs.begin();
-        while (oldIt != oldData->propertyValuePairs.end() && newIt != rendererData->propertyValuePairs.end())
-        {
-            if (oldIt->first < newIt->first)
-            {
-                // Update values that no longer exist in the new renderer and are now reset to the default value
-                rendererChanged(oldIt->first);
-                ++oldIt;
-            }
-            else
-            {
-                // Update changed and new properties
-                rendererChanged(newIt->first);
-
-                if (newIt->first < oldIt->first)
-                    ++newIt;
-                else
-                {
-                    ++oldIt;
-                    ++newIt;
-                }
-            }
-        }
-        while (oldIt != oldData->propertyValuePairs.end())
+        // Tell the widget about all the updated properties, both new ones and old ones that were now reset to their default value.
+        // The properties are accessed by position because rendererChanged may add default values to the renderer.
+        for (const auto& pair : oldData->propertyValuePairs)
         {
-            rendererChanged(oldIt->first);
-            ++oldIt;
-        }
-        while (newIt != rendererData->propertyValuePairs.end())
-        {
-            rendererChanged(newIt->first);
-            ++newIt;
+            if (rendererData->propertyValuePairs.find(pair.first) == rendererData->propertyValuePairs.end())
+                rendererChanged(pair.first);
         }
+
+        const std::size_t propertyCount = rendererData->propertyValuePairs.size();
+        for (std::size_t i = 0; i < propertyCount; ++i)
+            rendererChanged((rendererData->propertyValuePairs.begin() + i)->first);
+
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -324,15 +326,8 @@ namespace tgui
 
     const WidgetRenderer* Widget::getRenderer() const
     {
-        if (m_renderer->getData()->shared)
-        {
-            m_renderer->unsubscribe(this);
-            m_renderer->setData(m_renderer->clone());
-            m_renderer->subscribe(this, m_rendererChangedCallback);
-            m_renderer->getData()->shared = false;
-        }
-
-        // You should not be allowed to call setters on the renderer when the widget is const
+        // You should not be allowed to call setters on the renderer when the widget is const,
+        // so the renderer can't be changed through it and there is no need to make a copy when it is shared
         return m_renderer.get();
     }
 
@@ -344,7 +339,7 @@ namespace tgui
         {
             m_renderer->unsubscribe(this);
             m_renderer->setData(m_renderer->clone());
-            m_renderer->subscribe(this, m_rendererChangedCallback);
+            subscribeToRenderer();
             m_renderer->getData()->shared = false;
         }
 
@@ -361,12 +356,20 @@ namespace tgui
 
         if (getPosition() != m_prevPosition)
         {
+            // Both the area that the widget left and the one it moved to have to be redrawn
+            invalidateArea(m_prevPosition + getWidgetOffset(), getFullSize());
             m_prevPosition = getPosition();
+            invalidate();
+
             onPositionChange.emit(this, getPosition());
 
-            for (auto& layout : m_boundPositionLayouts)
-                layout->recalculateValue();
+            // The layouts that depend on this widget are recalculated by the scheduler
+            if (m_sideStorage && !m_sideStorage->boundPositionLayouts.empty())
+                LayoutScheduler::widgetMoved(this);
         }
+
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -379,12 +382,20 @@ namespace tgui
 
         if (getSize() != m_prevSize)
         {
+            invalidateArea(getPosition() + getWidgetOffset(), getFullSize() - getSize() + m_prevSize);
             m_prevSize = getSize();
+            invalidate();
+
             onSizeChange.emit(this, getSize());
 
-            for (auto& layout : m_boundSizeLayouts)
-                layout->recalculateValue();
+            // The layouts that depend on this widget are recalculated by the scheduler
+            if (m_sideStorage && !m_sideStorage->boundSizeLayouts.empty())
+                LayoutScheduler::widgetResized(this);
         }
+
+        // The full size of the widget may have changed even when the size didn't change
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -413,6 +424,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    FloatRect Widget::getHitTestBounds() const
+    {
+        return {getPosition() + getWidgetOffset(), getFullSize()};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::showWithEffect(ShowAnimationType type, sf::Time duration)
     {
         setVisible(true);
@@ -421,21 +439,21 @@ namespace tgui
         {
             case ShowAnimationType::Fade:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::FadeAnimation>(shared_from_this(), 0.f, getInheritedOpacity(), duration));
-                setInheritedOpacity(0);
+                addAnimation(getSideStorage().showAnimations, std::make_shared<priv::FadeAnimation>(shared_from_this(), 0.f, 1.f, duration));
+                m_animatedOpacity = 0;
                 break;
             }
             case ShowAnimationType::Scale:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), getPosition() + (getSize() / 2.f), getPosition(), duration));
-                addAnimation(m_showAnimations, std::make_shared<priv::ResizeAnimation>(shared_from_this(), Vector2f{0, 0}, getSize(), duration));
+                addAnimation(getSideStorage().showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), getPosition() + (getSize() / 2.f), getPosition(), duration));
+                addAnimation(getSideStorage().showAnimations, std::make_shared<priv::ResizeAnimation>(shared_from_this(), Vector2f{0, 0}, getSize(), duration));
                 setPosition(getPosition() + (getSize() / 2.f));
                 setSize(0, 0);
                 break;
             }
             case ShowAnimationType::SlideFromLeft:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{-getFullSize().x, getPosition().y}, getPosition(), duration));
+                addAnimation(getSideStorage().showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{-getFullSize().x, getPosition().y}, getPosition(), duration));
                 setPosition({-getFullSize().x, getPosition().y});
                 break;
             }
@@ -443,7 +461,7 @@ namespace tgui
             {
                 if (getParent())
                 {
-                    addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getParent()->getSize().x + getWidgetOffset().x, getPosition().y}, getPosition(), duration));
+                    addAnimation(getSideStorage().showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getParent()->getSize().x + getWidgetOffset().x, getPosition().y}, getPosition(), duration));
                     setPosition({getParent()->getSize().x + getWidgetOffset().x, getPosition().y});
                 }
                 else
@@ -455,7 +473,7 @@ namespace tgui
             }
             case ShowAnimationType::SlideFromTop:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getPosition().x, -getFullSize().y}, getPosition(), duration));
+                addAnimation(getSideStorage().showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getPosition().x, -getFullSize().y}, getPosition(), duration));
                 setPosition({getPosition().x, -getFullSize().y});
                 break;
             }
@@ -463,7 +481,7 @@ namespace tgui
             {
                 if (getParent())
                 {
-                    addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getPosition().x, getParent()->getSize().y + getWidgetOffset().y}, getPosition(), duration));
+                    addAnimation(getSideStorage().showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getPosition().x, getParent()->getSize().y + getWidgetOffset().y}, getPosition(), duration));
                     setPosition({getPosition().x, getParent()->getSize().y + getWidgetOffset().y});
                 }
                 else
@@ -474,6 +492,8 @@ namespace tgui
                 break;
             }
         }
+
+        scheduleUpdate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -487,20 +507,19 @@ namespace tgui
         {
             case ShowAnimationType::Fade:
             {
-                float opacity = getInheritedOpacity();
-                addAnimation(m_showAnimations, std::make_shared<priv::FadeAnimation>(shared_from_this(), getInheritedOpacity(), 0.f, duration, [=](){ setVisible(false); setInheritedOpacity(opacity); }));
+                addAnimation(getSideStorage().showAnimations, std::make_shared<priv::FadeAnimation>(shared_from_this(), m_animatedOpacity, 0.f, duration, [=](){ setVisible(false); m_animatedOpacity = 1; }));
                 break;
             }
             case ShowAnimationType::Scale:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, position + (size / 2.f), duration, [=](){ setVisible(false); setPosition(position); setSize(size); }));
-                addAnimation(m_showAnimations, std::make_shared<priv::ResizeAnimation>(shared_from_this(), size, Vector2f{0, 0}, duration, [=](){ setVisible(false); setPosition(position); setSize(size); }));
+                addAnimation(getSideStorage().showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, position + (size / 2.f), duration, [=](){ setVisible(false); setPosition(position); setSize(size); }));
+                addAnimation(getSideStorage().showAnimations, std::make_shared<priv::ResizeAnimation>(shared_from_this(), size, Vector2f{0, 0}, duration, [=](){ setVisible(false); setPosition(position); setSize(size); }));
                 break;
             }
             case ShowAnimationType::SlideToRight:
             {
                 if (getParent())
-                    addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{getParent()->getSize().x + getWidgetOffset().x, position.y}, duration, [=](){ setVisible(false); setPosition(position); }));
+                    addAnimation(getSideStorage().showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{getParent()->getSize().x + getWidgetOffset().x, position.y}, duration, [=](){ setVisible(false); setPosition(position); }));
                 else
                 {
                     TGUI_PRINT_WARNING("hideWithEffect(SlideToRight) does not work before widget has a parent.");
@@ -510,13 +529,13 @@ namespace tgui
             }
             case ShowAnimationType::SlideToLeft:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{-getFullSize().x, position.y}, duration, [=](){ setVisible(false); setPosition(position); }));
+                addAnimation(getSideStorage().showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{-getFullSize().x, position.y}, duration, [=](){ setVisible(false); setPosition(position); }));
                 break;
             }
             case ShowAnimationType::SlideToBottom:
             {
                 if (getParent())
-                    addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{position.x, getParent()->getSize().y + getWidgetOffset().y}, duration, [=](){ setVisible(false); setPosition(position); }));
+                    addAnimation(getSideStorage().showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{position.x, getParent()->getSize().y + getWidgetOffset().y}, duration, [=](){ setVisible(false); setPosition(position); }));
                 else
                 {
                     TGUI_PRINT_WARNING("hideWithEffect(SlideToBottom) does not work before widget has a parent.");
@@ -526,17 +545,24 @@ namespace tgui
             }
             case ShowAnimationType::SlideToTop:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{position.x, -getFullSize().y}, duration, [=](){ setVisible(false); setPosition(position); }));
+                addAnimation(getSideStorage().showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{position.x, -getFullSize().y}, duration, [=](){ setVisible(false); setPosition(position); }));
                 break;
             }
         }
+
+        scheduleUpdate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::setVisible(bool visible)
     {
+        // Hidden widgets don't receive time, so the widget may have been waiting for time while it was hidden
+        if (visible && !m_visible)
+            scheduleUpdate();
+
         m_visible = visible;
+        invalidate();
 
         // If the widget is hiden while still focused then it must be unfocused
         if (!visible)
@@ -548,6 +574,7 @@ namespace tgui
     void Widget::setEnabled(bool enabled)
     {
         m_enabled = enabled;
+        invalidate();
 
         if (!enabled)
         {
@@ -580,6 +607,8 @@ namespace tgui
             m_focused = false;
             onUnfocus.emit(this);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -611,6 +640,10 @@ namespace tgui
     {
         m_inheritedFont = font;
         rendererChanged("font");
+        invalidate();
+
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -626,6 +659,7 @@ namespace tgui
     {
         m_inheritedOpacity = opacity;
         rendererChanged("opacity");
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -637,16 +671,24 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float Widget::getAnimatedOpacity() const
+    {
+        return m_animatedOpacity;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::setToolTip(Widget::Ptr toolTip)
     {
-        m_toolTip = toolTip;
+        if (toolTip || m_sideStorage)
+            getSideStorage().toolTip = toolTip;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Widget::Ptr Widget::getToolTip() const
     {
-        return m_toolTip;
+        return m_sideStorage ? m_sideStorage->toolTip : nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -667,13 +709,20 @@ namespace tgui
 
     void Widget::setParent(Container* parent)
     {
+        // The widget disappears from its old location and appears in the new parent
+        invalidate();
         m_parent = parent;
+        invalidate();
 
         // Give the layouts another chance to find widgets to which it refers
         m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
         m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
         m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
         m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
+
+        // The widget may have been waiting for time while it wasn't part of the gui
+        if (parent)
+            scheduleUpdate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -682,13 +731,40 @@ namespace tgui
     {
         m_animationTimeElapsed += elapsedTime;
 
-        for (unsigned int i = 0; i < m_showAnimations.size();)
+        if (!m_sideStorage || m_sideStorage->showAnimations.empty())
+            return;
+
+        auto& animations = m_sideStorage->showAnimations;
+        for (unsigned int i = 0; i < animations.size();)
         {
-            if (m_showAnimations[i]->update(elapsedTime))
-                m_showAnimations.erase(m_showAnimations.begin() + i);
+            if (animations[i]->update(elapsedTime))
+                animations.erase(animations.begin() + i);
             else
                 i++;
         }
+
+        invalidate();
+        if (!animations.empty())
+            scheduleUpdate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::scheduleUpdate(sf::Time delay)
+    {
+        // Only the gui passes time to the widgets
+        GuiContainer* gui = findGui(m_parent);
+        if (gui)
+            gui->scheduleWidgetUpdate(*this, delay);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::invalidate()
+    {
+        // Widgets that draw outside their full size (e.g. open menus) tell this through their hit-test bounds
+        const FloatRect bounds = getHitTestBounds();
+        invalidateArea({bounds.left, bounds.top}, {bounds.width, bounds.height});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -760,7 +836,7 @@ namespace tgui
 
     Widget::Ptr Widget::askToolTip(Vector2f mousePos)
     {
-        if (m_toolTip && mouseOnWidget(mousePos))
+        if (m_sideStorage && m_sideStorage->toolTip && mouseOnWidget(mousePos))
             return getToolTip();
         else
             return nullptr;
@@ -770,28 +846,30 @@ namespace tgui
 
     void Widget::bindPositionLayout(Layout* layout)
     {
-        m_boundPositionLayouts.insert(layout);
+        getSideStorage().boundPositionLayouts.insert(layout);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::unbindPositionLayout(Layout* layout)
     {
-        m_boundPositionLayouts.erase(layout);
+        if (m_sideStorage)
+            m_sideStorage->boundPositionLayouts.erase(layout);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::bindSizeLayout(Layout* layout)
     {
-        m_boundSizeLayouts.insert(layout);
+        getSideStorage().boundSizeLayouts.insert(layout);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::unbindSizeLayout(Layout* layout)
     {
-        m_boundSizeLayouts.erase(layout);
+        if (m_sideStorage)
+            m_sideStorage->boundSizeLayouts.erase(layout);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -818,11 +896,13 @@ namespace tgui
 
     void Widget::rendererChanged(const std::string& property)
     {
-        if (property == "opacity")
+        const priv::PropertyId id = priv::makePropertyId(property);
+
+        if (id == priv::makePropertyId("opacity"))
         {
             m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
         }
-        else if (property == "font")
+        else if (id == priv::makePropertyId("font"))
         {
             if (getSharedRenderer()->getFont())
                 m_fontCached = getSharedRenderer()->getFont();
@@ -979,6 +1059,7 @@ namespace tgui
     void Widget::mouseEnteredWidget()
     {
         m_mouseHover = true;
+        invalidate();
         onMouseEnter.emit(this);
     }
 
@@ -987,6 +1068,7 @@ namespace tgui
     void Widget::mouseLeftWidget()
     {
         m_mouseHover = false;
+        invalidate();
         onMouseLeave.emit(this);
     }
 
@@ -994,7 +1076,49 @@ namespace tgui
 
     void Widget::rendererChangedCallback(const std::string& property)
     {
+        // The property may change the size of the widget, so the area is marked both before and after the change
+        invalidate();
         rendererChanged(property);
+        invalidate();
+
+        // Properties like borders or textures can change the full size of the widget
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::invalidateArea(Vector2f position, Vector2f size)
+    {
+        // Containers that keep their child widgets in a texture have to draw them again
+        for (Container* parent = m_parent; parent != nullptr; parent = parent->getParent())
+            parent->invalidateRenderCache();
+
+        GuiContainer* gui = findGui(m_parent);
+        if (!gui)
+            return;
+
+        // The gui only knows about absolute positions
+        position += m_parent->getAbsolutePosition() + m_parent->getChildWidgetsOffset();
+        gui->invalidateRegion({position, size});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::subscribeToRenderer()
+    {
+        // The callback is created here instead of being stored in every widget
+        m_renderer->subscribe(this, [this](const std::string& property){ rendererChangedCallback(property); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Color Widget::applyOpacity(const Color& color) const
+    {
+        if (!color.isSet())
+            return color;
+
+        return Color::calcColorOpacity(color, m_opacityCached);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1004,14 +1128,10 @@ namespace tgui
                                     Vector2f size,
                                     Color color) const
     {
-        sf::RectangleShape shape{size};
-
         if (m_opacityCached < 1)
-            shape.setFillColor(Color::calcColorOpacity(color, m_opacityCached));
-        else
-            shape.setFillColor(color);
+            color = Color::calcColorOpacity(color, m_opacityCached);
 
-        target.draw(shape, states);
+        drawFadedRectangleShape(target, states, size, color);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1020,17 +1140,47 @@ namespace tgui
                              const sf::RenderStates& states,
                              const Borders& borders,
                              Vector2f size,
-                             Color borderColor) const
+                             Color color) const
     {
-        const Color color = Color::calcColorOpacity(borderColor, m_opacityCached);
+        drawFadedBorders(target, states, borders, size, Color::calcColorOpacity(color, m_opacityCached));
+    }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::drawFadedRectangleShape(sf::RenderTarget& target,
+                                         const sf::RenderStates& states,
+                                         Vector2f size,
+                                         Color color) const
+    {
+        const sf::Vertex vertices[] = {
+            {{0, 0}, color},
+            {{size.x, 0}, color},
+            {{0, size.y}, color},
+            {{size.x, size.y}, color}
+        };
+
+        priv::BatchRenderer::draw(target, vertices, 4, sf::PrimitiveType::TrianglesStrip, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::drawFadedBorders(sf::RenderTarget& target,
+                                  const sf::RenderStates& states,
+                                  const Borders& borders,
+                                  Vector2f size,
+                                  Color color) const
+    {
         // If size is too small then draw entire size as border
         if ((size.x <= borders.getLeft() + borders.getRight()) || (size.y <= borders.getTop() + borders.getBottom()))
         {
-            sf::RectangleShape border;
-            border.setFillColor(color);
-            border.setSize({size.x, size.y});
-            target.draw(border, states);
+            const sf::Vertex vertices[] = {
+                {{0, 0}, color},
+                {{size.x, 0}, color},
+                {{0, size.y}, color},
+                {{size.x, size.y}, color}
+            };
+
+            priv::BatchRenderer::draw(target, vertices, 4, sf::PrimitiveType::TrianglesStrip, states);
         }
         else // Draw borders in the normal way
         {
@@ -1044,7 +1194,7 @@ namespace tgui
             // |              | //
             // 2--------------4 //
             //////////////////////
-            const std::vector<sf::Vertex> vertices = {
+            const sf::Vertex vertices[] = {
                 {{0, 0}, color},
                 {{borders.getLeft(), 0}, color},
                 {{0, size.y}, color},
@@ -1057,7 +1207,7 @@ namespace tgui
                 {{borders.getLeft(), borders.getTop()}, color}
             };
 
-            target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+            priv::BatchRenderer::draw(target, vertices, 10, sf::PrimitiveType::TrianglesStrip, states);
         }
     }
 
@@ -73,6 +73,8 @@ namespace tgui
 
         if (m_autoSize)
             updateSize();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -82,6 +84,7 @@ namespace tgui
         m_glyphTexture = image;
         m_glyphSprite.setTexture(m_glyphTexture);
         updateSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -97,6 +100,7 @@ namespace tgui
     {
         m_relativeGlyphHeight = relativeHeight;
         updateSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -143,7 +147,7 @@ namespace tgui
         // Draw the borders
         if (m_bordersCached != Borders{0})
         {
-            drawBorders(target, states, m_bordersCached, getSize(), getCurrentBorderColor());
+            drawFadedBorders(target, states, m_bordersCached, getSize(), getCurrentBorderColor());
             states.transform.translate({m_bordersCached.getLeft(), m_bordersCached.getTop()});
         }
 
@@ -170,7 +174,7 @@ namespace tgui
         }
         else // There is no background texture
         {
-            drawRectangleShape(target, states, getInnerSize(), getCurrentBackgroundColor());
+            drawFadedRectangleShape(target, states, getInnerSize(), getCurrentBackgroundColor());
         }
 
         Clipping clipping(target, states, {}, getInnerSize());
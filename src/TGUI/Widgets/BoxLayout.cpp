@@ -142,12 +142,14 @@ namespace tgui
 
     void BoxLayout::rendererChanged(const std::string& property)
     {
-        if (property == "spacebetweenwidgets")
+        const priv::PropertyId id = priv::makePropertyId(property);
+
+        if (id == priv::makePropertyId("spacebetweenwidgets"))
         {
             m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
             updateWidgets();
         }
-        else if (property == "padding")
+        else if (id == priv::makePropertyId("padding"))
         {
             Group::rendererChanged(property);
 
@@ -116,6 +116,7 @@ namespace tgui
     {
         m_string = text;
         m_text.setString(text);
+        invalidate();
 
         // Set the text size when the text has a fixed size
         if (m_textSize != 0)
@@ -251,80 +252,88 @@ namespace tgui
 
     void Button::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        const priv::PropertyId id = priv::makePropertyId(property);
+
+        if (id == priv::makePropertyId("borders"))
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             updateSize();
         }
-        else if ((property == "textcolor") || (property == "textcolorhover") || (property == "textcolordown") || (property == "textcolordisabled") || (property == "textcolorfocused")
-              || (property == "textstyle") || (property == "textstylehover") || (property == "textstyledown") || (property == "textstyledisabled") || (property == "textstylefocused"))
+        else if ((id == priv::makePropertyId("textcolor")) || (id == priv::makePropertyId("textcolorhover")) || (id == priv::makePropertyId("textcolordown")) || (id == priv::makePropertyId("textcolordisabled")) || (id == priv::makePropertyId("textcolorfocused"))
+              || (id == priv::makePropertyId("textstyle")) || (id == priv::makePropertyId("textstylehover")) || (id == priv::makePropertyId("textstyledown")) || (id == priv::makePropertyId("textstyledisabled")) || (id == priv::makePropertyId("textstylefocused")))
         {
             updateTextColorAndStyle();
         }
-        else if (property == "texture")
+        else if (id == priv::makePropertyId("texture"))
         {
             m_sprite.setTexture(getSharedRenderer()->getTexture());
         }
-        else if (property == "texturehover")
+        else if (id == priv::makePropertyId("texturehover"))
         {
             m_spriteHover.setTexture(getSharedRenderer()->getTextureHover());
         }
-        else if (property == "texturedown")
+        else if (id == priv::makePropertyId("texturedown"))
         {
             m_spriteDown.setTexture(getSharedRenderer()->getTextureDown());
         }
-        else if (property == "texturedisabled")
+        else if (id == priv::makePropertyId("texturedisabled"))
         {
             m_spriteDisabled.setTexture(getSharedRenderer()->getTextureDisabled());
         }
-        else if (property == "texturefocused")
+        else if (id == priv::makePropertyId("texturefocused"))
         {
             m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
         }
-        else if (property == "bordercolor")
+        else if (id == priv::makePropertyId("bordercolor"))
         {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
+            m_borderColorCached = applyOpacity(getSharedRenderer()->getBorderColor());
         }
-        else if (property == "bordercolorhover")
+        else if (id == priv::makePropertyId("bordercolorhover"))
         {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+            m_borderColorHoverCached = applyOpacity(getSharedRenderer()->getBorderColorHover());
         }
-        else if (property == "bordercolordown")
+        else if (id == priv::makePropertyId("bordercolordown"))
         {
-            m_borderColorDownCached = getSharedRenderer()->getBorderColorDown();
+            m_borderColorDownCached = applyOpacity(getSharedRenderer()->getBorderColorDown());
         }
-        else if (property == "bordercolordisabled")
+        else if (id == priv::makePropertyId("bordercolordisabled"))
         {
-            m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
+            m_borderColorDisabledCached = applyOpacity(getSharedRenderer()->getBorderColorDisabled());
         }
-        else if (property == "bordercolorfocused")
+        else if (id == priv::makePropertyId("bordercolorfocused"))
         {
-            m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
+            m_borderColorFocusedCached = applyOpacity(getSharedRenderer()->getBorderColorFocused());
         }
-        else if (property == "backgroundcolor")
+        else if (id == priv::makePropertyId("backgroundcolor"))
         {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+            m_backgroundColorCached = applyOpacity(getSharedRenderer()->getBackgroundColor());
         }
-        else if (property == "backgroundcolorhover")
+        else if (id == priv::makePropertyId("backgroundcolorhover"))
         {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+            m_backgroundColorHoverCached = applyOpacity(getSharedRenderer()->getBackgroundColorHover());
         }
-        else if (property == "backgroundcolordown")
+        else if (id == priv::makePropertyId("backgroundcolordown"))
         {
-            m_backgroundColorDownCached = getSharedRenderer()->getBackgroundColorDown();
+            m_backgroundColorDownCached = applyOpacity(getSharedRenderer()->getBackgroundColorDown());
         }
-        else if (property == "backgroundcolordisabled")
+        else if (id == priv::makePropertyId("backgroundcolordisabled"))
         {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+            m_backgroundColorDisabledCached = applyOpacity(getSharedRenderer()->getBackgroundColorDisabled());
         }
-        else if (property == "backgroundcolorfocused")
+        else if (id == priv::makePropertyId("backgroundcolorfocused"))
         {
-            m_backgroundColorFocusedCached = getSharedRenderer()->getBackgroundColorFocused();
+            m_backgroundColorFocusedCached = applyOpacity(getSharedRenderer()->getBackgroundColorFocused());
         }
-        else if (property == "opacity")
+        else if (id == priv::makePropertyId("opacity"))
         {
             Widget::rendererChanged(property);
 
+            // The cached colors have the opacity applied to them, so they are updated as well
+            for (const char* colorProperty : {"bordercolor", "bordercolorhover", "bordercolordown", "bordercolordisabled",
+                                              "bordercolorfocused", "backgroundcolor", "backgroundcolorhover",
+                                              "backgroundcolordown", "backgroundcolordisabled", "backgroundcolorfocused"})
+                rendererChanged(colorProperty);
+
             m_sprite.setOpacity(m_opacityCached);
             m_spriteHover.setOpacity(m_opacityCached);
             m_spriteDown.setOpacity(m_opacityCached);
@@ -333,7 +342,7 @@ namespace tgui
 
             m_text.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (id == priv::makePropertyId("font"))
         {
             Widget::rendererChanged(property);
 
@@ -471,7 +480,7 @@ namespace tgui
         // Draw the borders
         if (m_bordersCached != Borders{0})
         {
-            drawBorders(target, states, m_bordersCached, getSize(), getCurrentBorderColor());
+            drawFadedBorders(target, states, m_bordersCached, getSize(), getCurrentBorderColor());
             states.transform.translate({m_bordersCached.getLeft(), m_bordersCached.getTop()});
         }
 
@@ -491,7 +500,7 @@ namespace tgui
         }
         else // There is no background texture
         {
-            drawRectangleShape(target, states, getInnerSize(), getCurrentBackgroundColor());
+            drawFadedRectangleShape(target, states, getInnerSize(), getCurrentBackgroundColor());
         }
 
         // If the button has a text then also draw the text
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Canvas.hpp>
+#include <TGUI/BatchRenderer.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -142,15 +143,20 @@ namespace tgui
     void Canvas::display()
     {
         m_renderTexture.display();
+
+        // The new contents of the canvas have to be shown on the screen
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Canvas::rendererChanged(const std::string& property)
     {
+        const priv::PropertyId id = priv::makePropertyId(property);
+
         Widget::rendererChanged(property);
 
-        if (property == "opacity")
+        if (id == priv::makePropertyId("opacity"))
             m_sprite.setColor(Color::calcColorOpacity(Color::White, getSharedRenderer()->getOpacity()));
     }
 
@@ -159,7 +165,7 @@ namespace tgui
     void Canvas::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(getPosition());
-        target.draw(m_sprite, states);
+        priv::BatchRenderer::draw(target, m_sprite, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,8 @@
 #include <TGUI/Widgets/ChatBox.hpp>
 #include <TGUI/Clipping.hpp>
 
+#include <algorithm>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -135,18 +137,22 @@ namespace tgui
         line.string = text;
         line.text.setColor(color);
         line.text.setOpacity(m_opacityCached);
-        line.text.setCharacterSize(m_textSize);
-        line.text.setString(text);
-        line.text.setFont(m_fontCached);
-
-        recalculateLineText(line);
 
+        // The line is only word-wrapped when it becomes visible
+        const float height = getUnwrappedLineHeight(line);
         if (m_newLinesBelowOthers)
+        {
             m_lines.push_back(std::move(line));
+            m_lineHeights.pushBack(height);
+        }
         else
+        {
             m_lines.push_front(std::move(line));
+            m_lineHeights.pushFront(height);
+        }
 
         recalculateFullTextHeight();
+        wrapVisibleLines();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -180,8 +186,10 @@ namespace tgui
         if (lineIndex < m_lines.size())
         {
             m_lines.erase(m_lines.begin() + lineIndex);
+            m_lineHeights.erase(lineIndex);
 
             recalculateFullTextHeight();
+            wrapVisibleLines();
             return true;
         }
         else // Index too high
@@ -193,6 +201,7 @@ namespace tgui
     void ChatBox::removeAllLines()
     {
         m_lines.clear();
+        m_lineHeights.clear();
 
         recalculateFullTextHeight();
     }
@@ -214,11 +223,24 @@ namespace tgui
         if ((m_maxLines > 0) && (m_maxLines < m_lines.size()))
         {
             if (m_newLinesBelowOthers)
-                m_lines.erase(m_lines.begin(), m_lines.begin() + m_lines.size() - m_maxLines);
+            {
+                while (m_lines.size() > m_maxLines)
+                {
+                    m_lines.pop_front();
+                    m_lineHeights.popFront();
+                }
+            }
             else
-                m_lines.erase(m_lines.begin() + m_maxLines, m_lines.end());
+            {
+                while (m_lines.size() > m_maxLines)
+                {
+                    m_lines.pop_back();
+                    m_lineHeights.popBack();
+                }
+            }
 
             recalculateFullTextHeight();
+            wrapVisibleLines();
         }
     }
 
@@ -236,9 +258,6 @@ namespace tgui
         m_textSize = size;
         m_scroll->setScrollAmount(size);
 
-        for (auto& line : m_lines)
-            line.text.setCharacterSize(size);
-
         recalculateAllLines();
     }
 
@@ -269,6 +288,7 @@ namespace tgui
     {
         if (m_linesStartFromTop != startFromTop)
             m_linesStartFromTop = startFromTop;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -308,7 +328,10 @@ namespace tgui
 
         // Pass the event to the scrollbar
         if (m_scroll->mouseOnWidget(pos - getPosition()))
+        {
             m_scroll->leftMousePressed(pos - getPosition());
+            wrapVisibleLines();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -316,7 +339,10 @@ namespace tgui
     void ChatBox::leftMouseReleased(Vector2f pos)
     {
         if (m_scroll->isMouseDown())
+        {
             m_scroll->leftMouseReleased(pos - getPosition());
+            wrapVisibleLines();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -328,7 +354,10 @@ namespace tgui
 
         // Pass the event to the scrollbar when the mouse is on top of it or when we are dragging its thumb
         if (((m_scroll->isMouseDown()) && (m_scroll->isMouseDownOnThumb())) || m_scroll->mouseOnWidget(pos - getPosition()))
+        {
             m_scroll->mouseMoved(pos - getPosition());
+            wrapVisibleLines();
+        }
         else
             m_scroll->mouseNoLongerOnWidget();
     }
@@ -354,14 +383,22 @@ namespace tgui
     void ChatBox::mouseWheelScrolled(float delta, Vector2f pos)
     {
         if (m_scroll->getLowValue() < m_scroll->getMaximum())
+        {
             m_scroll->mouseWheelScrolled(delta, pos - getPosition());
+            wrapVisibleLines();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ChatBox::recalculateLineText(Line& line)
     {
+        line.wrapped = true;
+
+        // The string is cleared first to avoid measuring the old text when the font or text size changes
         line.text.setString("");
+        line.text.setCharacterSize(m_textSize);
+        line.text.setFont(m_fontCached);
 
         // Find the maximum width of one line
         const float maxWidth = getInnerSize().x - m_scroll->getSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight();
@@ -373,21 +410,68 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float ChatBox::getUnwrappedLineHeight(const Line& line) const
+    {
+        if (!m_fontCached)
+            return 0;
+
+        const std::size_t lineCount = 1 + std::count(line.string.begin(), line.string.end(), '\n');
+        return lineCount * m_fontCached.getLineSpacing(m_textSize) + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::wrapVisibleLines()
+    {
+        const float viewHeight = getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom();
+
+        // Word-wrapping a line changes its height, which could bring other lines into view
+        bool linesWrapped = true;
+        while (linesWrapped)
+        {
+            linesWrapped = false;
+
+            const float viewTop = static_cast<float>(m_scroll->getValue());
+            std::size_t index = m_lineHeights.findIndex(viewTop);
+            float lineTop = m_lineHeights.getOffset(index);
+            for (; (index < m_lines.size()) && (lineTop < viewTop + viewHeight); ++index)
+            {
+                if (!m_lines[index].wrapped)
+                {
+                    recalculateLineText(m_lines[index]);
+                    m_lineHeights.setHeight(index, m_lines[index].text.getSize().y);
+                    linesWrapped = true;
+                }
+
+                lineTop += m_lineHeights.getHeight(index);
+            }
+
+            if (linesWrapped)
+                recalculateFullTextHeight();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChatBox::recalculateAllLines()
     {
+        // Lines are word-wrapped again once they are visible, until then they are assumed not to need word-wrapping
+        m_lineHeights.clear();
         for (auto& line : m_lines)
-            recalculateLineText(line);
+        {
+            line.wrapped = false;
+            m_lineHeights.pushBack(getUnwrappedLineHeight(line));
+        }
 
         recalculateFullTextHeight();
+        wrapVisibleLines();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ChatBox::recalculateFullTextHeight()
     {
-        m_fullTextHeight = 0;
-        for (const auto& line : m_lines)
-            m_fullTextHeight += line.text.getSize().y;
+        m_fullTextHeight = m_lineHeights.getTotalHeight();
 
         // Update the maximum of the scrollbar
         const unsigned int oldMaximum = m_scroll->getMaximum();
@@ -402,55 +486,59 @@ namespace tgui
                 m_scroll->setValue(m_scroll->getMaximum() - m_scroll->getLowValue());
             }
         }
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ChatBox::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        const priv::PropertyId id = priv::makePropertyId(property);
+
+        if (id == priv::makePropertyId("borders"))
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == "padding")
+        else if (id == priv::makePropertyId("padding"))
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             setSize(m_size);
         }
-        else if (property == "texturebackground")
+        else if (id == priv::makePropertyId("texturebackground"))
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == "scrollbar")
+        else if (id == priv::makePropertyId("scrollbar"))
         {
             m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
         }
-        else if (property == "bordercolor")
+        else if (id == priv::makePropertyId("bordercolor"))
         {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
+            m_borderColorCached = applyOpacity(getSharedRenderer()->getBorderColor());
         }
-        else if (property == "backgroundcolor")
+        else if (id == priv::makePropertyId("backgroundcolor"))
         {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+            m_backgroundColorCached = applyOpacity(getSharedRenderer()->getBackgroundColor());
         }
-        else if (property == "opacity")
+        else if (id == priv::makePropertyId("opacity"))
         {
             Widget::rendererChanged(property);
 
+            // The cached colors have the opacity applied to them, so they are updated as well
+            for (const char* colorProperty : {"bordercolor", "backgroundcolor"})
+                rendererChanged(colorProperty);
+
             m_spriteBackground.setOpacity(m_opacityCached);
             m_scroll->setInheritedOpacity(m_opacityCached);
 
             for (auto& line : m_lines)
                 line.text.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (id == priv::makePropertyId("font"))
         {
             Widget::rendererChanged(property);
 
-            for (auto& line : m_lines)
-                line.text.setFont(m_fontCached);
-
             recalculateAllLines();
         }
         else
@@ -551,7 +639,7 @@ namespace tgui
         // Draw the borders
         if (m_bordersCached != Borders{0})
         {
-            drawBorders(target, states, m_bordersCached, getSize(), m_borderColorCached);
+            drawFadedBorders(target, states, m_bordersCached, getSize(), m_borderColorCached);
             states.transform.translate({m_bordersCached.getLeft(), m_bordersCached.getTop()});
         }
 
@@ -559,7 +647,7 @@ namespace tgui
         if (m_spriteBackground.isSet())
             m_spriteBackground.draw(target, states);
         else
-            drawRectangleShape(target, states, getInnerSize(), m_backgroundColorCached);
+            drawFadedRectangleShape(target, states, getInnerSize(), m_backgroundColorCached);
 
         // Draw the scrollbar
         m_scroll->draw(target, scrollbarStates);
@@ -576,10 +664,19 @@ namespace tgui
         if (!m_linesStartFromTop && (m_fullTextHeight + Text::getExtraVerticalPadding(m_textSize) < getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()))
             states.transform.translate(0, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - m_fullTextHeight - Text::getExtraVerticalPadding(m_textSize));
 
-        for (const auto& line : m_lines)
+        // Only draw the lines that lie inside the clipping area
+        const float viewHeight = getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom();
+        const float viewTop = static_cast<float>(m_scroll->getValue());
+        std::size_t index = m_lineHeights.findIndex(viewTop);
+        float lineTop = m_lineHeights.getOffset(index);
+        states.transform.translate(0, lineTop);
+        for (; (index < m_lines.size()) && (lineTop < viewTop + viewHeight); ++index)
         {
-            line.text.draw(target, states);
-            states.transform.translate(0, line.text.getSize().y);
+            m_lines[index].text.draw(target, states);
+
+            const float lineHeight = m_lineHeights.getHeight(index);
+            states.transform.translate(0, lineHeight);
+            lineTop += lineHeight;
         }
     }
 
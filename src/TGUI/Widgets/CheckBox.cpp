@@ -25,6 +25,7 @@
 
 #include <TGUI/Widgets/CheckBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/BatchRenderer.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <cmath>
 
@@ -121,6 +122,7 @@ namespace tgui
 
             m_checked = true;
             onCheck.emit(this, true);
+            invalidate();
         }
         else
             RadioButton::setChecked(checked);
@@ -152,12 +154,22 @@ namespace tgui
 
     void CheckBox::rendererChanged(const std::string& property)
     {
-        if (property == "textureunchecked")
+        const priv::PropertyId id = priv::makePropertyId(property);
+
+        if (id == priv::makePropertyId("textureunchecked"))
             m_textureUncheckedCached = getSharedRenderer()->getTextureUnchecked();
-        else if (property == "texturechecked")
+        else if (id == priv::makePropertyId("texturechecked"))
             m_textureCheckedCached = getSharedRenderer()->getTextureChecked();
 
         RadioButton::rendererChanged(property);
+
+        // Unlike the check of a radio button, the check of a check box is drawn without the opacity of the widget
+        if (id == priv::makePropertyId("checkcolor"))
+            m_checkColorCached = getSharedRenderer()->getCheckColor();
+        else if (id == priv::makePropertyId("checkcolorhover"))
+            m_checkColorHoverCached = getSharedRenderer()->getCheckColorHover();
+        else if (id == priv::makePropertyId("checkcolordisabled"))
+            m_checkColorDisabledCached = getSharedRenderer()->getCheckColorDisabled();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -191,7 +203,7 @@ namespace tgui
 
         // Draw the borders
         if (m_bordersCached != Borders{0})
-            drawBorders(target, states, m_bordersCached, getSize(), getCurrentBorderColor());
+            drawFadedBorders(target, states, m_bordersCached, getSize(), getCurrentBorderColor());
 
         states.transform.translate({m_bordersCached.getLeft(), m_bordersCached.getTop()});
         if (m_spriteUnchecked.isSet() && m_spriteChecked.isSet())
@@ -234,7 +246,7 @@ namespace tgui
         }
         else // There are no images
         {
-            drawRectangleShape(target, states, getInnerSize(), getCurrentBackgroundColor());
+            drawFadedRectangleShape(target, states, getInnerSize(), getCurrentBackgroundColor());
 
             if (m_checked)
             {
@@ -247,7 +259,7 @@ namespace tgui
                 const Vector2f rightPoint = {0.86f * size.x, 0.28f * size.y};
                 const float x = (lineThickness / 2.f) * std::cos(pi / 4.f);
                 const float y = (lineThickness / 2.f) * std::sin(pi / 4.f);
-                const std::vector<sf::Vertex> vertices = {
+                const sf::Vertex vertices[] = {
                     {{leftPoint.x - x, leftPoint.y + y}, checkColor},
                     {{leftPoint.x + x, leftPoint.y - y}, checkColor},
                     {{middlePoint.x, middlePoint.y + 2*y}, checkColor},
@@ -256,7 +268,7 @@ namespace tgui
                     {{rightPoint.x - x, rightPoint.y - y}, checkColor}
                 };
 
-                target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+                priv::BatchRenderer::draw(target, vertices, 6, sf::PrimitiveType::TrianglesStrip, states);
             }
         }
         states.transform.translate({-m_bordersCached.getLeft(), -m_bordersCached.getTop()});
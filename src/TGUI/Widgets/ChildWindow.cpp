@@ -250,6 +250,7 @@ namespace tgui
 
         // Reposition the images and text
         setPosition(m_position);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -269,6 +270,7 @@ namespace tgui
             m_titleText.setCharacterSize(m_titleTextSize);
         else
             m_titleText.setCharacterSize(Text::findBestTextSize(m_fontCached, m_titleBarHeightCached * 0.8f));
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -286,6 +288,7 @@ namespace tgui
 
         // Reposition the images and text
         setPosition(m_position);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -344,6 +347,7 @@ namespace tgui
             m_minimizeButton->setVisible(false);
 
         updateTitleBarHeight();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -691,16 +695,18 @@ namespace tgui
 
     void ChildWindow::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        const priv::PropertyId id = priv::makePropertyId(property);
+
+        if (id == priv::makePropertyId("borders"))
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == "titlecolor")
+        else if (id == priv::makePropertyId("titlecolor"))
         {
             m_titleText.setColor(getSharedRenderer()->getTitleColor());
         }
-        else if (property == "texturetitlebar")
+        else if (id == priv::makePropertyId("texturetitlebar"))
         {
             m_spriteTitleBar.setTexture(getSharedRenderer()->getTextureTitleBar());
 
@@ -709,27 +715,27 @@ namespace tgui
             if (m_titleBarHeightCached == m_spriteTitleBar.getTexture().getImageSize().y)
                 updateTitleBarHeight();
         }
-        else if (property == "titlebarheight")
+        else if (id == priv::makePropertyId("titlebarheight"))
         {
             m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
             updateTitleBarHeight();
         }
-        else if (property == "distancetoside")
+        else if (id == priv::makePropertyId("distancetoside"))
         {
             m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
             setPosition(m_position);
         }
-        else if (property == "paddingbetweenbuttons")
+        else if (id == priv::makePropertyId("paddingbetweenbuttons"))
         {
             m_paddingBetweenButtonsCached = getSharedRenderer()->getPaddingBetweenButtons();
             setPosition(m_position);
         }
-        else if (property == "showtextontitlebuttons")
+        else if (id == priv::makePropertyId("showtextontitlebuttons"))
         {
             m_showTextOnTitleButtonsCached = getSharedRenderer()->getShowTextOnTitleButtons();
             setTitleButtons(m_titleButtons);
         }
-        else if (property == "closebutton")
+        else if (id == priv::makePropertyId("closebutton"))
         {
             if (m_closeButton->isVisible())
             {
@@ -739,7 +745,7 @@ namespace tgui
 
             updateTitleBarHeight();
         }
-        else if (property == "maximizebutton")
+        else if (id == priv::makePropertyId("maximizebutton"))
         {
             if (m_maximizeButton->isVisible())
             {
@@ -749,7 +755,7 @@ namespace tgui
 
             updateTitleBarHeight();
         }
-        else if (property == "minimizebutton")
+        else if (id == priv::makePropertyId("minimizebutton"))
         {
             if (m_minimizeButton->isVisible())
             {
@@ -759,22 +765,26 @@ namespace tgui
 
             updateTitleBarHeight();
         }
-        else if (property == "backgroundcolor")
+        else if (id == priv::makePropertyId("backgroundcolor"))
         {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+            m_backgroundColorCached = applyOpacity(getSharedRenderer()->getBackgroundColor());
         }
-        else if (property == "titlebarcolor")
+        else if (id == priv::makePropertyId("titlebarcolor"))
         {
-            m_titleBarColorCached = getSharedRenderer()->getTitleBarColor();
+            m_titleBarColorCached = applyOpacity(getSharedRenderer()->getTitleBarColor());
         }
-        else if (property == "bordercolor")
+        else if (id == priv::makePropertyId("bordercolor"))
         {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
+            m_borderColorCached = applyOpacity(getSharedRenderer()->getBorderColor());
         }
-        else if (property == "opacity")
+        else if (id == priv::makePropertyId("opacity"))
         {
             Container::rendererChanged(property);
 
+            // The cached colors have the opacity applied to them, so they are updated as well
+            for (const char* colorProperty : {"backgroundcolor", "titlebarcolor", "bordercolor"})
+                rendererChanged(colorProperty);
+
             for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
             {
                 if (button->isVisible())
@@ -784,7 +794,7 @@ namespace tgui
             m_titleText.setOpacity(m_opacityCached);
             m_spriteTitleBar.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (id == priv::makePropertyId("font"))
         {
             Container::rendererChanged(property);
 
@@ -914,7 +924,7 @@ namespace tgui
         if (m_spriteTitleBar.isSet())
             m_spriteTitleBar.draw(target, states);
         else
-            drawRectangleShape(target, states, {sizeIncludingBorders.x, m_titleBarHeightCached}, m_titleBarColorCached);
+            drawFadedRectangleShape(target, states, {sizeIncludingBorders.x, m_titleBarHeightCached}, m_titleBarColorCached);
 
         // Draw the text in the title bar (after setting the clipping area)
         {
@@ -948,13 +958,13 @@ namespace tgui
         // Draw the borders
         if (m_bordersCached != Borders{0})
         {
-            drawBorders(target, states, m_bordersCached, sizeIncludingBorders, m_borderColorCached);
+            drawFadedBorders(target, states, m_bordersCached, sizeIncludingBorders, m_borderColorCached);
             states.transform.translate({m_bordersCached.getLeft(), m_bordersCached.getTop()});
         }
 
         // Draw the background
         if (m_backgroundColorCached != Color::Transparent)
-            drawRectangleShape(target, states, getSize(), m_backgroundColorCached);
+            drawFadedRectangleShape(target, states, getSize(), m_backgroundColorCached);
 
         // Draw the widgets in the child window
         const Clipping clipping{target, states, {}, {getSize()}};
@@ -26,7 +26,7 @@
 #include <TGUI/Container.hpp>
 #include <TGUI/Widgets/ComboBox.hpp>
 #include <TGUI/Clipping.hpp>
-#include <SFML/Graphics/ConvexShape.hpp>
+#include <TGUI/BatchRenderer.hpp>
 #include <TGUI/SignalImpl.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -269,6 +269,7 @@ namespace tgui
     {
         const bool ret = m_listBox->setSelectedItem(itemName);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -278,6 +279,7 @@ namespace tgui
     {
         const bool ret = m_listBox->setSelectedItemById(id);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -287,6 +289,7 @@ namespace tgui
     {
         const bool ret = m_listBox->setSelectedItemByIndex(index);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -295,6 +298,7 @@ namespace tgui
     void ComboBox::deselectItem()
     {
         m_text.setString("");
+        invalidate();
         m_listBox->deselectItem();
     }
 
@@ -307,6 +311,7 @@ namespace tgui
         const bool ret = m_listBox->removeItem(itemName);
 
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
 
         // Shrink the list size
         if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
@@ -336,6 +341,7 @@ namespace tgui
         const bool ret = m_listBox->removeItemByIndex(index);
 
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
 
         // Shrink the list size
         if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
@@ -349,6 +355,7 @@ namespace tgui
     void ComboBox::removeAllItems()
     {
         m_text.setString("");
+        invalidate();
         m_listBox->removeAllItems();
 
         updateListBoxHeight();
@@ -388,6 +395,7 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItem(originalValue, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -397,6 +405,7 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItemById(id, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -406,6 +415,7 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItemByIndex(index, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -443,6 +453,7 @@ namespace tgui
     {
         m_listBox->setTextSize(textSize);
         m_text.setCharacterSize(m_listBox->getTextSize());
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -560,76 +571,83 @@ namespace tgui
 
     void ComboBox::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        const priv::PropertyId id = priv::makePropertyId(property);
+
+        if (id == priv::makePropertyId("borders"))
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == "padding")
+        else if (id == priv::makePropertyId("padding"))
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             setSize(m_size);
         }
-        else if (property == "textcolor")
+        else if (id == priv::makePropertyId("textcolor"))
         {
             m_text.setColor(getSharedRenderer()->getTextColor());
         }
-        else if (property == "textstyle")
+        else if (id == priv::makePropertyId("textstyle"))
         {
             m_text.setStyle(getSharedRenderer()->getTextStyle());
         }
-        else if (property == "texturebackground")
+        else if (id == priv::makePropertyId("texturebackground"))
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == "texturearrow")
+        else if (id == priv::makePropertyId("texturearrow"))
         {
             m_spriteArrow.setTexture(getSharedRenderer()->getTextureArrow());
             setSize(m_size);
         }
-        else if (property == "texturearrowhover")
+        else if (id == priv::makePropertyId("texturearrowhover"))
         {
             m_spriteArrowHover.setTexture(getSharedRenderer()->getTextureArrowHover());
         }
-        else if (property == "listbox")
+        else if (id == priv::makePropertyId("listbox"))
         {
             m_listBox->setRenderer(getSharedRenderer()->getListBox());
         }
-        else if (property == "bordercolor")
+        else if (id == priv::makePropertyId("bordercolor"))
         {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
+            m_borderColorCached = applyOpacity(getSharedRenderer()->getBorderColor());
         }
-        else if (property == "backgroundcolor")
+        else if (id == priv::makePropertyId("backgroundcolor"))
         {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+            m_backgroundColorCached = applyOpacity(getSharedRenderer()->getBackgroundColor());
         }
-        else if (property == "arrowbackgroundcolor")
+        else if (id == priv::makePropertyId("arrowbackgroundcolor"))
         {
-            m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
+            m_arrowBackgroundColorCached = applyOpacity(getSharedRenderer()->getArrowBackgroundColor());
         }
-        else if (property == "arrowbackgroundcolorhover")
+        else if (id == priv::makePropertyId("arrowbackgroundcolorhover"))
         {
-            m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
+            m_arrowBackgroundColorHoverCached = applyOpacity(getSharedRenderer()->getArrowBackgroundColorHover());
         }
-        else if (property == "arrowcolor")
+        else if (id == priv::makePropertyId("arrowcolor"))
         {
-            m_arrowColorCached = getSharedRenderer()->getArrowColor();
+            m_arrowColorCached = applyOpacity(getSharedRenderer()->getArrowColor());
         }
-        else if (property == "arrowcolorhover")
+        else if (id == priv::makePropertyId("arrowcolorhover"))
         {
-            m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
+            m_arrowColorHoverCached = applyOpacity(getSharedRenderer()->getArrowColorHover());
         }
-        else if (property == "opacity")
+        else if (id == priv::makePropertyId("opacity"))
         {
             Widget::rendererChanged(property);
 
+            // The cached colors have the opacity applied to them, so they are updated as well
+            for (const char* colorProperty : {"bordercolor", "backgroundcolor", "arrowbackgroundcolor",
+                                              "arrowbackgroundcolorhover", "arrowcolor", "arrowcolorhover"})
+                rendererChanged(colorProperty);
+
             m_spriteBackground.setOpacity(m_opacityCached);
             m_spriteArrow.setOpacity(m_opacityCached);
             m_spriteArrowHover.setOpacity(m_opacityCached);
 
             m_text.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (id == priv::makePropertyId("font"))
         {
             Widget::rendererChanged(property);
 
@@ -838,7 +856,7 @@ namespace tgui
         // Draw the borders
         if (m_bordersCached != Borders{0})
         {
-            drawBorders(target, states, m_bordersCached, getSize(), m_borderColorCached);
+            drawFadedBorders(target, states, m_bordersCached, getSize(), m_borderColorCached);
             states.transform.translate({m_bordersCached.getLeft(), m_bordersCached.getTop()});
         }
 
@@ -848,7 +866,7 @@ namespace tgui
         if (m_spriteBackground.isSet())
             m_spriteBackground.draw(target, states);
         else
-            drawRectangleShape(target, states, getInnerSize(), m_backgroundColorCached);
+            drawFadedRectangleShape(target, states, getInnerSize(), m_backgroundColorCached);
 
         // Check if we have a texture for the arrow
         float arrowSize;
@@ -868,21 +886,23 @@ namespace tgui
             states.transform.translate({getInnerSize().x - m_paddingCached.getRight() - arrowSize, m_paddingCached.getTop()});
 
             if (m_mouseHover && m_arrowBackgroundColorHoverCached.isSet())
-                drawRectangleShape(target, states, {arrowSize, arrowSize}, m_arrowBackgroundColorHoverCached);
+                drawFadedRectangleShape(target, states, {arrowSize, arrowSize}, m_arrowBackgroundColorHoverCached);
             else
-                drawRectangleShape(target, states, {arrowSize, arrowSize}, m_arrowBackgroundColorCached);
-
-            sf::ConvexShape arrow{3};
-            arrow.setPoint(0, {arrowSize / 5, arrowSize / 5});
-            arrow.setPoint(1, {arrowSize / 2, arrowSize * 4/5});
-            arrow.setPoint(2, {arrowSize * 4/5, arrowSize / 5});
+                drawFadedRectangleShape(target, states, {arrowSize, arrowSize}, m_arrowBackgroundColorCached);
 
+            Color arrowColor;
             if (m_mouseHover && m_arrowColorHoverCached.isSet())
-                arrow.setFillColor(m_arrowColorHoverCached);
+                arrowColor = m_arrowColorHoverCached;
             else
-                arrow.setFillColor(m_arrowColorCached);
+                arrowColor = m_arrowColorCached;
+
+            const sf::Vertex arrow[] = {
+                {{arrowSize / 5, arrowSize / 5}, arrowColor},
+                {{arrowSize / 2, arrowSize * 4/5}, arrowColor},
+                {{arrowSize * 4/5, arrowSize / 5}, arrowColor}
+            };
 
-            target.draw(arrow, states);
+            priv::BatchRenderer::draw(target, arrow, 3, sf::PrimitiveType::Triangles, states);
         }
 
         // Draw the selected item
@@ -165,12 +165,14 @@ namespace tgui
         }
 
         // Change the text if allowed
-        if (m_regexString == ".*")
-            m_text = text;
-        else if (std::regex_match(text.toAnsiString(), m_regex))
-            m_text = text.toAnsiString(); // Unicode is not supported when using regex because it can't be checked
-        else // Clear the text
+        if (!m_inputValidator.isValid(text))
             m_text = "";
+        else if (m_inputValidator.isUsingRegex())
+            m_text = text.toAnsiString(); // Unicode is not supported when using std::regex because it can't be checked
+        else
+            m_text = text;
+
+        m_inputValidator.textChanged(0);
 
         // Remove all the excess characters if there is a character limit
         if ((m_maxChars > 0) && (m_text.getSize() > m_maxChars))
@@ -191,6 +193,7 @@ namespace tgui
         m_textBeforeSelection.setString(m_textFull.getString());
         m_textSelection.setString("");
         m_textAfterSelection.setString("");
+        invalidate();
 
         if (!m_fontCached)
             return;
@@ -207,6 +210,7 @@ namespace tgui
                 displayedString.erase(displayedString.getSize()-1);
                 m_textFull.setString(displayedString);
                 m_text.erase(m_text.getSize()-1);
+                m_inputValidator.textChanged(m_text.getSize());
             }
 
             m_textBeforeSelection.setString(m_textFull.getString());
@@ -242,6 +246,7 @@ namespace tgui
     void EditBox::setDefaultText(const sf::String& text)
     {
         m_defaultText.setString(text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -317,6 +322,7 @@ namespace tgui
 
             // Remove all the excess characters
             m_text.erase(m_maxChars, sf::String::InvalidPos);
+            m_inputValidator.textChanged(m_maxChars);
             displayedText.erase(m_maxChars, sf::String::InvalidPos);
 
             // If we passed here then the text has changed.
@@ -372,6 +378,7 @@ namespace tgui
                 displayedString.erase(displayedString.getSize()-1);
                 m_textFull.setString(displayedString);
                 m_text.erase(m_text.getSize()-1);
+                m_inputValidator.textChanged(m_text.getSize());
             }
 
             m_textBeforeSelection.setString(m_textFull.getString());
@@ -383,6 +390,7 @@ namespace tgui
             if (m_selEnd > m_textFull.getString().getSize())
                 setCaretPosition(m_selEnd);
         }
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -431,8 +439,7 @@ namespace tgui
 
     void EditBox::setInputValidator(const std::string& regex)
     {
-        m_regexString = regex;
-        m_regex = m_regexString;
+        m_inputValidator.setPattern(regex);
 
         setText(m_text);
     }
@@ -441,7 +448,7 @@ namespace tgui
 
     const std::string& EditBox::getInputValidator() const
     {
-        return m_regexString;
+        return m_inputValidator.getPattern();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -452,6 +459,7 @@ namespace tgui
         {
             m_caretVisible = true;
             m_animationTimeElapsed = {};
+            scheduleUpdate(sf::milliseconds(500));
         }
         else // Unfocusing
         {
@@ -731,6 +739,7 @@ namespace tgui
                     displayedString.erase(m_selEnd-1, 1);
                     m_textFull.setString(displayedString);
                     m_text.erase(m_selEnd-1, 1);
+                    m_inputValidator.textChanged(m_selEnd-1);
 
                     // Set the caret back on the correct position
                     setCaretPosition(m_selEnd - 1);
@@ -770,6 +779,7 @@ namespace tgui
                     displayedString.erase(m_selEnd, 1);
                     m_textFull.setString(displayedString);
                     m_text.erase(m_selEnd, 1);
+                    m_inputValidator.textChanged(m_selEnd);
 
                     // Set the caret back on the correct position
                     setCaretPosition(m_selEnd);
@@ -814,10 +824,9 @@ namespace tgui
 
                         const std::size_t oldCaretPos = m_selEnd;
 
-                        if (m_text.getSize() > m_selEnd)
-                            setText(m_text.toWideString().substr(0, m_selEnd) + Clipboard::get() + m_text.toWideString().substr(m_selEnd, m_text.getSize() - m_selEnd));
-                        else
-                            setText(m_text + clipboardContents);
+                        sf::String newText = m_text;
+                        newText.insert(m_selEnd, clipboardContents);
+                        setText(newText);
 
                         setCaretPosition(oldCaretPos + clipboardContents.getSize());
                     }
@@ -864,24 +873,9 @@ namespace tgui
         if (m_readOnly)
             return;
 
-        // Only add the character when the regex matches
-        if (m_regexString != ".*")
-        {
-            sf::String text = m_text;
-
-            if (m_selChars == 0)
-                text.insert(m_selEnd, key);
-            else
-            {
-                const std::size_t pos = std::min(m_selStart, m_selEnd);
-                text.erase(pos, m_selChars);
-                text.insert(pos, key);
-            }
-
-            // The character has to match the regex
-            if (!std::regex_match(text.toAnsiString(), m_regex))
-                return;
-        }
+        // Only add the character when the text still matches the regex
+        if (!m_inputValidator.isValidEdit(m_text, std::min(m_selStart, m_selEnd), m_selChars, &key, 1))
+            return;
 
         // If there are selected characters then delete them first
         if (m_selChars > 0)
@@ -893,6 +887,7 @@ namespace tgui
 
         // Insert our character
         m_text.insert(m_selEnd, key);
+        m_inputValidator.textChanged(m_selEnd);
 
         // Change the displayed text
         sf::String displayedText = m_textFull.getString();
@@ -911,6 +906,7 @@ namespace tgui
             {
                 // If the text does not fit in the EditBox then delete the added character
                 m_text.erase(m_selEnd, 1);
+                m_inputValidator.textChanged(m_selEnd);
                 displayedText.erase(m_selEnd, 1);
                 m_textFull.setString(displayedText);
                 return;
@@ -943,12 +939,14 @@ namespace tgui
 
     void EditBox::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        const priv::PropertyId id = priv::makePropertyId(property);
+
+        if (id == priv::makePropertyId("borders"))
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == "padding")
+        else if (id == priv::makePropertyId("padding"))
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             m_paddingCached.updateParentSize(getSize());
@@ -957,40 +955,40 @@ namespace tgui
 
             m_caret.setSize({m_caret.getSize().x, getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
         }
-        else if (property == "caretwidth")
+        else if (id == priv::makePropertyId("caretwidth"))
         {
             m_caret.setPosition({m_caret.getPosition().x + ((m_caret.getSize().x - getSharedRenderer()->getCaretWidth()) / 2.0f), m_caret.getPosition().y});
             m_caret.setSize({getSharedRenderer()->getCaretWidth(), getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
         }
-        else if ((property == "textcolor") || (property == "textcolordisabled") || (property == "textcolorfocused"))
+        else if ((id == priv::makePropertyId("textcolor")) || (id == priv::makePropertyId("textcolordisabled")) || (id == priv::makePropertyId("textcolorfocused")))
         {
             updateTextColor();
         }
-        else if (property == "selectedtextcolor")
+        else if (id == priv::makePropertyId("selectedtextcolor"))
         {
             m_textSelection.setColor(getSharedRenderer()->getSelectedTextColor());
         }
-        else if (property == "defaulttextcolor")
+        else if (id == priv::makePropertyId("defaulttextcolor"))
         {
             m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
         }
-        else if (property == "texture")
+        else if (id == priv::makePropertyId("texture"))
         {
             m_sprite.setTexture(getSharedRenderer()->getTexture());
         }
-        else if (property == "texturehover")
+        else if (id == priv::makePropertyId("texturehover"))
         {
             m_spriteHover.setTexture(getSharedRenderer()->getTextureHover());
         }
-        else if (property == "texturedisabled")
+        else if (id == priv::makePropertyId("texturedisabled"))
         {
             m_spriteDisabled.setTexture(getSharedRenderer()->getTextureDisabled());
         }
-        else if (property == "texturefocused")
+        else if (id == priv::makePropertyId("texturefocused"))
         {
             m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
         }
-        else if (property == "textstyle")
+        else if (id == priv::makePropertyId("textstyle"))
         {
             const TextStyle style = getSharedRenderer()->getTextStyle();
             m_textBeforeSelection.setStyle(style);
@@ -998,62 +996,69 @@ namespace tgui
             m_textSelection.setStyle(style);
             m_textFull.setStyle(style);
         }
-        else if (property == "defaulttextstyle")
+        else if (id == priv::makePropertyId("defaulttextstyle"))
         {
             m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
         }
-        else if (property == "bordercolor")
+        else if (id == priv::makePropertyId("bordercolor"))
         {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
+            m_borderColorCached = applyOpacity(getSharedRenderer()->getBorderColor());
         }
-        else if (property == "bordercolorhover")
+        else if (id == priv::makePropertyId("bordercolorhover"))
         {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+            m_borderColorHoverCached = applyOpacity(getSharedRenderer()->getBorderColorHover());
         }
-        else if (property == "bordercolordisabled")
+        else if (id == priv::makePropertyId("bordercolordisabled"))
         {
-            m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
+            m_borderColorDisabledCached = applyOpacity(getSharedRenderer()->getBorderColorDisabled());
         }
-        else if (property == "bordercolorfocused")
+        else if (id == priv::makePropertyId("bordercolorfocused"))
         {
-            m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
+            m_borderColorFocusedCached = applyOpacity(getSharedRenderer()->getBorderColorFocused());
         }
-        else if (property == "backgroundcolor")
+        else if (id == priv::makePropertyId("backgroundcolor"))
         {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+            m_backgroundColorCached = applyOpacity(getSharedRenderer()->getBackgroundColor());
         }
-        else if (property == "backgroundcolorhover")
+        else if (id == priv::makePropertyId("backgroundcolorhover"))
         {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+            m_backgroundColorHoverCached = applyOpacity(getSharedRenderer()->getBackgroundColorHover());
         }
-        else if (property == "backgroundcolordisabled")
+        else if (id == priv::makePropertyId("backgroundcolordisabled"))
         {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+            m_backgroundColorDisabledCached = applyOpacity(getSharedRenderer()->getBackgroundColorDisabled());
         }
-        else if (property == "backgroundcolorfocused")
+        else if (id == priv::makePropertyId("backgroundcolorfocused"))
         {
-            m_backgroundColorFocusedCached = getSharedRenderer()->getBackgroundColorFocused();
+            m_backgroundColorFocusedCached = applyOpacity(getSharedRenderer()->getBackgroundColorFocused());
         }
-        else if (property == "caretcolor")
+        else if (id == priv::makePropertyId("caretcolor"))
         {
-            m_caretColorCached = getSharedRenderer()->getCaretColor();
+            m_caretColorCached = applyOpacity(getSharedRenderer()->getCaretColor());
         }
-        else if (property == "caretcolorhover")
+        else if (id == priv::makePropertyId("caretcolorhover"))
         {
-            m_caretColorHoverCached = getSharedRenderer()->getCaretColorHover();
+            m_caretColorHoverCached = applyOpacity(getSharedRenderer()->getCaretColorHover());
         }
-        else if (property == "caretcolorfocused")
+        else if (id == priv::makePropertyId("caretcolorfocused"))
         {
-            m_caretColorFocusedCached = getSharedRenderer()->getCaretColorFocused();
+            m_caretColorFocusedCached = applyOpacity(getSharedRenderer()->getCaretColorFocused());
         }
-        else if (property == "selectedtextbackgroundcolor")
+        else if (id == priv::makePropertyId("selectedtextbackgroundcolor"))
         {
-            m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
+            m_selectedTextBackgroundColorCached = applyOpacity(getSharedRenderer()->getSelectedTextBackgroundColor());
         }
-        else if (property == "opacity")
+        else if (id == priv::makePropertyId("opacity"))
         {
             Widget::rendererChanged(property);
 
+            // The cached colors have the opacity applied to them, so they are updated as well
+            for (const char* colorProperty : {"bordercolor", "bordercolorhover", "bordercolordisabled", "bordercolorfocused",
+                                              "backgroundcolor", "backgroundcolorhover", "backgroundcolordisabled",
+                                              "backgroundcolorfocused", "caretcolor", "caretcolorhover", "caretcolorfocused",
+                                              "selectedtextbackgroundcolor"})
+                rendererChanged(colorProperty);
+
             m_textBeforeSelection.setOpacity(m_opacityCached);
             m_textAfterSelection.setOpacity(m_opacityCached);
             m_textSelection.setOpacity(m_opacityCached);
@@ -1064,7 +1069,7 @@ namespace tgui
             m_spriteDisabled.setOpacity(m_opacityCached);
             m_spriteFocused.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (id == priv::makePropertyId("font"))
         {
             Widget::rendererChanged(property);
 
@@ -1270,6 +1275,7 @@ namespace tgui
         displayedString.erase(pos, m_selChars);
         m_textFull.setString(displayedString);
         m_text.erase(pos, m_selChars);
+        m_inputValidator.textChanged(pos);
 
         // Set the caret back on the correct position
         setCaretPosition(pos);
@@ -1352,6 +1358,9 @@ namespace tgui
 
     void EditBox::updateSelection()
     {
+        // The caret, the selection or the visible part of the text may have changed
+        invalidate();
+
         // Check if we are selecting text from left to right
         if (m_selEnd > m_selStart)
         {
@@ -1440,10 +1449,15 @@ namespace tgui
 
             // Switch the value of the visible flag
             m_caretVisible = !m_caretVisible;
+            if (m_focused)
+                invalidate();
 
             // Too slow for double clicking
             m_possibleDoubleClick = false;
         }
+
+        if (m_focused || m_possibleDoubleClick)
+            scheduleUpdate(sf::milliseconds(500) - m_animationTimeElapsed);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1456,13 +1470,13 @@ namespace tgui
         if (m_bordersCached != Borders{0})
         {
             if (!m_enabled && m_borderColorDisabledCached.isSet())
-                drawBorders(target, states, m_bordersCached, getSize(), m_borderColorDisabledCached);
+                drawFadedBorders(target, states, m_bordersCached, getSize(), m_borderColorDisabledCached);
             else if (m_mouseHover && m_borderColorHoverCached.isSet())
-                drawBorders(target, states, m_bordersCached, getSize(), m_borderColorHoverCached);
+                drawFadedBorders(target, states, m_bordersCached, getSize(), m_borderColorHoverCached);
             else if (m_focused && m_borderColorFocusedCached.isSet())
-                drawBorders(target, states, m_bordersCached, getSize(), m_borderColorFocusedCached);
+                drawFadedBorders(target, states, m_bordersCached, getSize(), m_borderColorFocusedCached);
             else
-                drawBorders(target, states, m_bordersCached, getSize(), m_borderColorCached);
+                drawFadedBorders(target, states, m_bordersCached, getSize(), m_borderColorCached);
 
             states.transform.translate({m_bordersCached.getLeft(), m_bordersCached.getTop()});
         }
@@ -1482,13 +1496,13 @@ namespace tgui
         else // There is no background texture
         {
             if (!m_enabled && m_backgroundColorDisabledCached.isSet())
-                drawRectangleShape(target, states, getInnerSize(), m_backgroundColorDisabledCached);
+                drawFadedRectangleShape(target, states, getInnerSize(), m_backgroundColorDisabledCached);
             else if (m_mouseHover && m_backgroundColorHoverCached.isSet())
-                drawRectangleShape(target, states, getInnerSize(), m_backgroundColorHoverCached);
+                drawFadedRectangleShape(target, states, getInnerSize(), m_backgroundColorHoverCached);
             else if (m_focused && m_backgroundColorFocusedCached.isSet())
-                drawRectangleShape(target, states, getInnerSize(), m_backgroundColorFocusedCached);
+                drawFadedRectangleShape(target, states, getInnerSize(), m_backgroundColorFocusedCached);
             else
-                drawRectangleShape(target, states, getInnerSize(), m_backgroundColorCached);
+                drawFadedRectangleShape(target, states, getInnerSize(), m_backgroundColorCached);
         }
 
         {
@@ -1502,7 +1516,7 @@ namespace tgui
                 if (m_textSelection.getString() != "")
                 {
                     states.transform.translate(m_selectedTextBackground.getPosition());
-                    drawRectangleShape(target, states, m_selectedTextBackground.getSize(), m_selectedTextBackgroundColorCached);
+                    drawFadedRectangleShape(target, states, m_selectedTextBackground.getSize(), m_selectedTextBackgroundColorCached);
                     states.transform.translate(-m_selectedTextBackground.getPosition());
 
                     m_textSelection.draw(target, states);
@@ -1520,11 +1534,11 @@ namespace tgui
         if (m_enabled && m_focused && m_caretVisible)
         {
             if (m_mouseHover && m_caretColorHoverCached.isSet())
-                drawRectangleShape(target, states, m_caret.getSize(), m_caretColorHoverCached);
+                drawFadedRectangleShape(target, states, m_caret.getSize(), m_caretColorHoverCached);
             else if (m_focused && m_caretColorFocusedCached.isSet())
-                drawRectangleShape(target, states, m_caret.getSize(), m_caretColorFocusedCached);
+                drawFadedRectangleShape(target, states, m_caret.getSize(), m_caretColorFocusedCached);
             else
-                drawRectangleShape(target, states, m_caret.getSize(), m_caretColorCached);
+                drawFadedRectangleShape(target, states, m_caret.getSize(), m_caretColorCached);
         }
     }
 
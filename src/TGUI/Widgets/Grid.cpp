@@ -25,6 +25,7 @@
 
 #include <TGUI/Widgets/Grid.hpp>
 #include <TGUI/SignalImpl.hpp>
+#include <TGUI/BatchRenderer.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -43,6 +44,9 @@ namespace tgui
         Container {gridToCopy},
         m_autoSize{gridToCopy.m_autoSize}
     {
+        // Only calculate the layout once, after all widgets were added
+        m_layoutSuspended = true;
+
         for (std::size_t row = 0; row < gridToCopy.m_gridWidgets.size(); ++row)
         {
             for (std::size_t col = 0; col < gridToCopy.m_gridWidgets[row].size(); ++col)
@@ -56,6 +60,8 @@ namespace tgui
                 }
             }
         }
+
+        setLayoutSuspended(false);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -68,12 +74,13 @@ namespace tgui
         m_objAlignment      {std::move(gridToMove.m_objAlignment)},
         m_rowHeight         {std::move(gridToMove.m_rowHeight)},
         m_columnWidth       {std::move(gridToMove.m_columnWidth)},
-        m_connectedCallbacks{}
+        m_connectedCallbacks{},
+        m_widgetCells       {std::move(gridToMove.m_widgetCells)}
     {
         for (auto& widget : m_widgets)
         {
             widget->disconnect(gridToMove.m_connectedCallbacks[widget]);
-            m_connectedCallbacks[widget] = widget->connect("SizeChanged", [this](){ updateWidgets(); });
+            connectSizeChanged(widget);
         }
     }
 
@@ -87,6 +94,11 @@ namespace tgui
             Container::operator=(right);
             m_autoSize = right.m_autoSize;
             m_connectedCallbacks.clear();
+            m_widgetCells.clear();
+
+            // Only calculate the layout once, after all widgets were added
+            const bool wasLayoutSuspended = m_layoutSuspended;
+            m_layoutSuspended = true;
 
             for (std::size_t row = 0; row < right.m_gridWidgets.size(); ++row)
             {
@@ -101,6 +113,8 @@ namespace tgui
                     }
                 }
             }
+
+            setLayoutSuspended(wasLayoutSuspended);
         }
 
         return *this;
@@ -120,11 +134,12 @@ namespace tgui
             m_rowHeight          = std::move(right.m_rowHeight);
             m_columnWidth        = std::move(right.m_columnWidth);
             m_connectedCallbacks = std::move(right.m_connectedCallbacks);
+            m_widgetCells        = std::move(right.m_widgetCells);
 
             for (auto& widget : m_widgets)
             {
-                widget->disconnect(right.m_connectedCallbacks[widget]);
-                m_connectedCallbacks[widget] = widget->connect("SizeChanged", [this](){ updateWidgets(); });
+                widget->disconnect(m_connectedCallbacks[widget]);
+                connectSizeChanged(widget);
             }
         }
 
@@ -179,6 +194,26 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Grid::setLayoutSuspended(bool suspended)
+    {
+        m_layoutSuspended = suspended;
+
+        if (!m_layoutSuspended && m_layoutUpdatePending)
+        {
+            m_layoutUpdatePending = false;
+            updateWidgets();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Grid::isLayoutSuspended() const
+    {
+        return m_layoutSuspended;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Grid::remove(const Widget::Ptr& widget)
     {
         const auto callbackIt = m_connectedCallbacks.find(widget);
@@ -228,12 +263,24 @@ namespace tgui
                         m_rowHeight.erase(m_rowHeight.begin() + row);
                     }
 
+                    // The widgets behind the removed one have moved to another cell
+                    m_widgetCells.clear();
+                    for (std::size_t r = 0; r < m_gridWidgets.size(); ++r)
+                    {
+                        for (std::size_t c = 0; c < m_gridWidgets[r].size(); ++c)
+                        {
+                            if (m_gridWidgets[r][c])
+                                m_widgetCells[m_gridWidgets[r][c].get()] = {r, c};
+                        }
+                    }
+
                     // Update the positions of all remaining widgets
                     updatePositionsOfAllWidgets();
                 }
             }
         }
 
+        m_widgetCells.erase(widget.get());
         return Container::remove(widget);
     }
 
@@ -251,6 +298,7 @@ namespace tgui
         m_columnWidth.clear();
 
         m_connectedCallbacks.clear();
+        m_widgetCells.clear();
 
         updateWidgets();
     }
@@ -287,16 +335,31 @@ namespace tgui
         if (m_columnWidth.size() < col + 1)
             m_columnWidth.resize(col + 1, 0);
 
+        // Forget the widget that was placed in the cell before, it remains in the container but is no longer part of the grid
+        const Widget::Ptr oldWidget = m_gridWidgets[row][col];
+        if (oldWidget && (oldWidget != widget))
+        {
+            const auto callbackIt = m_connectedCallbacks.find(oldWidget);
+            if (callbackIt != m_connectedCallbacks.end())
+            {
+                oldWidget->disconnect(callbackIt->second);
+                m_connectedCallbacks.erase(callbackIt);
+            }
+
+            m_widgetCells.erase(oldWidget.get());
+        }
+
         // Add the widget to the grid
         m_gridWidgets[row][col] = widget;
         m_objBorders[row][col] = borders;
         m_objAlignment[row][col] = alignment;
+        m_widgetCells[widget.get()] = {row, col};
 
-        // Update the widgets
-        updateWidgets();
+        // Update the row and column of the widget
+        updateCell(row, col);
 
         // Automatically update the widgets when their size changes
-        m_connectedCallbacks[widget] = widget->connect("SizeChanged", [this](){ updateWidgets(); });
+        connectSizeChanged(widget);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -351,8 +414,8 @@ namespace tgui
             // Change borders of the widget
             m_objBorders[row][col] = borders;
 
-            // Update all widgets
-            updateWidgets();
+            // Update the row and column of the widget
+            updateCell(row, col);
         }
     }
 
@@ -405,7 +468,9 @@ namespace tgui
         if (((row < m_gridWidgets.size()) && (col < m_gridWidgets[row].size())) && (m_gridWidgets[row][col] != nullptr))
         {
             m_objAlignment[row][col] = alignment;
-            updatePositionsOfAllWidgets();
+
+            // The alignment only changes the position of the widget inside its own cell
+            updateCell(row, col);
         }
     }
 
@@ -535,6 +600,10 @@ namespace tgui
             if (elements.size() != getWidgets().size())
                 throw Exception{"Failed to parse 'GridWidgets' property, the amount of items has to match with the amount of child widgets"};
 
+            // Only calculate the layout once, after all widgets were added
+            const bool wasLayoutSuspended = m_layoutSuspended;
+            m_layoutSuspended = true;
+
             for (unsigned int i = 0; i < elements.size(); ++i)
             {
                 std::string str = elements[i].toAnsiString();
@@ -614,6 +683,8 @@ namespace tgui
 
                 addWidget(getWidgets()[i], static_cast<std::size_t>(row), static_cast<std::size_t>(col), borders, alignment);
             }
+
+            setLayoutSuspended(wasLayoutSuspended);
         }
     }
 
@@ -639,16 +710,21 @@ namespace tgui
 
     void Grid::updatePositionsOfAllWidgets()
     {
-        Vector2f extraOffset;
-        if (!m_autoSize && m_gridWidgets.size() > 1)
+        updatePositionsOfWidgets(0, 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::updatePositionsOfWidgets(std::size_t firstRow, std::size_t firstColumn)
+    {
+        if (m_layoutSuspended)
         {
-            const Vector2f minimumSize = getMinimumSize();
-            if (getSize().x > minimumSize.x)
-                extraOffset.x = (getSize().x - minimumSize.x) / (m_gridWidgets.size() - 1);
-            if (getSize().y > minimumSize.y)
-                extraOffset.y = (getSize().y - minimumSize.y) / (m_gridWidgets.size() - 1);
+            m_layoutUpdatePending = true;
+            return;
         }
 
+        const Vector2f extraOffset = getExtraCellOffset();
+
         Vector2f position;
         for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
         {
@@ -656,62 +732,10 @@ namespace tgui
 
             for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
             {
-                if (m_gridWidgets[row][col].get() == nullptr)
-                {
-                    position.x += m_columnWidth[col] + extraOffset.x;
-                    continue;
-                }
-
-                Vector2f cellPosition = position + (extraOffset / 2.f);
-                switch (m_objAlignment[row][col])
-                {
-                case Alignment::UpperLeft:
-                    cellPosition.x += m_objBorders[row][col].getLeft();
-                    cellPosition.y += m_objBorders[row][col].getTop();
-                    break;
-
-                case Alignment::Up:
-                    cellPosition.x += m_objBorders[row][col].getLeft() + (((m_columnWidth[col] - m_objBorders[row][col].getLeft() - m_objBorders[row][col].getRight()) - m_gridWidgets[row][col]->getFullSize().x) / 2.f);
-                    cellPosition.y += m_objBorders[row][col].getTop();
-                    break;
-
-                case Alignment::UpperRight:
-                    cellPosition.x += m_columnWidth[col] - m_objBorders[row][col].getRight() - m_gridWidgets[row][col]->getFullSize().x;
-                    cellPosition.y += m_objBorders[row][col].getTop();
-                    break;
-
-                case Alignment::Right:
-                    cellPosition.x += m_columnWidth[col] - m_objBorders[row][col].getRight() - m_gridWidgets[row][col]->getFullSize().x;
-                    cellPosition.y += m_objBorders[row][col].getTop() + (((m_rowHeight[row] - m_objBorders[row][col].getTop() - m_objBorders[row][col].getBottom()) - m_gridWidgets[row][col]->getFullSize().y) / 2.f);
-                    break;
-
-                case Alignment::BottomRight:
-                    cellPosition.x += m_columnWidth[col] - m_objBorders[row][col].getRight() - m_gridWidgets[row][col]->getFullSize().x;
-                    cellPosition.y += m_rowHeight[row] - m_objBorders[row][col].getBottom() - m_gridWidgets[row][col]->getFullSize().y;
-                    break;
-
-                case Alignment::Bottom:
-                    cellPosition.x += m_objBorders[row][col].getLeft() + (((m_columnWidth[col] - m_objBorders[row][col].getLeft() - m_objBorders[row][col].getRight()) - m_gridWidgets[row][col]->getFullSize().x) / 2.f);
-                    cellPosition.y += m_rowHeight[row] - m_objBorders[row][col].getBottom() - m_gridWidgets[row][col]->getFullSize().y;
-                    break;
-
-                case Alignment::BottomLeft:
-                    cellPosition.x += m_objBorders[row][col].getLeft();
-                    cellPosition.y += m_rowHeight[row] - m_objBorders[row][col].getBottom() - m_gridWidgets[row][col]->getFullSize().y;
-                    break;
-
-                case Alignment::Left:
-                    cellPosition.x += m_objBorders[row][col].getLeft();
-                    cellPosition.y += m_objBorders[row][col].getTop() + (((m_rowHeight[row] - m_objBorders[row][col].getTop() - m_objBorders[row][col].getBottom()) - m_gridWidgets[row][col]->getFullSize().y) / 2.f);
-                    break;
-
-                case Alignment::Center:
-                    cellPosition.x += m_objBorders[row][col].getLeft() + (((m_columnWidth[col] - m_objBorders[row][col].getLeft() - m_objBorders[row][col].getRight()) - m_gridWidgets[row][col]->getFullSize().x) / 2.f);
-                    cellPosition.y += m_objBorders[row][col].getTop() + (((m_rowHeight[row] - m_objBorders[row][col].getTop() - m_objBorders[row][col].getBottom()) - m_gridWidgets[row][col]->getFullSize().y) / 2.f);
-                    break;
-                }
+                // Widgets above and left of the changed row and column keep their position
+                if ((m_gridWidgets[row][col].get() != nullptr) && ((row >= firstRow) || (col >= firstColumn)))
+                    updateWidgetPosition(row, col, position + (extraOffset / 2.f));
 
-                m_gridWidgets[row][col]->setPosition(cellPosition);
                 position.x += m_columnWidth[col] + extraOffset.x;
             }
 
@@ -725,6 +749,12 @@ namespace tgui
 
     void Grid::updateWidgets()
     {
+        if (m_layoutSuspended)
+        {
+            m_layoutUpdatePending = true;
+            return;
+        }
+
         // Reset the column widths
         for (float& width : m_columnWidth)
             width = 0;
@@ -750,23 +780,203 @@ namespace tgui
             }
         }
 
+        updateAutoSize();
+        updatePositionsOfAllWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::updateCell(std::size_t row, std::size_t col)
+    {
+        if (m_layoutSuspended)
+        {
+            m_layoutUpdatePending = true;
+            return;
+        }
+
+        if ((row >= m_gridWidgets.size()) || (col >= m_gridWidgets[row].size()))
+            return;
+
+        const bool rowChanged = updateRowHeight(row);
+        const bool columnChanged = updateColumnWidth(col);
+        if (!rowChanged && !columnChanged)
+        {
+            // The other widgets don't move, only the widget itself may have to be aligned differently inside its cell
+            if (m_gridWidgets[row][col].get() != nullptr)
+                updateWidgetPosition(row, col, getCellPosition(row, col));
+
+            return;
+        }
+
+        updateAutoSize();
+
+        // When the grid isn't auto-sized, the space between all cells depends on the size of every row and column
         if (m_autoSize)
+            updatePositionsOfWidgets(rowChanged ? row : m_gridWidgets.size(), columnChanged ? col : m_columnWidth.size());
+        else
+            updatePositionsOfAllWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Grid::updateRowHeight(std::size_t row)
+    {
+        float height = 0;
+        for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
         {
-            sf::Vector2f size;
-            for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
-            {
-                float rowWidth = 0;
-                for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-                    rowWidth += m_columnWidth[col];
+            if (m_gridWidgets[row][col].get() != nullptr)
+                height = std::max(height, m_gridWidgets[row][col]->getFullSize().y + m_objBorders[row][col].getTop() + m_objBorders[row][col].getBottom());
+        }
 
-                size.x = std::max(size.x, rowWidth);
-                size.y += m_rowHeight[row];
-            }
+        if (m_rowHeight[row] == height)
+            return false;
+
+        m_rowHeight[row] = height;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            Container::setSize(size);
+    bool Grid::updateColumnWidth(std::size_t col)
+    {
+        float width = 0;
+        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
+        {
+            if ((col < m_gridWidgets[row].size()) && (m_gridWidgets[row][col].get() != nullptr))
+                width = std::max(width, m_gridWidgets[row][col]->getFullSize().x + m_objBorders[row][col].getLeft() + m_objBorders[row][col].getRight());
         }
 
-        updatePositionsOfAllWidgets();
+        if (m_columnWidth[col] == width)
+            return false;
+
+        m_columnWidth[col] = width;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::updateAutoSize()
+    {
+        if (!m_autoSize)
+            return;
+
+        // The widest row is the one with the most columns, as none of the columns has a negative width
+        std::size_t columnCount = 0;
+        sf::Vector2f size;
+        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
+        {
+            columnCount = std::max(columnCount, m_gridWidgets[row].size());
+            size.y += m_rowHeight[row];
+        }
+
+        for (std::size_t col = 0; col < columnCount; ++col)
+            size.x += m_columnWidth[col];
+
+        Container::setSize(size);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2f Grid::getExtraCellOffset() const
+    {
+        Vector2f extraOffset;
+        if (!m_autoSize && m_gridWidgets.size() > 1)
+        {
+            const Vector2f minimumSize = getMinimumSize();
+            if (getSize().x > minimumSize.x)
+                extraOffset.x = (getSize().x - minimumSize.x) / (m_gridWidgets.size() - 1);
+            if (getSize().y > minimumSize.y)
+                extraOffset.y = (getSize().y - minimumSize.y) / (m_gridWidgets.size() - 1);
+        }
+
+        return extraOffset;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2f Grid::getCellPosition(std::size_t row, std::size_t col) const
+    {
+        const Vector2f extraOffset = getExtraCellOffset();
+
+        Vector2f position = extraOffset / 2.f;
+        for (std::size_t r = 0; r < row; ++r)
+            position.y += m_rowHeight[r] + extraOffset.y;
+        for (std::size_t c = 0; c < col; ++c)
+            position.x += m_columnWidth[c] + extraOffset.x;
+
+        return position;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::updateWidgetPosition(std::size_t row, std::size_t col, Vector2f cellPosition)
+    {
+        switch (m_objAlignment[row][col])
+        {
+        case Alignment::UpperLeft:
+            cellPosition.x += m_objBorders[row][col].getLeft();
+            cellPosition.y += m_objBorders[row][col].getTop();
+            break;
+
+        case Alignment::Up:
+            cellPosition.x += m_objBorders[row][col].getLeft() + (((m_columnWidth[col] - m_objBorders[row][col].getLeft() - m_objBorders[row][col].getRight()) - m_gridWidgets[row][col]->getFullSize().x) / 2.f);
+            cellPosition.y += m_objBorders[row][col].getTop();
+            break;
+
+        case Alignment::UpperRight:
+            cellPosition.x += m_columnWidth[col] - m_objBorders[row][col].getRight() - m_gridWidgets[row][col]->getFullSize().x;
+            cellPosition.y += m_objBorders[row][col].getTop();
+            break;
+
+        case Alignment::Right:
+            cellPosition.x += m_columnWidth[col] - m_objBorders[row][col].getRight() - m_gridWidgets[row][col]->getFullSize().x;
+            cellPosition.y += m_objBorders[row][col].getTop() + (((m_rowHeight[row] - m_objBorders[row][col].getTop() - m_objBorders[row][col].getBottom()) - m_gridWidgets[row][col]->getFullSize().y) / 2.f);
+            break;
+
+        case Alignment::BottomRight:
+            cellPosition.x += m_columnWidth[col] - m_objBorders[row][col].getRight() - m_gridWidgets[row][col]->getFullSize().x;
+            cellPosition.y += m_rowHeight[row] - m_objBorders[row][col].getBottom() - m_gridWidgets[row][col]->getFullSize().y;
+            break;
+
+        case Alignment::Bottom:
+            cellPosition.x += m_objBorders[row][col].getLeft() + (((m_columnWidth[col] - m_objBorders[row][col].getLeft() - m_objBorders[row][col].getRight()) - m_gridWidgets[row][col]->getFullSize().x) / 2.f);
+            cellPosition.y += m_rowHeight[row] - m_objBorders[row][col].getBottom() - m_gridWidgets[row][col]->getFullSize().y;
+            break;
+
+        case Alignment::BottomLeft:
+            cellPosition.x += m_objBorders[row][col].getLeft();
+            cellPosition.y += m_rowHeight[row] - m_objBorders[row][col].getBottom() - m_gridWidgets[row][col]->getFullSize().y;
+            break;
+
+        case Alignment::Left:
+            cellPosition.x += m_objBorders[row][col].getLeft();
+            cellPosition.y += m_objBorders[row][col].getTop() + (((m_rowHeight[row] - m_objBorders[row][col].getTop() - m_objBorders[row][col].getBottom()) - m_gridWidgets[row][col]->getFullSize().y) / 2.f);
+            break;
+
+        case Alignment::Center:
+            cellPosition.x += m_objBorders[row][col].getLeft() + (((m_columnWidth[col] - m_objBorders[row][col].getLeft() - m_objBorders[row][col].getRight()) - m_gridWidgets[row][col]->getFullSize().x) / 2.f);
+            cellPosition.y += m_objBorders[row][col].getTop() + (((m_rowHeight[row] - m_objBorders[row][col].getTop() - m_objBorders[row][col].getBottom()) - m_gridWidgets[row][col]->getFullSize().y) / 2.f);
+            break;
+        }
+
+        m_gridWidgets[row][col]->setPosition(cellPosition);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::connectSizeChanged(const Widget::Ptr& widget)
+    {
+        // Don't connect twice when the widget was already in the grid
+        const auto callbackIt = m_connectedCallbacks.find(widget);
+        if (callbackIt != m_connectedCallbacks.end())
+            widget->disconnect(callbackIt->second);
+
+        const Widget* widgetPtr = widget.get();
+        m_connectedCallbacks[widget] = widget->connect("SizeChanged", [this,widgetPtr](){
+                const auto it = m_widgetCells.find(widgetPtr);
+                if (it != m_widgetCells.end())
+                    updateCell(it->second.first, it->second.second);
+            });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -783,7 +993,10 @@ namespace tgui
                 if (m_gridWidgets[row][col].get() != nullptr)
                 {
                     if (m_gridWidgets[row][col]->isVisible())
+                    {
+                        priv::BatchRenderer::OpacityScope opacityScope{m_gridWidgets[row][col]->getAnimatedOpacity()};
                         m_gridWidgets[row][col]->draw(target, states);
+                    }
                 }
             }
         }
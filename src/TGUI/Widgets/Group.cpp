@@ -137,7 +137,9 @@ namespace tgui
 
     void Group::rendererChanged(const std::string& property)
     {
-        if (property == "padding")
+        const priv::PropertyId id = priv::makePropertyId(property);
+
+        if (id == priv::makePropertyId("padding"))
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             setSize(m_size);
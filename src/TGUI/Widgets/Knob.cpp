@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Knob.hpp>
+#include <TGUI/BatchRenderer.hpp>
 #include <SFML/Graphics/CircleShape.hpp>
 #include <cmath>
 
@@ -457,6 +458,7 @@ namespace tgui
         {
             m_angle = (((m_value - m_minimum) / static_cast<float>(m_maximum - m_minimum)) * allowedAngle) + m_startRotation;
         }
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -473,41 +475,47 @@ namespace tgui
 
     void Knob::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        const priv::PropertyId id = priv::makePropertyId(property);
+
+        if (id == priv::makePropertyId("borders"))
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == "texturebackground")
+        else if (id == priv::makePropertyId("texturebackground"))
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
             setSize(m_size);
         }
-        else if (property == "textureforeground")
+        else if (id == priv::makePropertyId("textureforeground"))
         {
             m_spriteForeground.setTexture(getSharedRenderer()->getTextureForeground());
             setSize(m_size);
         }
-        else if (property == "bordercolor")
+        else if (id == priv::makePropertyId("bordercolor"))
         {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
+            m_borderColorCached = applyOpacity(getSharedRenderer()->getBorderColor());
         }
-        else if (property == "backgroundcolor")
+        else if (id == priv::makePropertyId("backgroundcolor"))
         {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+            m_backgroundColorCached = applyOpacity(getSharedRenderer()->getBackgroundColor());
         }
-        else if (property == "thumbcolor")
+        else if (id == priv::makePropertyId("thumbcolor"))
         {
-            m_thumbColorCached = getSharedRenderer()->getThumbColor();
+            m_thumbColorCached = applyOpacity(getSharedRenderer()->getThumbColor());
         }
-        else if (property == "imagerotation")
+        else if (id == priv::makePropertyId("imagerotation"))
         {
             m_imageRotationCached = getSharedRenderer()->getImageRotation();
         }
-        else if (property == "opacity")
+        else if (id == priv::makePropertyId("opacity"))
         {
             Widget::rendererChanged(property);
 
+            // The cached colors have the opacity applied to them, so they are updated as well
+            for (const char* colorProperty : {"bordercolor", "backgroundcolor", "thumbcolor"})
+                rendererChanged(colorProperty);
+
             m_spriteBackground.setOpacity(m_opacityCached);
             m_spriteForeground.setOpacity(m_opacityCached);
         }
@@ -574,9 +582,9 @@ namespace tgui
 
             sf::CircleShape bordersShape{size / 2};
             bordersShape.setFillColor(Color::Transparent);
-            bordersShape.setOutlineColor(Color::calcColorOpacity(m_borderColorCached, m_opacityCached));
+            bordersShape.setOutlineColor(m_borderColorCached);
             bordersShape.setOutlineThickness(borderThickness);
-            target.draw(bordersShape, states);
+            priv::BatchRenderer::draw(target, bordersShape, states);
         }
 
         // Draw the background
@@ -585,8 +593,8 @@ namespace tgui
         else
         {
             sf::CircleShape background{size / 2};
-            background.setFillColor(Color::calcColorOpacity(m_backgroundColorCached, m_opacityCached));
-            target.draw(background, states);
+            background.setFillColor(m_backgroundColorCached);
+            priv::BatchRenderer::draw(target, background, states);
         }
 
         // Draw the foreground
@@ -605,10 +613,10 @@ namespace tgui
         else
         {
             sf::CircleShape thumb{size / 10.0f};
-            thumb.setFillColor(Color::calcColorOpacity(m_thumbColorCached, m_opacityCached));
+            thumb.setFillColor(m_thumbColorCached);
             thumb.setPosition({(size / 2.0f) - thumb.getRadius() + (std::cos(m_angle / 180 * pi) * (size / 2) * 3/5),
                                (size / 2.0f) - thumb.getRadius() + (-std::sin(m_angle / 180 * pi) * (size / 2) * 3/5)});
-            target.draw(thumb, states);
+            priv::BatchRenderer::draw(target, thumb, states);
         }
     }
 
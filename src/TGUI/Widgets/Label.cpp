@@ -264,6 +264,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                scheduleUpdate(sf::milliseconds(getDoubleClickTime()));
             }
         }
     }
@@ -282,46 +283,52 @@ namespace tgui
 
     void Label::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        const priv::PropertyId id = priv::makePropertyId(property);
+
+        if (id == priv::makePropertyId("borders"))
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             m_bordersCached.updateParentSize(getSize());
             rearrangeText();
         }
-        else if (property == "padding")
+        else if (id == priv::makePropertyId("padding"))
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             m_paddingCached.updateParentSize(getSize());
             rearrangeText();
         }
-        else if (property == "textstyle")
+        else if (id == priv::makePropertyId("textstyle"))
         {
             m_textStyleCached = getSharedRenderer()->getTextStyle();
             rearrangeText();
         }
-        else if (property == "textcolor")
+        else if (id == priv::makePropertyId("textcolor"))
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
             for (auto& line : m_lines)
                 line.setColor(m_textColorCached);
         }
-        else if (property == "bordercolor")
+        else if (id == priv::makePropertyId("bordercolor"))
         {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
+            m_borderColorCached = applyOpacity(getSharedRenderer()->getBorderColor());
         }
-        else if (property == "backgroundcolor")
+        else if (id == priv::makePropertyId("backgroundcolor"))
         {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+            m_backgroundColorCached = applyOpacity(getSharedRenderer()->getBackgroundColor());
         }
-        else if (property == "font")
+        else if (id == priv::makePropertyId("font"))
         {
             Widget::rendererChanged(property);
             rearrangeText();
         }
-        else if (property == "opacity")
+        else if (id == priv::makePropertyId("opacity"))
         {
             Widget::rendererChanged(property);
 
+            // The cached colors have the opacity applied to them, so they are updated as well
+            for (const char* colorProperty : {"bordercolor", "backgroundcolor"})
+                rendererChanged(colorProperty);
+
             for (auto& line : m_lines)
                 line.setOpacity(m_opacityCached);
         }
@@ -410,12 +417,17 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_possibleDoubleClick = false;
         }
+        else if (m_possibleDoubleClick)
+            scheduleUpdate(sf::milliseconds(getDoubleClickTime()) - m_animationTimeElapsed);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Label::rearrangeText()
     {
+        // The old text has to be erased, the new size is tracked by setSize when auto-sizing
+        invalidate();
+
         m_lines.clear();
 
         if (m_fontCached == nullptr)
@@ -542,13 +554,13 @@ namespace tgui
         // Draw the borders
         if (m_bordersCached != Borders{0})
         {
-            drawBorders(target, states, m_bordersCached, getSize(), m_borderColorCached);
+            drawFadedBorders(target, states, m_bordersCached, getSize(), m_borderColorCached);
             states.transform.translate({m_bordersCached.getLeft(), m_bordersCached.getTop()});
         }
 
         // Draw the background
         if (m_backgroundColorCached.isSet() && (m_backgroundColorCached != Color::Transparent))
-            drawRectangleShape(target, states, innerSize, m_backgroundColorCached);
+            drawFadedRectangleShape(target, states, innerSize, m_backgroundColorCached);
 
         // Apply clipping when needed
     #ifdef TGUI_USE_CPP17
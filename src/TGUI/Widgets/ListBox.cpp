@@ -25,6 +25,8 @@
 
 #include <TGUI/Widgets/ListBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <algorithm>
+#include <cassert>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -66,6 +68,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t ListBox::ItemIdHash::operator()(const sf::String& id) const
+    {
+        std::size_t hash = 0;
+        for (const sf::Uint32 character : id)
+            hash ^= std::hash<sf::Uint32>{}(character) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+
+        return hash;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     ListBoxRenderer* ListBox::getSharedRenderer()
     {
         return aurora::downcast<ListBoxRenderer*>(Widget::getSharedRenderer());
@@ -98,9 +111,6 @@ namespace tgui
     {
         Widget::setPosition(position);
 
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-            m_items[i].setPosition({0, (i * m_itemHeight) + ((m_itemHeight - m_items[i].getSize().y) / 2.0f)});
-
         m_scroll->setPosition(getSize().x - m_bordersCached.getRight() - m_scroll->getSize().x, m_bordersCached.getTop());
     }
 
@@ -119,6 +129,7 @@ namespace tgui
         m_scroll->setLowValue(static_cast<unsigned int>(getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()));
 
         setPosition(m_position);
+        updateVisibleItems();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -134,19 +145,12 @@ namespace tgui
             if (m_autoScroll && (m_scroll->getLowValue() < m_scroll->getMaximum()))
                 m_scroll->setValue(m_scroll->getMaximum() - m_scroll->getLowValue());
 
-            // Create the new item
-            Text newItem;
-            newItem.setFont(m_fontCached);
-            newItem.setColor(m_textColorCached);
-            newItem.setOpacity(m_opacityCached);
-            newItem.setStyle(m_textStyleCached);
-            newItem.setCharacterSize(m_textSize);
-            newItem.setString(itemName);
-            newItem.setPosition({0, (m_items.size() * m_itemHeight) + ((m_itemHeight - newItem.getSize().y) / 2.0f)});
-
-            // Add the new item to the list
-            m_items.push_back(std::move(newItem));
+            // Add the new item to the list, a text object is only created for it when it is visible
+            m_itemIdIndices.emplace(id, m_items.size());
+            m_items.push_back(itemName);
             m_itemIds.push_back(id);
+
+            updateVisibleItems();
             return true;
         }
         else // The item limit was reached
@@ -159,7 +163,7 @@ namespace tgui
     {
         for (std::size_t i = 0; i < m_items.size(); ++i)
         {
-            if (m_items[i].getString() == itemName)
+            if (m_items[i] == itemName)
                 return setSelectedItemByIndex(i);
         }
 
@@ -172,11 +176,9 @@ namespace tgui
 
     bool ListBox::setSelectedItemById(const sf::String& id)
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return setSelectedItemByIndex(i);
-        }
+        const auto it = m_itemIdIndices.find(id);
+        if (it != m_itemIdIndices.end())
+            return setSelectedItemByIndex(it->second);
 
         // No match was found
         deselectItem();
@@ -201,6 +203,7 @@ namespace tgui
         else if ((m_selectedItem + 1) * getItemHeight() > m_scroll->getValue() + m_scroll->getLowValue())
             m_scroll->setValue((m_selectedItem + 1) * getItemHeight() - m_scroll->getLowValue());
 
+        updateVisibleItems();
         return true;
     }
 
@@ -217,7 +220,7 @@ namespace tgui
     {
         for (std::size_t i = 0; i < m_items.size(); ++i)
         {
-            if (m_items[i].getString() == itemName)
+            if (m_items[i] == itemName)
                 return removeItemByIndex(i);
         }
 
@@ -228,11 +231,9 @@ namespace tgui
 
     bool ListBox::removeItemById(const sf::String& id)
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return removeItemByIndex(i);
-        }
+        const auto it = m_itemIdIndices.find(id);
+        if (it != m_itemIdIndices.end())
+            return removeItemByIndex(it->second);
 
         return false;
     }
@@ -256,13 +257,34 @@ namespace tgui
             m_selectedItem = m_selectedItem - 1;
         }
 
+        // Only the id of the removed item and the indices of the items below it change in the id map
+        const auto idIt = m_itemIdIndices.find(m_itemIds[index]);
+        assert(idIt != m_itemIdIndices.end());
+        if (idIt->second == index)
+        {
+            // Another item with the same id may now be the first one with that id
+            const auto nextIt = std::find(m_itemIds.begin() + index + 1, m_itemIds.end(), m_itemIds[index]);
+            if (nextIt != m_itemIds.end())
+                idIt->second = static_cast<std::size_t>(nextIt - m_itemIds.begin());
+            else
+                m_itemIdIndices.erase(idIt);
+        }
+
+        for (auto& pair : m_itemIdIndices)
+        {
+            if (pair.second > index)
+                pair.second--;
+        }
+
         // Remove the item
         m_items.erase(m_items.begin() + index);
         m_itemIds.erase(m_itemIds.begin() + index);
 
         m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
-        setPosition(m_position);
 
+        // The items below the removed one have moved up
+        m_visibleItems.clear();
+        updateVisibleItems();
         return true;
     }
 
@@ -270,26 +292,28 @@ namespace tgui
 
     void ListBox::removeAllItems()
     {
-        // Clear the list, remove all items
-        m_items.clear();
-        m_itemIds.clear();
-
         // Unselect any selected item
         updateSelectedItem(-1);
         updateHoveringItem(-1);
 
+        // Clear the list, remove all items
+        m_items.clear();
+        m_itemIds.clear();
+        m_itemIdIndices.clear();
+        m_visibleItems.clear();
+        m_firstVisibleItem = 0;
+
         m_scroll->setMaximum(0);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     sf::String ListBox::getItemById(const sf::String& id) const
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return m_items[i].getString();
-        }
+        const auto it = m_itemIdIndices.find(id);
+        if (it != m_itemIdIndices.end())
+            return m_items[it->second];
 
         return "";
     }
@@ -298,7 +322,7 @@ namespace tgui
 
     sf::String ListBox::getSelectedItem() const
     {
-        return (m_selectedItem >= 0) ? m_items[m_selectedItem].getString() : "";
+        return (m_selectedItem >= 0) ? m_items[m_selectedItem] : "";
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -321,7 +345,7 @@ namespace tgui
     {
         for (std::size_t i = 0; i < m_items.size(); ++i)
         {
-            if (m_items[i].getString() == originalValue)
+            if (m_items[i] == originalValue)
                 return changeItemByIndex(i, newValue);
         }
 
@@ -332,11 +356,9 @@ namespace tgui
 
     bool ListBox::changeItemById(const sf::String& id, const sf::String& newValue)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return changeItemByIndex(i, newValue);
-        }
+        const auto it = m_itemIdIndices.find(id);
+        if (it != m_itemIdIndices.end())
+            return changeItemByIndex(it->second, newValue);
 
         return false;
     }
@@ -348,7 +370,11 @@ namespace tgui
         if (index >= m_items.size())
             return false;
 
-        m_items[index].setString(newValue);
+        m_items[index] = newValue;
+        if ((index >= m_firstVisibleItem) && (index < m_firstVisibleItem + m_visibleItems.size()))
+            m_visibleItems[index - m_firstVisibleItem].setString(newValue);
+
+        invalidate();
         return true;
     }
 
@@ -363,11 +389,7 @@ namespace tgui
 
     std::vector<sf::String> ListBox::getItems() const
     {
-        std::vector<sf::String> items;
-        for (const auto& item : m_items)
-            items.push_back(item.getString());
-
-        return items;
+        return m_items;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -384,15 +406,13 @@ namespace tgui
         // Set the new heights
         m_itemHeight = itemHeight;
         if (m_requestedTextSize == 0)
-        {
             m_textSize = Text::findBestTextSize(m_fontCached, itemHeight * 0.8f);
-            for (auto& item : m_items)
-                item.setCharacterSize(m_textSize);
-        }
 
         m_scroll->setScrollAmount(m_itemHeight);
         m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
-        setPosition(m_position);
+
+        m_visibleItems.clear();
+        updateVisibleItems();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -413,10 +433,8 @@ namespace tgui
         else
             m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
 
-        for (auto& item : m_items)
-            item.setCharacterSize(m_textSize);
-
-        setPosition(m_position);
+        m_visibleItems.clear();
+        updateVisibleItems();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -439,9 +457,12 @@ namespace tgui
             // Remove the items that passed the limitation
             m_items.erase(m_items.begin() + m_maxItems, m_items.end());
             m_itemIds.erase(m_itemIds.begin() + m_maxItems, m_itemIds.end());
+            updateItemIdIndices();
 
             m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
-            setPosition(m_position);
+
+            m_visibleItems.clear();
+            updateVisibleItems();
         }
     }
 
@@ -470,14 +491,14 @@ namespace tgui
 
     bool ListBox::contains(const sf::String& item) const
     {
-        return std::find_if(m_items.begin(), m_items.end(), [item](const Text& text){ return text.getString() == item; }) != m_items.end();
+        return std::find(m_items.begin(), m_items.end(), item) != m_items.end();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ListBox::containsId(const sf::String& id) const
     {
-        return std::find(m_itemIds.begin(), m_itemIds.end(), id) != m_itemIds.end();
+        return m_itemIdIndices.find(id) != m_itemIdIndices.end();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -498,6 +519,7 @@ namespace tgui
         if (m_scroll->mouseOnWidget(pos))
         {
             m_scroll->leftMousePressed(pos);
+            updateVisibleItems();
         }
         else
         {
@@ -513,7 +535,7 @@ namespace tgui
                     updateHoveringItem(-1);
 
                 if (m_hoveringItem >= 0)
-                    onMousePress.emit(this, m_items[m_hoveringItem].getString(), m_itemIds[m_hoveringItem]);
+                    onMousePress.emit(this, m_items[m_hoveringItem], m_itemIds[m_hoveringItem]);
 
                 if (m_selectedItem != m_hoveringItem)
                 {
@@ -532,7 +554,7 @@ namespace tgui
         if (m_mouseDown && !m_scroll->isMouseDown())
         {
             if (m_selectedItem >= 0)
-                onMouseRelease.emit(this, m_items[m_selectedItem].getString(), m_itemIds[m_selectedItem]);
+                onMouseRelease.emit(this, m_items[m_selectedItem], m_itemIds[m_selectedItem]);
 
             // Check if you double-clicked
             if (m_possibleDoubleClick)
@@ -540,12 +562,13 @@ namespace tgui
                 m_possibleDoubleClick = false;
 
                 if (m_selectedItem >= 0)
-                    onDoubleClick.emit(this, m_items[m_selectedItem].getString(), m_itemIds[m_selectedItem]);
+                    onDoubleClick.emit(this, m_items[m_selectedItem], m_itemIds[m_selectedItem]);
             }
             else // This is the first click
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                scheduleUpdate(sf::milliseconds(getDoubleClickTime()));
             }
         }
 
@@ -567,6 +590,7 @@ namespace tgui
         if ((m_scroll->isMouseDown() && m_scroll->isMouseDownOnThumb()) || m_scroll->mouseOnWidget(pos))
         {
             m_scroll->mouseMoved(pos);
+            updateVisibleItems();
         }
         else // Mouse not on scrollbar or dragging the scrollbar thumb
         {
@@ -605,6 +629,7 @@ namespace tgui
         if (m_scroll->isShown())
         {
             m_scroll->mouseWheelScrolled(delta, pos - getPosition());
+            updateVisibleItems();
 
             // Update on which item the mouse is hovering
             mouseMoved(pos);
@@ -651,111 +676,100 @@ namespace tgui
 
     void ListBox::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        const priv::PropertyId id = priv::makePropertyId(property);
+
+        if (id == priv::makePropertyId("borders"))
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == "padding")
+        else if (id == priv::makePropertyId("padding"))
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             setSize(m_size);
         }
-        else if (property == "textcolor")
+        else if (id == priv::makePropertyId("textcolor"))
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
             updateItemColorsAndStyle();
         }
-        else if (property == "textcolorhover")
+        else if (id == priv::makePropertyId("textcolorhover"))
         {
             m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
             updateItemColorsAndStyle();
         }
-        else if (property == "selectedtextcolor")
+        else if (id == priv::makePropertyId("selectedtextcolor"))
         {
             m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
             updateItemColorsAndStyle();
         }
-        else if (property == "selectedtextcolorhover")
+        else if (id == priv::makePropertyId("selectedtextcolorhover"))
         {
             m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
             updateItemColorsAndStyle();
         }
-        else if (property == "texturebackground")
+        else if (id == priv::makePropertyId("texturebackground"))
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == "textstyle")
+        else if (id == priv::makePropertyId("textstyle"))
         {
             m_textStyleCached = getSharedRenderer()->getTextStyle();
-
-            for (auto& item : m_items)
-                item.setStyle(m_textStyleCached);
-
-            if ((m_selectedItem >= 0) && m_selectedTextStyleCached.isSet())
-                m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
+            updateItemColorsAndStyle();
         }
-        else if (property == "selectedtextstyle")
+        else if (id == priv::makePropertyId("selectedtextstyle"))
         {
             m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
-
-            if (m_selectedItem >= 0)
-            {
-                if (m_selectedTextStyleCached.isSet())
-                    m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
-                else
-                    m_items[m_selectedItem].setStyle(m_textStyleCached);
-            }
+            updateItemColorAndStyle(m_selectedItem);
         }
-        else if (property == "scrollbar")
+        else if (id == priv::makePropertyId("scrollbar"))
         {
             m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
         }
-        else if (property == "bordercolor")
+        else if (id == priv::makePropertyId("bordercolor"))
         {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
+            m_borderColorCached = applyOpacity(getSharedRenderer()->getBorderColor());
         }
-        else if (property == "backgroundcolor")
+        else if (id == priv::makePropertyId("backgroundcolor"))
         {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+            m_backgroundColorCached = applyOpacity(getSharedRenderer()->getBackgroundColor());
         }
-        else if (property == "backgroundcolorhover")
+        else if (id == priv::makePropertyId("backgroundcolorhover"))
         {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+            m_backgroundColorHoverCached = applyOpacity(getSharedRenderer()->getBackgroundColorHover());
         }
-        else if (property == "selectedbackgroundcolor")
+        else if (id == priv::makePropertyId("selectedbackgroundcolor"))
         {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+            m_selectedBackgroundColorCached = applyOpacity(getSharedRenderer()->getSelectedBackgroundColor());
         }
-        else if (property == "selectedbackgroundcolorhover")
+        else if (id == priv::makePropertyId("selectedbackgroundcolorhover"))
         {
-            m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
+            m_selectedBackgroundColorHoverCached = applyOpacity(getSharedRenderer()->getSelectedBackgroundColorHover());
         }
-        else if (property == "opacity")
+        else if (id == priv::makePropertyId("opacity"))
         {
             Widget::rendererChanged(property);
 
+            // The cached colors have the opacity applied to them, so they are updated as well
+            for (const char* colorProperty : {"bordercolor", "backgroundcolor", "backgroundcolorhover", "selectedbackgroundcolor",
+                                              "selectedbackgroundcolorhover"})
+                rendererChanged(colorProperty);
+
             m_scroll->setInheritedOpacity(m_opacityCached);
             m_spriteBackground.setOpacity(m_opacityCached);
-            for (auto& item : m_items)
+            for (auto& item : m_visibleItems)
                 item.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (id == priv::makePropertyId("font"))
         {
             Widget::rendererChanged(property);
 
-            for (auto& item : m_items)
-                item.setFont(m_fontCached);
-
             // Recalculate the text size with the new font
             if (m_requestedTextSize == 0)
-            {
                 m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
-                for (auto& item : m_items)
-                    item.setCharacterSize(m_textSize);
-            }
 
-            setPosition(m_position);
+            m_visibleItems.clear();
+            updateVisibleItems();
         }
         else
             Widget::rendererChanged(property);
@@ -863,23 +877,33 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::updateSelectedAndHoveringItemColorsAndStyle()
+    void ListBox::updateItemColorAndStyle(int item)
     {
-        if (m_selectedItem >= 0)
+        // Only the items that are visible have a text object
+        if ((item < static_cast<int>(m_firstVisibleItem)) || (item >= static_cast<int>(m_firstVisibleItem + m_visibleItems.size())))
+            return;
+
+        Text& text = m_visibleItems[item - m_firstVisibleItem];
+        const bool hovered = (item == m_hoveringItem);
+        const Color& textColor = (hovered && m_textColorHoverCached.isSet()) ? m_textColorHoverCached : m_textColorCached;
+        if (item == m_selectedItem)
         {
-            if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorHoverCached.isSet())
-                m_items[m_selectedItem].setColor(m_selectedTextColorHoverCached);
+            if (hovered && m_selectedTextColorHoverCached.isSet())
+                text.setColor(m_selectedTextColorHoverCached);
             else if (m_selectedTextColorCached.isSet())
-                m_items[m_selectedItem].setColor(m_selectedTextColorCached);
+                text.setColor(m_selectedTextColorCached);
+            else
+                text.setColor(textColor);
 
             if (m_selectedTextStyleCached.isSet())
-                m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
+                text.setStyle(m_selectedTextStyleCached);
+            else
+                text.setStyle(m_textStyleCached);
         }
-
-        if ((m_hoveringItem >= 0) && (m_selectedItem != m_hoveringItem))
+        else
         {
-            if (m_textColorHoverCached.isSet())
-                m_items[m_hoveringItem].setColor(m_textColorHoverCached);
+            text.setColor(textColor);
+            text.setStyle(m_textStyleCached);
         }
     }
 
@@ -887,13 +911,56 @@ namespace tgui
 
     void ListBox::updateItemColorsAndStyle()
     {
-        for (auto& item : m_items)
+        for (std::size_t i = 0; i < m_visibleItems.size(); ++i)
+            updateItemColorAndStyle(static_cast<int>(m_firstVisibleItem + i));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::updateVisibleItems()
+    {
+        // The items or the scroll position may have changed
+        invalidate();
+
+        // Find out which items are visible
+        std::size_t firstItem = 0;
+        std::size_t lastItem = m_items.size();
+        if ((m_itemHeight > 0) && (m_scroll->getLowValue() < m_scroll->getMaximum()))
         {
-            item.setColor(m_textColorCached);
-            item.setStyle(m_textStyleCached);
+            firstItem = m_scroll->getValue() / m_itemHeight;
+            lastItem = std::min<std::size_t>(m_items.size(), ((m_scroll->getValue() + m_scroll->getLowValue()) / m_itemHeight) + 1);
         }
 
-        updateSelectedAndHoveringItemColorsAndStyle();
+        // Nothing has to be done when all visible items already have a text object
+        if (!m_visibleItems.empty() && (firstItem >= m_firstVisibleItem) && (lastItem <= m_firstVisibleItem + m_visibleItems.size()))
+            return;
+
+        // Create text objects for a few more items than needed, so that scrolling doesn't require recreating them every time
+        const std::size_t extraItems = 8;
+        m_firstVisibleItem = (firstItem > extraItems) ? (firstItem - extraItems) : 0;
+        m_visibleItems.resize(std::min(m_items.size(), lastItem + extraItems) - m_firstVisibleItem);
+        for (std::size_t i = 0; i < m_visibleItems.size(); ++i)
+        {
+            const std::size_t index = m_firstVisibleItem + i;
+
+            Text& text = m_visibleItems[i];
+            text.setFont(m_fontCached);
+            text.setOpacity(m_opacityCached);
+            text.setCharacterSize(m_textSize);
+            text.setString(m_items[index]);
+            text.setPosition({0, (index * m_itemHeight) + ((m_itemHeight - text.getSize().y) / 2.0f)});
+
+            updateItemColorAndStyle(static_cast<int>(index));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::updateItemIdIndices()
+    {
+        m_itemIdIndices.clear();
+        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
+            m_itemIdIndices.emplace(m_itemIds[i], i);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -902,17 +969,12 @@ namespace tgui
     {
         if (m_hoveringItem != item)
         {
-            if (m_hoveringItem >= 0)
-            {
-                if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorCached.isSet())
-                    m_items[m_hoveringItem].setColor(m_selectedTextColorCached);
-                else
-                    m_items[m_hoveringItem].setColor(m_textColorCached);
-            }
-
+            const int oldHoveringItem = m_hoveringItem;
             m_hoveringItem = item;
 
-            updateSelectedAndHoveringItemColorsAndStyle();
+            updateItemColorAndStyle(oldHoveringItem);
+            updateItemColorAndStyle(m_hoveringItem);
+            invalidate();
         }
     }
 
@@ -922,23 +984,16 @@ namespace tgui
     {
         if (m_selectedItem != item)
         {
-            if (m_selectedItem >= 0)
-            {
-                if ((m_selectedItem == m_hoveringItem) && m_textColorHoverCached.isSet())
-                    m_items[m_selectedItem].setColor(m_textColorHoverCached);
-                else
-                    m_items[m_selectedItem].setColor(m_textColorCached);
-
-                m_items[m_selectedItem].setStyle(m_textStyleCached);
-            }
-
+            const int oldSelectedItem = m_selectedItem;
             m_selectedItem = item;
             if (m_selectedItem >= 0)
-                onItemSelect.emit(this, m_items[m_selectedItem].getString(), m_itemIds[m_selectedItem]);
+                onItemSelect.emit(this, m_items[m_selectedItem], m_itemIds[m_selectedItem]);
             else
                 onItemSelect.emit(this, "", "");
 
-            updateSelectedAndHoveringItemColorsAndStyle();
+            updateItemColorAndStyle(oldSelectedItem);
+            updateItemColorAndStyle(m_selectedItem);
+            invalidate();
         }
     }
 
@@ -953,6 +1008,8 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_possibleDoubleClick = false;
         }
+        else if (m_possibleDoubleClick)
+            scheduleUpdate(sf::milliseconds(getDoubleClickTime()) - m_animationTimeElapsed);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -965,7 +1022,7 @@ namespace tgui
         // Draw the borders
         if (m_bordersCached != Borders{0})
         {
-            drawBorders(target, states, m_bordersCached, getSize(), m_borderColorCached);
+            drawFadedBorders(target, states, m_bordersCached, getSize(), m_borderColorCached);
             states.transform.translate({m_bordersCached.getLeft(), m_bordersCached.getTop()});
         }
 
@@ -973,7 +1030,7 @@ namespace tgui
         if (m_spriteBackground.isSet())
             m_spriteBackground.draw(target, states);
         else
-            drawRectangleShape(target, states, getInnerSize(), m_backgroundColorCached);
+            drawFadedRectangleShape(target, states, getInnerSize(), m_backgroundColorCached);
 
         // Draw the items and their selected/hover backgrounds
         {
@@ -1005,9 +1062,9 @@ namespace tgui
 
                 const Vector2f size = {getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight(), static_cast<float>(m_itemHeight)};
                 if ((m_selectedItem == m_hoveringItem) && m_selectedBackgroundColorHoverCached.isSet())
-                    drawRectangleShape(target, states, size, m_selectedBackgroundColorHoverCached);
+                    drawFadedRectangleShape(target, states, size, m_selectedBackgroundColorHoverCached);
                 else
-                    drawRectangleShape(target, states, size, m_selectedBackgroundColorCached);
+                    drawFadedRectangleShape(target, states, size, m_selectedBackgroundColorCached);
 
                 states.transform.translate({0, -static_cast<float>(m_selectedItem * m_itemHeight)});
             }
@@ -1016,14 +1073,16 @@ namespace tgui
             if ((m_hoveringItem >= 0) && (m_hoveringItem != m_selectedItem) && m_backgroundColorHoverCached.isSet())
             {
                 states.transform.translate({0, static_cast<float>(m_hoveringItem * m_itemHeight)});
-                drawRectangleShape(target, states, {getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight(), static_cast<float>(m_itemHeight)}, m_backgroundColorHoverCached);
+                drawFadedRectangleShape(target, states, {getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight(), static_cast<float>(m_itemHeight)}, m_backgroundColorHoverCached);
                 states.transform.translate({0, -static_cast<float>(m_hoveringItem * m_itemHeight)});
             }
 
-            // Draw the items
+            // Draw the items, only the visible ones have a text object
             states.transform.translate({Text::getExtraHorizontalPadding(m_fontCached, m_textSize, m_textStyleCached), 0});
+            firstItem = std::max(firstItem, m_firstVisibleItem);
+            lastItem = std::min(lastItem, m_firstVisibleItem + m_visibleItems.size());
             for (std::size_t i = firstItem; i < lastItem; ++i)
-                m_items[i].draw(target, states);
+                m_visibleItems[i - m_firstVisibleItem].draw(target, states);
         }
 
         // Draw the scrollbar
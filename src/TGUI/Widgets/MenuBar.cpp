@@ -26,6 +26,7 @@
 #include <TGUI/Widgets/MenuBar.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/Clipping.hpp>
+#include <limits>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -111,6 +112,7 @@ namespace tgui
         newMenu.text.setCharacterSize(m_textSize);
         newMenu.text.setString(text);
         m_menus.push_back(std::move(newMenu));
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -131,6 +133,7 @@ namespace tgui
                 menuItem.setString(text);
 
                 m_menus[i].menuItems.push_back(std::move(menuItem));
+                invalidate();
                 return true;
             }
         }
@@ -165,6 +168,7 @@ namespace tgui
                 if (m_visibleMenu == static_cast<int>(i))
                     m_visibleMenu = -1;
 
+                invalidate();
                 return true;
             }
         }
@@ -194,6 +198,7 @@ namespace tgui
                         if (m_menus[i].selectedMenuItem == static_cast<int>(j))
                             m_menus[i].selectedMenuItem = -1;
 
+                        invalidate();
                         return true;
                     }
                 }
@@ -209,6 +214,7 @@ namespace tgui
     void MenuBar::removeAllMenus()
     {
         m_menus.clear();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -224,6 +230,7 @@ namespace tgui
 
             m_menus[i].text.setCharacterSize(m_textSize);
         }
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -238,6 +245,7 @@ namespace tgui
     void MenuBar::setMinimumSubMenuWidth(float minimumWidth)
     {
         m_minimumSubMenuWidth = minimumWidth;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -252,6 +260,7 @@ namespace tgui
     void MenuBar::setInvertedMenuDirection(bool invertDirection)
     {
         m_invertedMenuDirection = invertDirection;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -295,11 +304,20 @@ namespace tgui
 
             m_menus[m_visibleMenu].text.setColor(m_textColorCached);
             m_visibleMenu = -1;
+            invalidate();
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    FloatRect MenuBar::getHitTestBounds() const
+    {
+        // The open menus are located outside the bounds of the widget
+        return {0, 0, std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity()};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool MenuBar::mouseOnWidget(Vector2f pos) const
     {
         // Check if the mouse is on top of the menu bar
@@ -532,7 +550,9 @@ namespace tgui
 
     void MenuBar::rendererChanged(const std::string& property)
     {
-        if (property == "textcolor")
+        const priv::PropertyId id = priv::makePropertyId(property);
+
+        if (id == priv::makePropertyId("textcolor"))
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
 
@@ -550,7 +570,7 @@ namespace tgui
             if ((m_visibleMenu != -1) && (m_menus[m_visibleMenu].selectedMenuItem != -1) && m_selectedTextColorCached.isSet())
                 m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setColor(m_selectedTextColorCached);
         }
-        else if (property == "selectedtextcolor")
+        else if (id == priv::makePropertyId("selectedtextcolor"))
         {
             m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
 
@@ -565,34 +585,38 @@ namespace tgui
                 }
             }
         }
-        else if (property == "texturebackground")
+        else if (id == priv::makePropertyId("texturebackground"))
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == "textureitembackground")
+        else if (id == priv::makePropertyId("textureitembackground"))
         {
             m_spriteItemBackground.setTexture(getSharedRenderer()->getTextureItemBackground());
         }
-        else if (property == "textureselecteditembackground")
+        else if (id == priv::makePropertyId("textureselecteditembackground"))
         {
             m_spriteSelectedItemBackground.setTexture(getSharedRenderer()->getTextureSelectedItemBackground());
         }
-        else if (property == "backgroundcolor")
+        else if (id == priv::makePropertyId("backgroundcolor"))
         {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+            m_backgroundColorCached = applyOpacity(getSharedRenderer()->getBackgroundColor());
         }
-        else if (property == "selectedbackgroundcolor")
+        else if (id == priv::makePropertyId("selectedbackgroundcolor"))
         {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+            m_selectedBackgroundColorCached = applyOpacity(getSharedRenderer()->getSelectedBackgroundColor());
         }
-        else if (property == "distancetoside")
+        else if (id == priv::makePropertyId("distancetoside"))
         {
             m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
         }
-        else if (property == "opacity")
+        else if (id == priv::makePropertyId("opacity"))
         {
             Widget::rendererChanged(property);
 
+            // The cached colors have the opacity applied to them, so they are updated as well
+            for (const char* colorProperty : {"backgroundcolor", "selectedbackgroundcolor"})
+                rendererChanged(colorProperty);
+
             for (unsigned int i = 0; i < m_menus.size(); ++i)
             {
                 for (unsigned int j = 0; j < m_menus[i].menuItems.size(); ++j)
@@ -603,7 +627,7 @@ namespace tgui
 
             m_spriteBackground.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (id == priv::makePropertyId("font"))
         {
             Widget::rendererChanged(property);
 
@@ -707,10 +731,9 @@ namespace tgui
         if (m_spriteBackground.isSet())
             m_spriteBackground.draw(target, states);
         else
-            drawRectangleShape(target, states, getSize(), m_backgroundColorCached);
+            drawFadedRectangleShape(target, states, getSize(), m_backgroundColorCached);
 
         // Draw the menu backgrounds
-        Sprite backgroundSprite = m_spriteItemBackground;
         for (unsigned int i = 0; i < m_menus.size(); ++i)
         {
             // Is the menu open?
@@ -723,49 +746,43 @@ namespace tgui
                 for (unsigned int j = 0; j < m_menus[i].menuItems.size(); ++j)
                     menuWidth = std::max(menuWidth, m_menus[i].menuItems[j].getSize().x + (2 * m_distanceToSideCached));
 
-                Sprite selectedBackgroundSprite = m_spriteSelectedItemBackground;
-                if (selectedBackgroundSprite.isSet() && backgroundSprite.isSet())
+                if (m_spriteSelectedItemBackground.isSet() && m_spriteItemBackground.isSet())
                 {
-                    selectedBackgroundSprite.setSize({m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), getSize().y});
-                    selectedBackgroundSprite.draw(target, states);
+                    m_spriteSelectedItemBackground.draw(target, states, {m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), getSize().y});
 
-                    backgroundSprite.setSize({menuWidth, getSize().y});
-                    selectedBackgroundSprite.setSize({menuWidth, getSize().y});
                     for (unsigned int j = 0; j < m_menus[i].menuItems.size(); ++j)
                     {
                         states.transform.translate({0, nextItemDistance});
                         if (m_menus[i].selectedMenuItem == static_cast<int>(j))
-                            selectedBackgroundSprite.draw(target, states);
+                            m_spriteSelectedItemBackground.draw(target, states, {menuWidth, getSize().y});
                         else
-                            backgroundSprite.draw(target, states);
+                            m_spriteItemBackground.draw(target, states, {menuWidth, getSize().y});
                     }
                 }
-                else if (backgroundSprite.isSet())
+                else if (m_spriteItemBackground.isSet())
                 {
-                    backgroundSprite.setSize({m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), getSize().y});
-                    backgroundSprite.draw(target, states);
+                    m_spriteItemBackground.draw(target, states, {m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), getSize().y});
 
-                    backgroundSprite.setSize({menuWidth, getSize().y});
                     for (unsigned int j = 0; j < m_menus[i].menuItems.size(); ++j)
                     {
                         states.transform.translate({0, nextItemDistance});
-                        backgroundSprite.draw(target, states);
+                        m_spriteItemBackground.draw(target, states, {menuWidth, getSize().y});
                     }
                 }
                 else // No textures where loaded
                 {
                     if (m_selectedBackgroundColorCached.isSet())
-                        drawRectangleShape(target, states, {m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), getSize().y}, m_selectedBackgroundColorCached);
+                        drawFadedRectangleShape(target, states, {m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), getSize().y}, m_selectedBackgroundColorCached);
                     else
-                        drawRectangleShape(target, states, {m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), getSize().y}, m_backgroundColorCached);
+                        drawFadedRectangleShape(target, states, {m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), getSize().y}, m_backgroundColorCached);
 
                     for (unsigned int j = 0; j < m_menus[i].menuItems.size(); ++j)
                     {
                         states.transform.translate({0, nextItemDistance});
                         if ((m_menus[i].selectedMenuItem == static_cast<int>(j)) && m_selectedBackgroundColorCached.isSet())
-                            drawRectangleShape(target, states, {menuWidth, getSize().y}, m_selectedBackgroundColorCached);
+                            drawFadedRectangleShape(target, states, {menuWidth, getSize().y}, m_selectedBackgroundColorCached);
                         else
-                            drawRectangleShape(target, states, {menuWidth, getSize().y}, m_backgroundColorCached);
+                            drawFadedRectangleShape(target, states, {menuWidth, getSize().y}, m_backgroundColorCached);
                     }
                 }
 
@@ -773,11 +790,8 @@ namespace tgui
             }
             else // This menu is not open
             {
-                if (backgroundSprite.isSet())
-                {
-                    backgroundSprite.setSize({m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), getSize().y});
-                    backgroundSprite.draw(target, states);
-                }
+                if (m_spriteItemBackground.isSet())
+                    m_spriteItemBackground.draw(target, states, {m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), getSize().y});
             }
 
             states.transform.translate({m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), 0});
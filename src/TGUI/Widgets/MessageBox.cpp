@@ -305,17 +305,19 @@ namespace tgui
 
     void MessageBox::rendererChanged(const std::string& property)
     {
-        if (property == "textcolor")
+        const priv::PropertyId id = priv::makePropertyId(property);
+
+        if (id == priv::makePropertyId("textcolor"))
         {
             m_label->getRenderer()->setTextColor(getSharedRenderer()->getTextColor());
         }
-        else if (property == "button")
+        else if (id == priv::makePropertyId("button"))
         {
             const auto& renderer = getSharedRenderer()->getButton();
             for (auto& button : m_buttons)
                 button->setRenderer(renderer);
         }
-        else if (property == "font")
+        else if (id == priv::makePropertyId("font"))
         {
             ChildWindow::rendererChanged(property);
 
@@ -163,18 +163,28 @@ namespace tgui
 
     void Panel::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        const priv::PropertyId id = priv::makePropertyId(property);
+
+        if (id == priv::makePropertyId("borders"))
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == "bordercolor")
+        else if (id == priv::makePropertyId("bordercolor"))
+        {
+            m_borderColorCached = applyOpacity(getSharedRenderer()->getBorderColor());
+        }
+        else if (id == priv::makePropertyId("backgroundcolor"))
         {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
+            m_backgroundColorCached = applyOpacity(getSharedRenderer()->getBackgroundColor());
         }
-        else if (property == "backgroundcolor")
+        else if (id == priv::makePropertyId("opacity"))
         {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+            Group::rendererChanged(property);
+
+            // The cached colors have the opacity applied to them, so they are updated as well
+            for (const char* colorProperty : {"bordercolor", "backgroundcolor"})
+                rendererChanged(colorProperty);
         }
         else
             Group::rendererChanged(property);
@@ -189,14 +199,14 @@ namespace tgui
         // Draw the borders
         if (m_bordersCached != Borders{0})
         {
-            drawBorders(target, states, m_bordersCached, getSize(), m_borderColorCached);
+            drawFadedBorders(target, states, m_bordersCached, getSize(), m_borderColorCached);
             states.transform.translate({m_bordersCached.getLeft(), m_bordersCached.getTop()});
         }
 
         // Draw the background
         const Vector2f innerSize = {getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
                                         getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()};
-        drawRectangleShape(target, states, innerSize, m_backgroundColorCached);
+        drawFadedRectangleShape(target, states, innerSize, m_backgroundColorCached);
 
         states.transform.translate(m_paddingCached.getLeft(), m_paddingCached.getTop());
         const Vector2f contentSize = {innerSize.x - m_paddingCached.getLeft() - m_paddingCached.getRight(),
@@ -163,6 +163,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                scheduleUpdate(sf::milliseconds(getDoubleClickTime()));
             }
         }
     }
@@ -181,7 +182,9 @@ namespace tgui
 
     void Picture::rendererChanged(const std::string& property)
     {
-        if (property == "texture")
+        const priv::PropertyId id = priv::makePropertyId(property);
+
+        if (id == priv::makePropertyId("texture"))
         {
             const auto& texture = getSharedRenderer()->getTexture();
 
@@ -190,11 +193,11 @@ namespace tgui
 
             m_sprite.setTexture(texture);
         }
-        else if (property == "ignoretransparentparts")
+        else if (id == priv::makePropertyId("ignoretransparentparts"))
         {
             m_ignoreTransparentParts = getSharedRenderer()->getIgnoreTransparentParts();
         }
-        else if (property == "opacity")
+        else if (id == priv::makePropertyId("opacity"))
         {
             Widget::rendererChanged(property);
             m_sprite.setOpacity(m_opacityCached);
@@ -236,6 +239,8 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_possibleDoubleClick = false;
         }
+        else if (m_possibleDoubleClick)
+            scheduleUpdate(sf::milliseconds(getDoubleClickTime()) - m_animationTimeElapsed);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -234,6 +234,7 @@ namespace tgui
         }
 
         m_textFront.setCharacterSize(m_textBack.getCharacterSize());
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -290,12 +291,14 @@ namespace tgui
 
     void ProgressBar::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        const priv::PropertyId id = priv::makePropertyId(property);
+
+        if (id == priv::makePropertyId("borders"))
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if ((property == "textcolor") || (property == "textcolorfilled"))
+        else if ((id == priv::makePropertyId("textcolor")) || (id == priv::makePropertyId("textcolorfilled")))
         {
             m_textBack.setColor(getSharedRenderer()->getTextColor());
 
@@ -304,43 +307,47 @@ namespace tgui
             else
                 m_textFront.setColor(getSharedRenderer()->getTextColor());
         }
-        else if (property == "texturebackground")
+        else if (id == priv::makePropertyId("texturebackground"))
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == "texturefill")
+        else if (id == priv::makePropertyId("texturefill"))
         {
             m_spriteFill.setTexture(getSharedRenderer()->getTextureFill());
             recalculateFillSize();
         }
-        else if (property == "textstyle")
+        else if (id == priv::makePropertyId("textstyle"))
         {
             m_textBack.setStyle(getSharedRenderer()->getTextStyle());
             m_textFront.setStyle(getSharedRenderer()->getTextStyle());
         }
-        else if (property == "bordercolor")
+        else if (id == priv::makePropertyId("bordercolor"))
         {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
+            m_borderColorCached = applyOpacity(getSharedRenderer()->getBorderColor());
         }
-        else if (property == "backgroundcolor")
+        else if (id == priv::makePropertyId("backgroundcolor"))
         {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+            m_backgroundColorCached = applyOpacity(getSharedRenderer()->getBackgroundColor());
         }
-        else if (property == "fillcolor")
+        else if (id == priv::makePropertyId("fillcolor"))
         {
-            m_fillColorCached = getSharedRenderer()->getFillColor();
+            m_fillColorCached = applyOpacity(getSharedRenderer()->getFillColor());
         }
-        else if (property == "opacity")
+        else if (id == priv::makePropertyId("opacity"))
         {
             Widget::rendererChanged(property);
 
+            // The cached colors have the opacity applied to them, so they are updated as well
+            for (const char* colorProperty : {"bordercolor", "backgroundcolor", "fillcolor"})
+                rendererChanged(colorProperty);
+
             m_spriteBackground.setOpacity(m_opacityCached);
             m_spriteFill.setOpacity(m_opacityCached);
 
             m_textBack.setOpacity(m_opacityCached);
             m_textFront.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (id == priv::makePropertyId("font"))
         {
             Widget::rendererChanged(property);
 
@@ -461,6 +468,7 @@ namespace tgui
 
         if (m_spriteFill.isSet())
             m_spriteFill.setVisibleRect(m_frontRect);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -501,7 +509,7 @@ namespace tgui
         // Draw the borders
         if (m_bordersCached != Borders{0})
         {
-            drawBorders(target, states, m_bordersCached, getSize(), m_borderColorCached);
+            drawFadedBorders(target, states, m_bordersCached, getSize(), m_borderColorCached);
             states.transform.translate({m_bordersCached.getLeft(), m_bordersCached.getTop()});
         }
 
@@ -513,7 +521,7 @@ namespace tgui
             Vector2f positionOffset = {m_backRect.left, m_backRect.top};
 
             states.transform.translate(positionOffset);
-            drawRectangleShape(target, states, {m_backRect.width, m_backRect.height}, m_backgroundColorCached);
+            drawFadedRectangleShape(target, states, {m_backRect.width, m_backRect.height}, m_backgroundColorCached);
             states.transform.translate(-positionOffset);
         }
 
@@ -537,7 +545,7 @@ namespace tgui
             Vector2f positionOffset = {m_frontRect.left, m_frontRect.top};
 
             states.transform.translate(positionOffset);
-            drawRectangleShape(target, states, {m_frontRect.width, m_frontRect.height}, m_fillColorCached);
+            drawFadedRectangleShape(target, states, {m_frontRect.width, m_frontRect.height}, m_fillColorCached);
             states.transform.translate(-positionOffset);
         }
 
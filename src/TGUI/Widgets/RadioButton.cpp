@@ -25,6 +25,7 @@
 
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Container.hpp>
+#include <TGUI/BatchRenderer.hpp>
 #include <SFML/Graphics/CircleShape.hpp>
 
 namespace tgui
@@ -151,12 +152,16 @@ namespace tgui
             m_text.setStyle(m_textStyleCheckedCached);
         else
             m_text.setStyle(m_textStyleCached);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void RadioButton::setText(const sf::String& text)
     {
+        // The text is part of the full size of the widget, so both the old and the new area have to be redrawn
+        invalidate();
+
         // Set the new text
         m_text.setString(text);
 
@@ -165,6 +170,12 @@ namespace tgui
             m_text.setCharacterSize(Text::findBestTextSize(m_fontCached, getSize().y * 0.8f));
         else
             m_text.setCharacterSize(m_textSize);
+
+        invalidate();
+
+        // The text is part of the full size of the widget
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -283,18 +294,20 @@ namespace tgui
 
     void RadioButton::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        const priv::PropertyId id = priv::makePropertyId(property);
+
+        if (id == priv::makePropertyId("borders"))
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             m_bordersCached.updateParentSize(getSize());
             updateTextureSizes();
         }
-        else if ((property == "textcolor") || (property == "textcolorhover") || (property == "textcolordisabled")
-              || (property == "textcolorchecked") || (property == "textcolorcheckedhover") || (property == "textcolorcheckeddisabled"))
+        else if ((id == priv::makePropertyId("textcolor")) || (id == priv::makePropertyId("textcolorhover")) || (id == priv::makePropertyId("textcolordisabled"))
+              || (id == priv::makePropertyId("textcolorchecked")) || (id == priv::makePropertyId("textcolorcheckedhover")) || (id == priv::makePropertyId("textcolorcheckeddisabled")))
         {
             updateTextColor();
         }
-        else if (property == "textstyle")
+        else if (id == priv::makePropertyId("textstyle"))
         {
             m_textStyleCached = getSharedRenderer()->getTextStyle();
 
@@ -303,7 +316,7 @@ namespace tgui
             else
                 m_text.setStyle(m_textStyleCached);
         }
-        else if (property == "textstylechecked")
+        else if (id == priv::makePropertyId("textstylechecked"))
         {
             m_textStyleCheckedCached = getSharedRenderer()->getTextStyleChecked();
 
@@ -312,116 +325,125 @@ namespace tgui
             else
                 m_text.setStyle(m_textStyleCached);
         }
-        else if (property == "textureunchecked")
+        else if (id == priv::makePropertyId("textureunchecked"))
         {
             m_spriteUnchecked.setTexture(getSharedRenderer()->getTextureUnchecked());
             updateTextureSizes();
         }
-        else if (property == "texturechecked")
+        else if (id == priv::makePropertyId("texturechecked"))
         {
             m_spriteChecked.setTexture(getSharedRenderer()->getTextureChecked());
             updateTextureSizes();
         }
-        else if (property == "textureuncheckedhover")
+        else if (id == priv::makePropertyId("textureuncheckedhover"))
         {
             m_spriteUncheckedHover.setTexture(getSharedRenderer()->getTextureUncheckedHover());
         }
-        else if (property == "texturecheckedhover")
+        else if (id == priv::makePropertyId("texturecheckedhover"))
         {
             m_spriteCheckedHover.setTexture(getSharedRenderer()->getTextureCheckedHover());
         }
-        else if (property == "textureuncheckeddisabled")
+        else if (id == priv::makePropertyId("textureuncheckeddisabled"))
         {
             m_spriteUncheckedDisabled.setTexture(getSharedRenderer()->getTextureUncheckedDisabled());
         }
-        else if (property == "texturecheckeddisabled")
+        else if (id == priv::makePropertyId("texturecheckeddisabled"))
         {
             m_spriteCheckedDisabled.setTexture(getSharedRenderer()->getTextureCheckedDisabled());
         }
-        else if (property == "textureuncheckedfocused")
+        else if (id == priv::makePropertyId("textureuncheckedfocused"))
         {
             m_spriteUncheckedFocused.setTexture(getSharedRenderer()->getTextureUncheckedFocused());
         }
-        else if (property == "texturecheckedfocused")
+        else if (id == priv::makePropertyId("texturecheckedfocused"))
         {
             m_spriteCheckedFocused.setTexture(getSharedRenderer()->getTextureCheckedFocused());
         }
-        else if (property == "checkcolor")
+        else if (id == priv::makePropertyId("checkcolor"))
         {
-            m_checkColorCached = getSharedRenderer()->getCheckColor();
+            m_checkColorCached = applyOpacity(getSharedRenderer()->getCheckColor());
         }
-        else if (property == "checkcolorhover")
+        else if (id == priv::makePropertyId("checkcolorhover"))
         {
-            m_checkColorHoverCached = getSharedRenderer()->getCheckColorHover();
+            m_checkColorHoverCached = applyOpacity(getSharedRenderer()->getCheckColorHover());
         }
-        else if (property == "checkcolordisabled")
+        else if (id == priv::makePropertyId("checkcolordisabled"))
         {
-            m_checkColorDisabledCached = getSharedRenderer()->getCheckColorDisabled();
+            m_checkColorDisabledCached = applyOpacity(getSharedRenderer()->getCheckColorDisabled());
         }
-        else if (property == "bordercolor")
+        else if (id == priv::makePropertyId("bordercolor"))
         {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
+            m_borderColorCached = applyOpacity(getSharedRenderer()->getBorderColor());
         }
-        else if (property == "bordercolorhover")
+        else if (id == priv::makePropertyId("bordercolorhover"))
         {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+            m_borderColorHoverCached = applyOpacity(getSharedRenderer()->getBorderColorHover());
         }
-        else if (property == "bordercolordisabled")
+        else if (id == priv::makePropertyId("bordercolordisabled"))
         {
-            m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
+            m_borderColorDisabledCached = applyOpacity(getSharedRenderer()->getBorderColorDisabled());
         }
-        else if (property == "bordercolorfocused")
+        else if (id == priv::makePropertyId("bordercolorfocused"))
         {
-            m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
+            m_borderColorFocusedCached = applyOpacity(getSharedRenderer()->getBorderColorFocused());
         }
-        else if (property == "bordercolorchecked")
+        else if (id == priv::makePropertyId("bordercolorchecked"))
         {
-            m_borderColorCheckedCached = getSharedRenderer()->getBorderColorChecked();
+            m_borderColorCheckedCached = applyOpacity(getSharedRenderer()->getBorderColorChecked());
         }
-        else if (property == "bordercolorcheckedhover")
+        else if (id == priv::makePropertyId("bordercolorcheckedhover"))
         {
-            m_borderColorCheckedHoverCached = getSharedRenderer()->getBorderColorCheckedHover();
+            m_borderColorCheckedHoverCached = applyOpacity(getSharedRenderer()->getBorderColorCheckedHover());
         }
-        else if (property == "bordercolorcheckeddisabled")
+        else if (id == priv::makePropertyId("bordercolorcheckeddisabled"))
         {
-            m_borderColorCheckedDisabledCached = getSharedRenderer()->getBorderColorCheckedDisabled();
+            m_borderColorCheckedDisabledCached = applyOpacity(getSharedRenderer()->getBorderColorCheckedDisabled());
         }
-        else if (property == "bordercolorcheckedfocused")
+        else if (id == priv::makePropertyId("bordercolorcheckedfocused"))
         {
-            m_borderColorCheckedFocusedCached = getSharedRenderer()->getBorderColorCheckedFocused();
+            m_borderColorCheckedFocusedCached = applyOpacity(getSharedRenderer()->getBorderColorCheckedFocused());
         }
-        else if (property == "backgroundcolor")
+        else if (id == priv::makePropertyId("backgroundcolor"))
         {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+            m_backgroundColorCached = applyOpacity(getSharedRenderer()->getBackgroundColor());
         }
-        else if (property == "backgroundcolorhover")
+        else if (id == priv::makePropertyId("backgroundcolorhover"))
         {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+            m_backgroundColorHoverCached = applyOpacity(getSharedRenderer()->getBackgroundColorHover());
         }
-        else if (property == "backgroundcolordisabled")
+        else if (id == priv::makePropertyId("backgroundcolordisabled"))
         {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+            m_backgroundColorDisabledCached = applyOpacity(getSharedRenderer()->getBackgroundColorDisabled());
         }
-        else if (property == "backgroundcolorchecked")
+        else if (id == priv::makePropertyId("backgroundcolorchecked"))
         {
-            m_backgroundColorCheckedCached = getSharedRenderer()->getBackgroundColorChecked();
+            m_backgroundColorCheckedCached = applyOpacity(getSharedRenderer()->getBackgroundColorChecked());
         }
-        else if (property == "backgroundcolorcheckedhover")
+        else if (id == priv::makePropertyId("backgroundcolorcheckedhover"))
         {
-            m_backgroundColorCheckedHoverCached = getSharedRenderer()->getBackgroundColorCheckedHover();
+            m_backgroundColorCheckedHoverCached = applyOpacity(getSharedRenderer()->getBackgroundColorCheckedHover());
         }
-        else if (property == "backgroundcolorcheckeddisabled")
+        else if (id == priv::makePropertyId("backgroundcolorcheckeddisabled"))
         {
-            m_backgroundColorCheckedDisabledCached = getSharedRenderer()->getBackgroundColorCheckedDisabled();
+            m_backgroundColorCheckedDisabledCached = applyOpacity(getSharedRenderer()->getBackgroundColorCheckedDisabled());
         }
-        else if (property == "textdistanceratio")
+        else if (id == priv::makePropertyId("textdistanceratio"))
         {
             m_textDistanceRatioCached = getSharedRenderer()->getTextDistanceRatio();
         }
-        else if (property == "opacity")
+        else if (id == priv::makePropertyId("opacity"))
         {
             Widget::rendererChanged(property);
 
+            // The cached colors have the opacity applied to them, so they are updated as well
+            for (const char* colorProperty : {"checkcolor", "checkcolorhover", "checkcolordisabled", "bordercolor",
+                                              "bordercolorhover", "bordercolordisabled", "bordercolorfocused",
+                                              "bordercolorchecked", "bordercolorcheckedhover", "bordercolorcheckeddisabled",
+                                              "bordercolorcheckedfocused", "backgroundcolor", "backgroundcolorhover",
+                                              "backgroundcolordisabled", "backgroundcolorchecked", "backgroundcolorcheckedhover",
+                                              "backgroundcolorcheckeddisabled"})
+                rendererChanged(colorProperty);
+
             m_spriteUnchecked.setOpacity(m_opacityCached);
             m_spriteChecked.setOpacity(m_opacityCached);
             m_spriteUncheckedHover.setOpacity(m_opacityCached);
@@ -433,7 +455,7 @@ namespace tgui
 
             m_text.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (id == priv::makePropertyId("font"))
         {
             Widget::rendererChanged(property);
 
@@ -654,8 +676,8 @@ namespace tgui
             sf::CircleShape circle{innerRadius + m_bordersCached.getLeft()};
             circle.setOutlineThickness(-m_bordersCached.getLeft());
             circle.setFillColor(Color::Transparent);
-            circle.setOutlineColor(Color::calcColorOpacity(getCurrentBorderColor(), m_opacityCached));
-            target.draw(circle, states);
+            circle.setOutlineColor(getCurrentBorderColor());
+            priv::BatchRenderer::draw(target, circle, states);
         }
 
         // Draw the box
@@ -688,16 +710,16 @@ namespace tgui
         else // There are no images
         {
             sf::CircleShape circle{innerRadius};
-            circle.setFillColor(Color::calcColorOpacity(getCurrentBackgroundColor(), m_opacityCached));
-            target.draw(circle, states);
+            circle.setFillColor(getCurrentBackgroundColor());
+            priv::BatchRenderer::draw(target, circle, states);
 
             // Draw the check if the radio button is checked
             if (m_checked)
             {
                 sf::CircleShape checkShape{innerRadius * 0.4f};
-                checkShape.setFillColor(Color::calcColorOpacity(getCurrentCheckColor(), m_opacityCached));
+                checkShape.setFillColor(getCurrentCheckColor());
                 checkShape.setPosition({innerRadius - checkShape.getRadius(), innerRadius - checkShape.getRadius()});
-                target.draw(checkShape, states);
+                priv::BatchRenderer::draw(target, checkShape, states);
             }
         }
         states.transform.translate({-m_bordersCached.getLeft(), -m_bordersCached.getLeft()});
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/RangeSlider.hpp>
+#include <TGUI/Container.hpp>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -171,6 +172,10 @@ namespace tgui
         m_thumbs.second.height = m_thumbs.first.height;
 
         updateThumbPositions();
+
+        // The full size of the widget depends on the thumbs, which weren't recalculated yet when Widget::setSize told the parent
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -486,12 +491,14 @@ namespace tgui
 
     void RangeSlider::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        const priv::PropertyId id = priv::makePropertyId(property);
+
+        if (id == priv::makePropertyId("borders"))
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == "texturetrack")
+        else if (id == priv::makePropertyId("texturetrack"))
         {
             m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
 
@@ -502,55 +509,60 @@ namespace tgui
 
             setSize(m_size);
         }
-        else if (property == "texturetrackhover")
+        else if (id == priv::makePropertyId("texturetrackhover"))
         {
             m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
         }
-        else if (property == "texturethumb")
+        else if (id == priv::makePropertyId("texturethumb"))
         {
             m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
             setSize(m_size);
         }
-        else if (property == "texturethumbhover")
+        else if (id == priv::makePropertyId("texturethumbhover"))
         {
             m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
         }
-        else if (property == "trackcolor")
+        else if (id == priv::makePropertyId("trackcolor"))
         {
-            m_trackColorCached = getSharedRenderer()->getTrackColor();
+            m_trackColorCached = applyOpacity(getSharedRenderer()->getTrackColor());
         }
-        else if (property == "trackcolorhover")
+        else if (id == priv::makePropertyId("trackcolorhover"))
         {
-            m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
+            m_trackColorHoverCached = applyOpacity(getSharedRenderer()->getTrackColorHover());
         }
-        else if (property == "selectedtrackcolor")
+        else if (id == priv::makePropertyId("selectedtrackcolor"))
         {
-            m_selectedTrackColorCached = getSharedRenderer()->getSelectedTrackColor();
+            m_selectedTrackColorCached = applyOpacity(getSharedRenderer()->getSelectedTrackColor());
         }
-        else if (property == "selectedtrackcolorhover")
+        else if (id == priv::makePropertyId("selectedtrackcolorhover"))
         {
-            m_selectedTrackColorHoverCached = getSharedRenderer()->getSelectedTrackColorHover();
+            m_selectedTrackColorHoverCached = applyOpacity(getSharedRenderer()->getSelectedTrackColorHover());
         }
-        else if (property == "thumbcolor")
+        else if (id == priv::makePropertyId("thumbcolor"))
         {
-            m_thumbColorCached = getSharedRenderer()->getThumbColor();
+            m_thumbColorCached = applyOpacity(getSharedRenderer()->getThumbColor());
         }
-        else if (property == "thumbcolorhover")
+        else if (id == priv::makePropertyId("thumbcolorhover"))
         {
-            m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
+            m_thumbColorHoverCached = applyOpacity(getSharedRenderer()->getThumbColorHover());
         }
-        else if (property == "bordercolor")
+        else if (id == priv::makePropertyId("bordercolor"))
         {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
+            m_borderColorCached = applyOpacity(getSharedRenderer()->getBorderColor());
         }
-        else if (property == "bordercolorhover")
+        else if (id == priv::makePropertyId("bordercolorhover"))
         {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+            m_borderColorHoverCached = applyOpacity(getSharedRenderer()->getBorderColorHover());
         }
-        else if (property == "opacity")
+        else if (id == priv::makePropertyId("opacity"))
         {
             Widget::rendererChanged(property);
 
+            // The cached colors have the opacity applied to them, so they are updated as well
+            for (const char* colorProperty : {"trackcolor", "trackcolorhover", "selectedtrackcolor", "selectedtrackcolorhover",
+                                              "thumbcolor", "thumbcolorhover", "bordercolor", "bordercolorhover"})
+                rendererChanged(colorProperty);
+
             m_spriteTrack.setOpacity(m_opacityCached);
             m_spriteTrackHover.setOpacity(m_opacityCached);
             m_spriteThumb.setOpacity(m_opacityCached);
@@ -623,6 +635,7 @@ namespace tgui
             m_thumbs.second.left = (innerSize.x / (m_maximum - m_minimum) * (m_selectionEnd - m_minimum)) - (m_thumbs.second.width / 2.0f);
             m_thumbs.second.top = m_bordersCached.getTop() + (innerSize.y - m_thumbs.second.height) / 2.0f;
         }
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -635,9 +648,9 @@ namespace tgui
         if (m_bordersCached != Borders{0})
         {
             if (m_mouseHover && m_borderColorHoverCached.isSet())
-                drawBorders(target, states, m_bordersCached, getSize(), m_borderColorHoverCached);
+                drawFadedBorders(target, states, m_bordersCached, getSize(), m_borderColorHoverCached);
             else
-                drawBorders(target, states, m_bordersCached, getSize(), m_borderColorCached);
+                drawFadedBorders(target, states, m_bordersCached, getSize(), m_borderColorCached);
 
             states.transform.translate({m_bordersCached.getLeft(), m_bordersCached.getTop()});
         }
@@ -653,9 +666,9 @@ namespace tgui
         else // There are no textures
         {
             if (m_mouseHover && m_trackColorHoverCached.isSet())
-                drawRectangleShape(target, states, getInnerSize(), m_trackColorHoverCached);
+                drawFadedRectangleShape(target, states, getInnerSize(), m_trackColorHoverCached);
             else
-                drawRectangleShape(target, states, getInnerSize(), m_trackColorCached);
+                drawFadedRectangleShape(target, states, getInnerSize(), m_trackColorCached);
 
             if (m_selectedTrackColorCached.isSet())
             {
@@ -674,9 +687,9 @@ namespace tgui
                 }
 
                 if (m_mouseHover && m_selectedTrackColorHoverCached.isSet())
-                    drawRectangleShape(target, selectedTrackStates, size, m_selectedTrackColorHoverCached);
+                    drawFadedRectangleShape(target, selectedTrackStates, size, m_selectedTrackColorHoverCached);
                 else
-                    drawRectangleShape(target, selectedTrackStates, size, m_selectedTrackColorCached);
+                    drawFadedRectangleShape(target, selectedTrackStates, size, m_selectedTrackColorCached);
             }
         }
 
@@ -690,9 +703,9 @@ namespace tgui
             if ((m_bordersCached != Borders{0}) && !(m_spriteTrack.isSet() && m_spriteThumb.isSet()))
             {
                 if (m_mouseHover && m_borderColorHoverCached.isSet())
-                    drawBorders(target, states, m_bordersCached, {m_thumbs.first.width, m_thumbs.first.height}, m_borderColorHoverCached);
+                    drawFadedBorders(target, states, m_bordersCached, {m_thumbs.first.width, m_thumbs.first.height}, m_borderColorHoverCached);
                 else
-                    drawBorders(target, states, m_bordersCached, {m_thumbs.first.width, m_thumbs.first.height}, m_borderColorCached);
+                    drawFadedBorders(target, states, m_bordersCached, {m_thumbs.first.width, m_thumbs.first.height}, m_borderColorCached);
 
                 states.transform.translate({m_bordersCached.getLeft(), m_bordersCached.getTop()});
             }
@@ -711,9 +724,9 @@ namespace tgui
                                                      m_thumbs.first.height - m_bordersCached.getTop() - m_bordersCached.getBottom()};
 
                 if (m_mouseHover && m_thumbColorHoverCached.isSet())
-                    drawRectangleShape(target, states, thumbInnerSize, m_thumbColorHoverCached);
+                    drawFadedRectangleShape(target, states, thumbInnerSize, m_thumbColorHoverCached);
                 else
-                    drawRectangleShape(target, states, thumbInnerSize, m_thumbColorCached);
+                    drawFadedRectangleShape(target, states, thumbInnerSize, m_thumbColorCached);
             }
         }
 
@@ -727,9 +740,9 @@ namespace tgui
             if ((m_bordersCached != Borders{0}) && !(m_spriteTrack.isSet() && m_spriteThumb.isSet()))
             {
                 if (m_mouseHover && m_borderColorHoverCached.isSet())
-                    drawBorders(target, states, m_bordersCached, {m_thumbs.second.width, m_thumbs.second.height}, m_borderColorHoverCached);
+                    drawFadedBorders(target, states, m_bordersCached, {m_thumbs.second.width, m_thumbs.second.height}, m_borderColorHoverCached);
                 else
-                    drawBorders(target, states, m_bordersCached, {m_thumbs.second.width, m_thumbs.second.height}, m_borderColorCached);
+                    drawFadedBorders(target, states, m_bordersCached, {m_thumbs.second.width, m_thumbs.second.height}, m_borderColorCached);
 
                 states.transform.translate({m_bordersCached.getLeft(), m_bordersCached.getTop()});
             }
@@ -748,9 +761,9 @@ namespace tgui
                                                      m_thumbs.second.height - m_bordersCached.getTop() - m_bordersCached.getBottom()};
 
                 if (m_mouseHover && m_thumbColorHoverCached.isSet())
-                    drawRectangleShape(target, states, thumbInnerSize, m_thumbColorHoverCached);
+                    drawFadedRectangleShape(target, states, thumbInnerSize, m_thumbColorHoverCached);
                 else
-                    drawRectangleShape(target, states, thumbInnerSize, m_thumbColorCached);
+                    drawFadedRectangleShape(target, states, thumbInnerSize, m_thumbColorCached);
             }
         }
     }
@@ -24,7 +24,7 @@
 
 
 #include <TGUI/Widgets/Scrollbar.hpp>
-#include <SFML/Graphics/ConvexShape.hpp>
+#include <TGUI/BatchRenderer.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -322,6 +322,7 @@ namespace tgui
     void Scrollbar::setAutoHide(bool autoHide)
     {
         m_autoHide = autoHide;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -687,78 +688,86 @@ namespace tgui
 
     void Scrollbar::rendererChanged(const std::string& property)
     {
-        if (property == "texturetrack")
+        const priv::PropertyId id = priv::makePropertyId(property);
+
+        if (id == priv::makePropertyId("texturetrack"))
         {
             m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
             setSize(m_size);
         }
-        else if (property == "texturetrackhover")
+        else if (id == priv::makePropertyId("texturetrackhover"))
         {
             m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
         }
-        else if (property == "texturethumb")
+        else if (id == priv::makePropertyId("texturethumb"))
         {
             m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
             setSize(m_size);
         }
-        else if (property == "texturethumbhover")
+        else if (id == priv::makePropertyId("texturethumbhover"))
         {
             m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
         }
-        else if (property == "texturearrowup")
+        else if (id == priv::makePropertyId("texturearrowup"))
         {
             m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
             setSize(m_size);
         }
-        else if (property == "texturearrowuphover")
+        else if (id == priv::makePropertyId("texturearrowuphover"))
         {
             m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
         }
-        else if (property == "texturearrowdown")
+        else if (id == priv::makePropertyId("texturearrowdown"))
         {
             m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
             setSize(m_size);
         }
-        else if (property == "texturearrowdownhover")
+        else if (id == priv::makePropertyId("texturearrowdownhover"))
         {
             m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
         }
-        else if (property == "trackcolor")
+        else if (id == priv::makePropertyId("trackcolor"))
         {
-            m_trackColorCached = getSharedRenderer()->getTrackColor();
+            m_trackColorCached = applyOpacity(getSharedRenderer()->getTrackColor());
         }
-        else if (property == "trackcolorhover")
+        else if (id == priv::makePropertyId("trackcolorhover"))
         {
-            m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
+            m_trackColorHoverCached = applyOpacity(getSharedRenderer()->getTrackColorHover());
         }
-        else if (property == "thumbcolor")
+        else if (id == priv::makePropertyId("thumbcolor"))
         {
-            m_thumbColorCached = getSharedRenderer()->getThumbColor();
+            m_thumbColorCached = applyOpacity(getSharedRenderer()->getThumbColor());
         }
-        else if (property == "thumbcolorhover")
+        else if (id == priv::makePropertyId("thumbcolorhover"))
         {
-            m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
+            m_thumbColorHoverCached = applyOpacity(getSharedRenderer()->getThumbColorHover());
         }
-        else if (property == "arrowbackgroundcolor")
+        else if (id == priv::makePropertyId("arrowbackgroundcolor"))
         {
-            m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
+            m_arrowBackgroundColorCached = applyOpacity(getSharedRenderer()->getArrowBackgroundColor());
         }
-        else if (property == "arrowbackgroundcolorhover")
+        else if (id == priv::makePropertyId("arrowbackgroundcolorhover"))
         {
-            m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
+            m_arrowBackgroundColorHoverCached = applyOpacity(getSharedRenderer()->getArrowBackgroundColorHover());
         }
-        else if (property == "arrowcolor")
+        else if (id == priv::makePropertyId("arrowcolor"))
         {
-            m_arrowColorCached = getSharedRenderer()->getArrowColor();
+            m_arrowColorCached = applyOpacity(getSharedRenderer()->getArrowColor());
         }
-        else if (property == "arrowcolorhover")
+        else if (id == priv::makePropertyId("arrowcolorhover"))
         {
-            m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
+            m_arrowColorHoverCached = applyOpacity(getSharedRenderer()->getArrowColorHover());
         }
-        else if (property == "opacity")
+        else if (id == priv::makePropertyId("opacity"))
         {
             Widget::rendererChanged(property);
 
+            // The cached colors have the opacity applied to them, so they are updated as well
+            for (const char* colorProperty : {"trackcolor", "trackcolorhover", "thumbcolor", "thumbcolorhover",
+                                              "arrowbackgroundcolor", "arrowbackgroundcolorhover", "arrowcolor",
+                                              "arrowcolorhover"})
+                rendererChanged(colorProperty);
+
             m_spriteTrack.setOpacity(m_opacityCached);
             m_spriteTrackHover.setOpacity(m_opacityCached);
             m_spriteThumb.setOpacity(m_opacityCached);
@@ -819,6 +828,7 @@ namespace tgui
             m_thumb.left = m_track.left + ((m_track.width - m_thumb.width) * m_value / (m_maximum - m_lowValue));
             m_thumb.top = 0;
         }
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -846,30 +856,32 @@ namespace tgui
         else
         {
             if (m_mouseHover && (m_mouseHoverOverPart == Scrollbar::Part::ArrowUp) && m_arrowBackgroundColorHoverCached.isSet())
-                drawRectangleShape(target, states, {m_arrowUp.width, m_arrowUp.height}, m_arrowBackgroundColorHoverCached);
+                drawFadedRectangleShape(target, states, {m_arrowUp.width, m_arrowUp.height}, m_arrowBackgroundColorHoverCached);
             else
-                drawRectangleShape(target, states, {m_arrowUp.width, m_arrowUp.height}, m_arrowBackgroundColorCached);
+                drawFadedRectangleShape(target, states, {m_arrowUp.width, m_arrowUp.height}, m_arrowBackgroundColorCached);
 
-            sf::ConvexShape arrow{3};
+            Color arrowColor;
             if (m_mouseHover && (m_mouseHoverOverPart == Scrollbar::Part::ArrowUp) && m_arrowColorHoverCached.isSet())
-                arrow.setFillColor(Color::calcColorOpacity(m_arrowColorHoverCached, m_opacityCached));
+                arrowColor = m_arrowColorHoverCached;
             else
-                arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
+                arrowColor = m_arrowColorCached;
+
+            sf::Vertex arrow[3];
 
             if (m_verticalScroll)
             {
-                arrow.setPoint(0, {m_arrowUp.width / 5, m_arrowUp.height * 4/5});
-                arrow.setPoint(1, {m_arrowUp.width / 2, m_arrowUp.height / 5});
-                arrow.setPoint(2, {m_arrowUp.width * 4/5, m_arrowUp.height * 4/5});
+                arrow[0] = {{m_arrowUp.width / 5, m_arrowUp.height * 4/5}, arrowColor};
+                arrow[1] = {{m_arrowUp.width / 2, m_arrowUp.height / 5}, arrowColor};
+                arrow[2] = {{m_arrowUp.width * 4/5, m_arrowUp.height * 4/5}, arrowColor};
             }
             else
             {
-                arrow.setPoint(0, {m_arrowUp.width * 4/5, m_arrowUp.height / 5});
-                arrow.setPoint(1, {m_arrowUp.width / 5, m_arrowUp.height / 2});
-                arrow.setPoint(2, {m_arrowUp.width * 4/5, m_arrowUp.height * 4/5});
+                arrow[0] = {{m_arrowUp.width * 4/5, m_arrowUp.height / 5}, arrowColor};
+                arrow[1] = {{m_arrowUp.width / 5, m_arrowUp.height / 2}, arrowColor};
+                arrow[2] = {{m_arrowUp.width * 4/5, m_arrowUp.height * 4/5}, arrowColor};
             }
 
-            target.draw(arrow, states);
+            priv::BatchRenderer::draw(target, arrow, 3, sf::PrimitiveType::Triangles, states);
         }
 
         // Draw the track
@@ -884,9 +896,9 @@ namespace tgui
         else
         {
             if (m_mouseHover && (m_mouseHoverOverPart == Scrollbar::Part::Track) && m_trackColorHoverCached.isSet())
-                drawRectangleShape(target, states, {m_track.width, m_track.height}, m_trackColorHoverCached);
+                drawFadedRectangleShape(target, states, {m_track.width, m_track.height}, m_trackColorHoverCached);
             else
-                drawRectangleShape(target, states, {m_track.width, m_track.height}, m_trackColorCached);
+                drawFadedRectangleShape(target, states, {m_track.width, m_track.height}, m_trackColorCached);
         }
         states.transform.translate({-m_track.left, -m_track.top});
 
@@ -902,9 +914,9 @@ namespace tgui
         else
         {
             if (m_mouseHover && (m_mouseHoverOverPart == Scrollbar::Part::Thumb) && m_thumbColorHoverCached.isSet())
-                drawRectangleShape(target, states, {m_thumb.width, m_thumb.height}, m_thumbColorHoverCached);
+                drawFadedRectangleShape(target, states, {m_thumb.width, m_thumb.height}, m_thumbColorHoverCached);
             else
-                drawRectangleShape(target, states, {m_thumb.width, m_thumb.height}, m_thumbColorCached);
+                drawFadedRectangleShape(target, states, {m_thumb.width, m_thumb.height}, m_thumbColorCached);
         }
         states.transform.translate({-m_thumb.left, -m_thumb.top});
 
@@ -920,30 +932,32 @@ namespace tgui
         else
         {
             if (m_mouseHover && (m_mouseHoverOverPart == Scrollbar::Part::ArrowDown) && m_arrowBackgroundColorHoverCached.isSet())
-                drawRectangleShape(target, states, {m_arrowDown.width, m_arrowDown.height}, m_arrowBackgroundColorHoverCached);
+                drawFadedRectangleShape(target, states, {m_arrowDown.width, m_arrowDown.height}, m_arrowBackgroundColorHoverCached);
             else
-                drawRectangleShape(target, states, {m_arrowDown.width, m_arrowDown.height}, m_arrowBackgroundColorCached);
+                drawFadedRectangleShape(target, states, {m_arrowDown.width, m_arrowDown.height}, m_arrowBackgroundColorCached);
 
-            sf::ConvexShape arrow{3};
+            Color arrowColor;
             if (m_mouseHover && (m_mouseHoverOverPart == Scrollbar::Part::ArrowDown) && m_arrowColorHoverCached.isSet())
-                arrow.setFillColor(Color::calcColorOpacity(m_arrowColorHoverCached, m_opacityCached));
+                arrowColor = m_arrowColorHoverCached;
             else
-                arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
+                arrowColor = m_arrowColorCached;
+
+            sf::Vertex arrow[3];
 
             if (m_verticalScroll)
             {
-                arrow.setPoint(0, {m_arrowDown.width / 5, m_arrowDown.height / 5});
-                arrow.setPoint(1, {m_arrowDown.width / 2, m_arrowDown.height * 4/5});
-                arrow.setPoint(2, {m_arrowDown.width * 4/5, m_arrowDown.height / 5});
+                arrow[0] = {{m_arrowDown.width / 5, m_arrowDown.height / 5}, arrowColor};
+                arrow[1] = {{m_arrowDown.width / 2, m_arrowDown.height * 4/5}, arrowColor};
+                arrow[2] = {{m_arrowDown.width * 4/5, m_arrowDown.height / 5}, arrowColor};
             }
             else // Spin button lies horizontal
             {
-                arrow.setPoint(0, {m_arrowDown.width / 5, m_arrowDown.height / 5});
-                arrow.setPoint(1, {m_arrowDown.width * 4/5, m_arrowDown.height / 2});
-                arrow.setPoint(2, {m_arrowDown.width / 5, m_arrowDown.height * 4/5});
+                arrow[0] = {{m_arrowDown.width / 5, m_arrowDown.height / 5}, arrowColor};
+                arrow[1] = {{m_arrowDown.width * 4/5, m_arrowDown.height / 2}, arrowColor};
+                arrow[2] = {{m_arrowDown.width / 5, m_arrowDown.height * 4/5}, arrowColor};
             }
 
-            target.draw(arrow, states);
+            priv::BatchRenderer::draw(target, arrow, 3, sf::PrimitiveType::Triangles, states);
         }
     }
 
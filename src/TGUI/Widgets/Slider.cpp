@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Slider.hpp>
+#include <TGUI/Container.hpp>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -168,6 +169,10 @@ namespace tgui
         }
 
         updateThumbPosition();
+
+        // The full size of the widget depends on the thumb, which wasn't recalculated yet when Widget::setSize told the parent
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -468,12 +473,14 @@ namespace tgui
 
     void Slider::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        const priv::PropertyId id = priv::makePropertyId(property);
+
+        if (id == priv::makePropertyId("borders"))
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == "texturetrack")
+        else if (id == priv::makePropertyId("texturetrack"))
         {
             m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
 
@@ -484,47 +491,52 @@ namespace tgui
 
             setSize(m_size);
         }
-        else if (property == "texturetrackhover")
+        else if (id == priv::makePropertyId("texturetrackhover"))
         {
             m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
         }
-        else if (property == "texturethumb")
+        else if (id == priv::makePropertyId("texturethumb"))
         {
             m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
             setSize(m_size);
         }
-        else if (property == "texturethumbhover")
+        else if (id == priv::makePropertyId("texturethumbhover"))
         {
             m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
         }
-        else if (property == "trackcolor")
+        else if (id == priv::makePropertyId("trackcolor"))
         {
-            m_trackColorCached = getSharedRenderer()->getTrackColor();
+            m_trackColorCached = applyOpacity(getSharedRenderer()->getTrackColor());
         }
-        else if (property == "trackcolorhover")
+        else if (id == priv::makePropertyId("trackcolorhover"))
         {
-            m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
+            m_trackColorHoverCached = applyOpacity(getSharedRenderer()->getTrackColorHover());
         }
-        else if (property == "thumbcolor")
+        else if (id == priv::makePropertyId("thumbcolor"))
         {
-            m_thumbColorCached = getSharedRenderer()->getThumbColor();
+            m_thumbColorCached = applyOpacity(getSharedRenderer()->getThumbColor());
         }
-        else if (property == "thumbcolorhover")
+        else if (id == priv::makePropertyId("thumbcolorhover"))
         {
-            m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
+            m_thumbColorHoverCached = applyOpacity(getSharedRenderer()->getThumbColorHover());
         }
-        else if (property == "bordercolor")
+        else if (id == priv::makePropertyId("bordercolor"))
         {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
+            m_borderColorCached = applyOpacity(getSharedRenderer()->getBorderColor());
         }
-        else if (property == "bordercolorhover")
+        else if (id == priv::makePropertyId("bordercolorhover"))
         {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+            m_borderColorHoverCached = applyOpacity(getSharedRenderer()->getBorderColorHover());
         }
-        else if (property == "opacity")
+        else if (id == priv::makePropertyId("opacity"))
         {
             Widget::rendererChanged(property);
 
+            // The cached colors have the opacity applied to them, so they are updated as well
+            for (const char* colorProperty : {"trackcolor", "trackcolorhover", "thumbcolor", "thumbcolorhover", "bordercolor",
+                                              "bordercolorhover"})
+                rendererChanged(colorProperty);
+
             m_spriteTrack.setOpacity(m_opacityCached);
             m_spriteTrackHover.setOpacity(m_opacityCached);
             m_spriteThumb.setOpacity(m_opacityCached);
@@ -593,6 +605,7 @@ namespace tgui
             if (m_invertedDirection)
                 m_thumb.left = getSize().x - m_thumb.left - m_thumb.width;
         }
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -605,9 +618,9 @@ namespace tgui
         if (m_bordersCached != Borders{0})
         {
             if (m_mouseHover && m_borderColorHoverCached.isSet())
-                drawBorders(target, states, m_bordersCached, getSize(), m_borderColorHoverCached);
+                drawFadedBorders(target, states, m_bordersCached, getSize(), m_borderColorHoverCached);
             else
-                drawBorders(target, states, m_bordersCached, getSize(), m_borderColorCached);
+                drawFadedBorders(target, states, m_bordersCached, getSize(), m_borderColorCached);
 
             states.transform.translate({m_bordersCached.getLeft(), m_bordersCached.getTop()});
         }
@@ -623,9 +636,9 @@ namespace tgui
         else // There are no textures
         {
             if (m_mouseHover && m_trackColorHoverCached.isSet())
-                drawRectangleShape(target, states, getInnerSize(), m_trackColorHoverCached);
+                drawFadedRectangleShape(target, states, getInnerSize(), m_trackColorHoverCached);
             else
-                drawRectangleShape(target, states, getInnerSize(), m_trackColorCached);
+                drawFadedRectangleShape(target, states, getInnerSize(), m_trackColorCached);
         }
 
         states.transform.translate({-m_bordersCached.getLeft() + m_thumb.left, -m_bordersCached.getTop() + m_thumb.top});
@@ -634,9 +647,9 @@ namespace tgui
         if ((m_bordersCached != Borders{0}) && !(m_spriteTrack.isSet() && m_spriteThumb.isSet()))
         {
             if (m_mouseHover && m_borderColorHoverCached.isSet())
-                drawBorders(target, states, m_bordersCached, {m_thumb.width, m_thumb.height}, m_borderColorHoverCached);
+                drawFadedBorders(target, states, m_bordersCached, {m_thumb.width, m_thumb.height}, m_borderColorHoverCached);
             else
-                drawBorders(target, states, m_bordersCached, {m_thumb.width, m_thumb.height}, m_borderColorCached);
+                drawFadedBorders(target, states, m_bordersCached, {m_thumb.width, m_thumb.height}, m_borderColorCached);
 
             states.transform.translate({m_bordersCached.getLeft(), m_bordersCached.getTop()});
         }
@@ -655,9 +668,9 @@ namespace tgui
                                              m_thumb.height - m_bordersCached.getTop() - m_bordersCached.getBottom()};
 
             if (m_mouseHover && m_thumbColorHoverCached.isSet())
-                drawRectangleShape(target, states, thumbInnerSize, m_thumbColorHoverCached);
+                drawFadedRectangleShape(target, states, thumbInnerSize, m_thumbColorHoverCached);
             else
-                drawRectangleShape(target, states, thumbInnerSize, m_thumbColorCached);
+                drawFadedRectangleShape(target, states, thumbInnerSize, m_thumbColorCached);
         }
     }
 
@@ -23,8 +23,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Widgets/SpinButton.hpp>
-#include <SFML/Graphics/ConvexShape.hpp>
-#include <SFML/Graphics/RectangleShape.hpp>
+#include <TGUI/BatchRenderer.hpp>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -315,56 +314,63 @@ namespace tgui
 
     void SpinButton::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        const priv::PropertyId id = priv::makePropertyId(property);
+
+        if (id == priv::makePropertyId("borders"))
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == "spacebetweenarrows")
+        else if (id == priv::makePropertyId("spacebetweenarrows"))
         {
             m_spaceBetweenArrowsCached = getSharedRenderer()->getSpaceBetweenArrows();
             setSize(m_size);
         }
-        else if (property == "texturearrowup")
+        else if (id == priv::makePropertyId("texturearrowup"))
         {
             m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
         }
-        else if (property == "texturearrowuphover")
+        else if (id == priv::makePropertyId("texturearrowuphover"))
         {
             m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
         }
-        else if (property == "texturearrowdown")
+        else if (id == priv::makePropertyId("texturearrowdown"))
         {
             m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
         }
-        else if (property == "texturearrowdownhover")
+        else if (id == priv::makePropertyId("texturearrowdownhover"))
         {
             m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
         }
-        else if (property == "bordercolor")
+        else if (id == priv::makePropertyId("bordercolor"))
         {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
+            m_borderColorCached = applyOpacity(getSharedRenderer()->getBorderColor());
         }
-        else if (property == "backgroundcolor")
+        else if (id == priv::makePropertyId("backgroundcolor"))
         {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+            m_backgroundColorCached = applyOpacity(getSharedRenderer()->getBackgroundColor());
         }
-        else if (property == "backgroundcolorhover")
+        else if (id == priv::makePropertyId("backgroundcolorhover"))
         {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+            m_backgroundColorHoverCached = applyOpacity(getSharedRenderer()->getBackgroundColorHover());
         }
-        else if (property == "arrowcolor")
+        else if (id == priv::makePropertyId("arrowcolor"))
         {
-            m_arrowColorCached = getSharedRenderer()->getArrowColor();
+            m_arrowColorCached = applyOpacity(getSharedRenderer()->getArrowColor());
         }
-        else if (property == "arrowcolorhover")
+        else if (id == priv::makePropertyId("arrowcolorhover"))
         {
-            m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
+            m_arrowColorHoverCached = applyOpacity(getSharedRenderer()->getArrowColorHover());
         }
-        else if (property == "opacity")
+        else if (id == priv::makePropertyId("opacity"))
         {
             Widget::rendererChanged(property);
 
+            // The cached colors have the opacity applied to them, so they are updated as well
+            for (const char* colorProperty : {"bordercolor", "backgroundcolor", "backgroundcolorhover", "arrowcolor",
+                                              "arrowcolorhover"})
+                rendererChanged(colorProperty);
+
             m_spriteArrowUp.setOpacity(m_opacityCached);
             m_spriteArrowUpHover.setOpacity(m_opacityCached);
             m_spriteArrowDown.setOpacity(m_opacityCached);
@@ -423,7 +429,7 @@ namespace tgui
         // Draw the borders
         if (m_bordersCached != Borders{0})
         {
-            drawBorders(target, states, m_bordersCached, getSize(), m_borderColorCached);
+            drawFadedBorders(target, states, m_bordersCached, getSize(), m_borderColorCached);
             states.transform.translate({m_bordersCached.getLeft(), m_bordersCached.getTop()});
         }
 
@@ -439,38 +445,40 @@ namespace tgui
         }
         else
         {
-            sf::ConvexShape arrow{3};
-            sf::RectangleShape arrowBack;
-
+            Vector2f arrowBackSize;
             if (m_verticalScroll)
-            {
-                arrowBack.setSize(arrowSize);
-
-                arrow.setPoint(0, {arrowBack.getSize().x / 5, arrowBack.getSize().y * 4/5});
-                arrow.setPoint(1, {arrowBack.getSize().x / 2, arrowBack.getSize().y / 5});
-                arrow.setPoint(2, {arrowBack.getSize().x * 4/5, arrowBack.getSize().y * 4/5});
-            }
+                arrowBackSize = arrowSize;
             else // Spin button lies horizontal
-            {
-                arrowBack.setSize({arrowSize.y, arrowSize.x});
-
-                arrow.setPoint(0, {arrowBack.getSize().x * 4/5, arrowBack.getSize().y / 5});
-                arrow.setPoint(1, {arrowBack.getSize().x / 5, arrowBack.getSize().y / 2});
-                arrow.setPoint(2, {arrowBack.getSize().x * 4/5, arrowBack.getSize().y * 4/5});
-            }
+                arrowBackSize = {arrowSize.y, arrowSize.x};
 
+            Color arrowBackColor;
             if (m_mouseHover && m_mouseHoverOnTopArrow && m_backgroundColorHoverCached.isSet())
-                arrowBack.setFillColor(Color::calcColorOpacity(m_backgroundColorHoverCached, m_opacityCached));
+                arrowBackColor = m_backgroundColorHoverCached;
             else
-                arrowBack.setFillColor(Color::calcColorOpacity(m_backgroundColorCached, m_opacityCached));
+                arrowBackColor = m_backgroundColorCached;
 
+            Color arrowColor;
             if (m_mouseHover && m_mouseHoverOnTopArrow && m_arrowColorHoverCached.isSet())
-                arrow.setFillColor(Color::calcColorOpacity(m_arrowColorHoverCached, m_opacityCached));
+                arrowColor = m_arrowColorHoverCached;
             else
-                arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
+                arrowColor = m_arrowColorCached;
+
+            sf::Vertex arrow[3];
+            if (m_verticalScroll)
+            {
+                arrow[0] = {{arrowBackSize.x / 5, arrowBackSize.y * 4/5}, arrowColor};
+                arrow[1] = {{arrowBackSize.x / 2, arrowBackSize.y / 5}, arrowColor};
+                arrow[2] = {{arrowBackSize.x * 4/5, arrowBackSize.y * 4/5}, arrowColor};
+            }
+            else // Spin button lies horizontal
+            {
+                arrow[0] = {{arrowBackSize.x * 4/5, arrowBackSize.y / 5}, arrowColor};
+                arrow[1] = {{arrowBackSize.x / 5, arrowBackSize.y / 2}, arrowColor};
+                arrow[2] = {{arrowBackSize.x * 4/5, arrowBackSize.y * 4/5}, arrowColor};
+            }
 
-            target.draw(arrowBack, states);
-            target.draw(arrow, states);
+            drawFadedRectangleShape(target, states, arrowBackSize, arrowBackColor);
+            priv::BatchRenderer::draw(target, arrow, 3, sf::PrimitiveType::Triangles, states);
         }
 
         // Draw the space between the arrows (if there is space)
@@ -480,7 +488,7 @@ namespace tgui
 
             if (m_spaceBetweenArrowsCached > 0)
             {
-                drawRectangleShape(target, states, {arrowSize.x, m_spaceBetweenArrowsCached}, m_borderColorCached);
+                drawFadedRectangleShape(target, states, {arrowSize.x, m_spaceBetweenArrowsCached}, m_borderColorCached);
                 states.transform.translate({0, m_spaceBetweenArrowsCached});
             }
         }
@@ -490,7 +498,7 @@ namespace tgui
 
             if (m_spaceBetweenArrowsCached > 0)
             {
-                drawRectangleShape(target, states, {m_spaceBetweenArrowsCached, arrowSize.x}, m_borderColorCached);
+                drawFadedRectangleShape(target, states, {m_spaceBetweenArrowsCached, arrowSize.x}, m_borderColorCached);
                 states.transform.translate({m_spaceBetweenArrowsCached, 0});
             }
         }
@@ -505,38 +513,40 @@ namespace tgui
         }
         else // There are no images
         {
-            sf::ConvexShape arrow{3};
-            sf::RectangleShape arrowBack;
-
+            Vector2f arrowBackSize;
             if (m_verticalScroll)
-            {
-                arrowBack.setSize(arrowSize);
-
-                arrow.setPoint(0, {arrowBack.getSize().x / 5, arrowBack.getSize().y / 5});
-                arrow.setPoint(1, {arrowBack.getSize().x / 2, arrowBack.getSize().y * 4/5});
-                arrow.setPoint(2, {arrowBack.getSize().x * 4/5, arrowBack.getSize().y / 5});
-            }
+                arrowBackSize = arrowSize;
             else // Spin button lies horizontal
-            {
-                arrowBack.setSize({arrowSize.y, arrowSize.x});
-
-                arrow.setPoint(0, {arrowBack.getSize().x / 5, arrowBack.getSize().y / 5});
-                arrow.setPoint(1, {arrowBack.getSize().x * 4/5, arrowBack.getSize().y / 2});
-                arrow.setPoint(2, {arrowBack.getSize().x / 5, arrowBack.getSize().y * 4/5});
-            }
+                arrowBackSize = {arrowSize.y, arrowSize.x};
 
+            Color arrowBackColor;
             if (m_mouseHover && !m_mouseHoverOnTopArrow && m_backgroundColorHoverCached.isSet())
-                arrowBack.setFillColor(Color::calcColorOpacity(m_backgroundColorHoverCached, m_opacityCached));
+                arrowBackColor = m_backgroundColorHoverCached;
             else
-                arrowBack.setFillColor(Color::calcColorOpacity(m_backgroundColorCached, m_opacityCached));
+                arrowBackColor = m_backgroundColorCached;
 
+            Color arrowColor;
             if (m_mouseHover && !m_mouseHoverOnTopArrow && m_arrowColorHoverCached.isSet())
-                arrow.setFillColor(Color::calcColorOpacity(m_arrowColorHoverCached, m_opacityCached));
+                arrowColor = m_arrowColorHoverCached;
             else
-                arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
+                arrowColor = m_arrowColorCached;
+
+            sf::Vertex arrow[3];
+            if (m_verticalScroll)
+            {
+                arrow[0] = {{arrowBackSize.x / 5, arrowBackSize.y / 5}, arrowColor};
+                arrow[1] = {{arrowBackSize.x / 2, arrowBackSize.y * 4/5}, arrowColor};
+                arrow[2] = {{arrowBackSize.x * 4/5, arrowBackSize.y / 5}, arrowColor};
+            }
+            else // Spin button lies horizontal
+            {
+                arrow[0] = {{arrowBackSize.x / 5, arrowBackSize.y / 5}, arrowColor};
+                arrow[1] = {{arrowBackSize.x * 4/5, arrowBackSize.y / 2}, arrowColor};
+                arrow[2] = {{arrowBackSize.x / 5, arrowBackSize.y * 4/5}, arrowColor};
+            }
 
-            target.draw(arrowBack, states);
-            target.draw(arrow, states);
+            drawFadedRectangleShape(target, states, arrowBackSize, arrowBackColor);
+            priv::BatchRenderer::draw(target, arrow, 3, sf::PrimitiveType::Triangles, states);
         }
     }
 
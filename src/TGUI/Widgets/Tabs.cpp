@@ -221,6 +221,7 @@ namespace tgui
 
         // Send the callback
         onTabSelect.emit(this, m_tabTexts[index].getString());
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -231,6 +232,7 @@ namespace tgui
             m_tabTexts[m_selectedTab].setColor(m_textColorCached);
 
         m_selectedTab = -1;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -267,6 +269,7 @@ namespace tgui
 
         // New hovered tab depends on several factors, we keep it simple and just remove the hover state
         m_hoveringTab = -1;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -475,6 +478,7 @@ namespace tgui
         }
 
         m_bordersCached.updateParentSize(getSize());
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -491,75 +495,82 @@ namespace tgui
 
     void Tabs::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        const priv::PropertyId id = priv::makePropertyId(property);
+
+        if (id == priv::makePropertyId("borders"))
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             recalculateTabsWidth();
         }
-        else if (property == "textcolor")
+        else if (id == priv::makePropertyId("textcolor"))
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
             updateTextColors();
         }
-        else if (property == "textcolorhover")
+        else if (id == priv::makePropertyId("textcolorhover"))
         {
             m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
             updateTextColors();
         }
-        else if (property == "selectedtextcolor")
+        else if (id == priv::makePropertyId("selectedtextcolor"))
         {
             m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
             updateTextColors();
         }
-        else if (property == "selectedtextcolorhover")
+        else if (id == priv::makePropertyId("selectedtextcolorhover"))
         {
             m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
             updateTextColors();
         }
-        else if (property == "texturetab")
+        else if (id == priv::makePropertyId("texturetab"))
         {
             m_spriteTab.setTexture(getSharedRenderer()->getTextureTab());
         }
-        else if (property == "textureselectedtab")
+        else if (id == priv::makePropertyId("textureselectedtab"))
         {
             m_spriteSelectedTab.setTexture(getSharedRenderer()->getTextureSelectedTab());
         }
-        else if (property == "distancetoside")
+        else if (id == priv::makePropertyId("distancetoside"))
         {
             m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
             recalculateTabsWidth();
         }
-        else if (property == "backgroundcolor")
+        else if (id == priv::makePropertyId("backgroundcolor"))
         {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+            m_backgroundColorCached = applyOpacity(getSharedRenderer()->getBackgroundColor());
         }
-        else if (property == "backgroundcolorhover")
+        else if (id == priv::makePropertyId("backgroundcolorhover"))
         {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+            m_backgroundColorHoverCached = applyOpacity(getSharedRenderer()->getBackgroundColorHover());
         }
-        else if (property == "selectedbackgroundcolor")
+        else if (id == priv::makePropertyId("selectedbackgroundcolor"))
         {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+            m_selectedBackgroundColorCached = applyOpacity(getSharedRenderer()->getSelectedBackgroundColor());
         }
-        else if (property == "selectedbackgroundcolorhover")
+        else if (id == priv::makePropertyId("selectedbackgroundcolorhover"))
         {
-            m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
+            m_selectedBackgroundColorHoverCached = applyOpacity(getSharedRenderer()->getSelectedBackgroundColorHover());
         }
-        else if (property == "bordercolor")
+        else if (id == priv::makePropertyId("bordercolor"))
         {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
+            m_borderColorCached = applyOpacity(getSharedRenderer()->getBorderColor());
         }
-        else if (property == "opacity")
+        else if (id == priv::makePropertyId("opacity"))
         {
             Widget::rendererChanged(property);
 
+            // The cached colors have the opacity applied to them, so they are updated as well
+            for (const char* colorProperty : {"backgroundcolor", "backgroundcolorhover", "selectedbackgroundcolor",
+                                              "selectedbackgroundcolorhover", "bordercolor"})
+                rendererChanged(colorProperty);
+
             m_spriteTab.setOpacity(m_opacityCached);
             m_spriteSelectedTab.setOpacity(m_opacityCached);
 
             for (auto& tabText : m_tabTexts)
                 tabText.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (id == priv::makePropertyId("font"))
         {
             Widget::rendererChanged(property);
 
@@ -667,7 +678,7 @@ namespace tgui
         // Draw the borders around the tabs
         if (m_bordersCached != Borders{0})
         {
-            drawBorders(target, states, m_bordersCached, getSize(), m_borderColorCached);
+            drawFadedBorders(target, states, m_bordersCached, getSize(), m_borderColorCached);
             states.transform.translate({m_bordersCached.getLeft(), m_bordersCached.getTop()});
         }
 
@@ -680,33 +691,25 @@ namespace tgui
             if (m_selectedTab == static_cast<int>(i))
             {
                 if (m_spriteSelectedTab.isSet())
-                {
-                    Sprite spriteSelectedTab = m_spriteSelectedTab;
-                    spriteSelectedTab.setSize({m_tabWidth[i], usableHeight});
-                    spriteSelectedTab.draw(target, states);
-                }
+                    m_spriteSelectedTab.draw(target, states, {m_tabWidth[i], usableHeight});
                 else // No texture was loaded
                 {
                     if ((m_hoveringTab == static_cast<int>(i)) && m_selectedBackgroundColorHoverCached.isSet())
-                        drawRectangleShape(target, states, {m_tabWidth[i], usableHeight}, m_selectedBackgroundColorHoverCached);
+                        drawFadedRectangleShape(target, states, {m_tabWidth[i], usableHeight}, m_selectedBackgroundColorHoverCached);
                     else
-                        drawRectangleShape(target, states, {m_tabWidth[i], usableHeight}, m_selectedBackgroundColorCached);
+                        drawFadedRectangleShape(target, states, {m_tabWidth[i], usableHeight}, m_selectedBackgroundColorCached);
                 }
             }
             else // This tab is not selected
             {
                 if (m_spriteTab.isSet())
-                {
-                    Sprite spriteTab = m_spriteTab;
-                    spriteTab.setSize({m_tabWidth[i], usableHeight});
-                    spriteTab.draw(target, states);
-                }
+                    m_spriteTab.draw(target, states, {m_tabWidth[i], usableHeight});
                 else // No texture was loaded
                 {
                     if ((m_hoveringTab == static_cast<int>(i)) && m_backgroundColorHoverCached.isSet())
-                        drawRectangleShape(target, states, {m_tabWidth[i], usableHeight}, m_backgroundColorHoverCached);
+                        drawFadedRectangleShape(target, states, {m_tabWidth[i], usableHeight}, m_backgroundColorHoverCached);
                     else
-                        drawRectangleShape(target, states, {m_tabWidth[i], usableHeight}, m_backgroundColorCached);
+                        drawFadedRectangleShape(target, states, {m_tabWidth[i], usableHeight}, m_backgroundColorCached);
                 }
             }
 
@@ -714,7 +717,7 @@ namespace tgui
             states.transform.translate({m_tabWidth[i], 0});
             if ((m_bordersCached != Borders{0}) && (i < m_tabWidth.size() - 1))
             {
-                drawRectangleShape(target, states, {(m_bordersCached.getLeft() + m_bordersCached.getRight()) / 2.f, usableHeight}, m_borderColorCached);
+                drawFadedRectangleShape(target, states, {(m_bordersCached.getLeft() + m_bordersCached.getRight()) / 2.f, usableHeight}, m_borderColorCached);
                 states.transform.translate({(m_bordersCached.getLeft() + m_bordersCached.getRight()) / 2.f, 0});
             }
 
@@ -27,24 +27,58 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Widgets/TextBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/GlyphCache.hpp>
 
+#include <algorithm>
+#include <iterator>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Replaces the elements in the range [first, last) by the given elements, without touching the elements outside the range
+        template <typename T>
+        void replaceRange(std::vector<T>& elements, std::size_t first, std::size_t last, std::vector<T>&& replacement)
+        {
+            const std::size_t overlap = std::min(last - first, replacement.size());
+            std::move(replacement.begin(), replacement.begin() + overlap, elements.begin() + first);
+
+            if (replacement.size() > overlap)
+                elements.insert(elements.begin() + first + overlap, std::make_move_iterator(replacement.begin() + overlap), std::make_move_iterator(replacement.end()));
+            else
+                elements.erase(elements.begin() + first + overlap, elements.begin() + last);
+        }
+
+        // Returns the horizontal position of a character in a line, as if the entire line were drawn as a single text
+        float findCharacterX(const sf::String& line, std::size_t index, priv::GlyphCache& glyphCache)
+        {
+            float x = 0;
+            std::uint32_t prevChar = 0;
+            const std::size_t end = std::min(index, line.getSize());
+            for (std::size_t i = 0; i < end; ++i)
+            {
+                x += glyphCache.getKerning(prevChar, line[i]) + glyphCache.getAdvance(line[i]);
+                prevChar = line[i];
+            }
+
+            if (index < line.getSize())
+                x += glyphCache.getKerning(prevChar, line[index]);
+
+            return x;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     TextBox::TextBox()
     {
         m_type = "TextBox";
         m_draggableWidget = true;
-        m_textBeforeSelection.setFont(m_fontCached);
-        m_textSelection1.setFont(m_fontCached);
-        m_textSelection2.setFont(m_fontCached);
-        m_textAfterSelection1.setFont(m_fontCached);
-        m_textAfterSelection2.setFont(m_fontCached);
 
         m_renderer = aurora::makeCopied<TextBoxRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -137,13 +171,23 @@ namespace tgui
             m_text = text;
 
         rearrangeText(false);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::addText(const sf::String& text)
     {
-        setText(m_text + text);
+        // Remove all the excess characters when a character limit is set
+        sf::String addedText = text;
+        if ((m_maxChars > 0) && (m_text.getSize() + text.getSize() > m_maxChars))
+            addedText = (m_text.getSize() < m_maxChars) ? text.substring(0, m_maxChars - m_text.getSize()) : "";
+
+        // Only the last paragraph and the new ones have to be word-wrapped
+        const std::size_t oldSize = m_text.getSize();
+        m_text += addedText;
+        rearrangeText(false, {oldSize, 0, addedText.getSize()});
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -173,12 +217,8 @@ namespace tgui
         if (m_textSize < 1)
             m_textSize = 1;
 
-        // Change the text size
-        m_textBeforeSelection.setCharacterSize(m_textSize);
-        m_textSelection1.setCharacterSize(m_textSize);
-        m_textSelection2.setCharacterSize(m_textSize);
-        m_textAfterSelection1.setCharacterSize(m_textSize);
-        m_textAfterSelection2.setCharacterSize(m_textSize);
+        // The texts of the visible lines are recreated with the new text size
+        m_visibleLineTexts.clear();
 
         // Calculate the height of one line
         m_lineHeight = static_cast<unsigned int>(m_fontCached.getLineSpacing(m_textSize));
@@ -307,6 +347,7 @@ namespace tgui
         {
             m_caretVisible = true;
             m_animationTimeElapsed = {};
+            scheduleUpdate(sf::milliseconds(500));
         }
         else // Unfocusing
         {
@@ -799,7 +840,7 @@ namespace tgui
                         m_selStart = m_selEnd;
 
                         m_text.erase(pos - 1, 1);
-                        rearrangeText(true);
+                        rearrangeText(true, {pos - 1, 1, 0});
                     }
                 }
                 else // When you did select some characters then delete them
@@ -821,8 +862,14 @@ namespace tgui
                 // Check that we did not select any characters
                 if (m_selStart == m_selEnd)
                 {
-                    m_text.erase(findTextSelectionPositions().second, 1);
-                    rearrangeText(true);
+                    const std::size_t pos = findTextSelectionPositions().second;
+                    if (pos < m_text.getSize())
+                    {
+                        m_text.erase(pos, 1);
+                        rearrangeText(true, {pos, 1, 0});
+                    }
+                    else
+                        rearrangeText(true);
                 }
                 else // You did select some characters, so remove them
                     deleteSelectedCharacters();
@@ -881,12 +928,13 @@ namespace tgui
                     {
                         deleteSelectedCharacters();
 
-                        m_text.insert(findTextSelectionPositions().first, clipboardContents);
+                        const std::size_t pos = findTextSelectionPositions().first;
+                        m_text.insert(pos, clipboardContents);
                         m_lines[m_selStart.y].insert(m_selStart.x, clipboardContents);
 
                         m_selStart.x += clipboardContents.getSize();
                         m_selEnd = m_selStart;
-                        rearrangeText(true);
+                        rearrangeText(true, {pos, 0, clipboardContents.getSize()});
 
                         onTextChange.emit(this, m_text);
                     }
@@ -931,7 +979,7 @@ namespace tgui
                 m_selEnd.x++;
             }
 
-            rearrangeText(true);
+            rearrangeText(true, {caretPosition, 0, 1});
         };
 
         // If there is a scrollbar then inserting can't go wrong
@@ -1050,8 +1098,19 @@ namespace tgui
         // This function is used to count the amount of characters spread over several lines
         auto findIndex = [this](std::size_t line)
         {
+            // Skip entire paragraphs when it is known in how many lines they were split
             std::size_t counter = 0;
-            for (std::size_t i = 0; i < line; ++i)
+            std::size_t i = 0;
+            for (const auto& paragraph : m_paragraphs)
+            {
+                if (i + paragraph.lineCount > line)
+                    break;
+
+                counter += paragraph.length + 1;
+                i += paragraph.lineCount;
+            }
+
+            for (; i < line; ++i)
             {
                 counter += m_lines[i].getSize();
                 if ((counter < m_text.getSize()) && (m_text[counter] == '\n'))
@@ -1072,28 +1131,39 @@ namespace tgui
         {
             auto textSelectionPositions = findTextSelectionPositions();
 
+            if (textSelectionPositions.first > textSelectionPositions.second)
+                std::swap(textSelectionPositions.first, textSelectionPositions.second);
+
             if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-            {
-                m_text.erase(textSelectionPositions.second, textSelectionPositions.first - textSelectionPositions.second);
                 m_selStart = m_selEnd;
-            }
             else
-            {
-                m_text.erase(textSelectionPositions.first, textSelectionPositions.second - textSelectionPositions.first);
                 m_selEnd = m_selStart;
-            }
 
-            rearrangeText(true);
+            const std::size_t removedCount = textSelectionPositions.second - textSelectionPositions.first;
+            m_text.erase(textSelectionPositions.first, removedCount);
+            rearrangeText(true, {textSelectionPositions.first, removedCount, 0});
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::rearrangeText(bool keepSelection)
+    {
+        // Forget how the text was split in lines, so that the entire text gets word-wrapped again
+        m_paragraphs.clear();
+        rearrangeText(keepSelection, {0, 0, 0});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::rearrangeText(bool keepSelection, const TextEdit& edit)
     {
         // Don't continue when line height is 0 or when there is no font yet
         if ((m_lineHeight == 0) || (m_fontCached == nullptr))
+        {
+            m_paragraphs.clear();
             return;
+        }
 
         // Find the maximum width of one line
         const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
@@ -1103,71 +1173,92 @@ namespace tgui
 
         // Don't do anything when there is no room for the text
         if (maxLineWidth <= 0)
+        {
+            m_paragraphs.clear();
             return;
+        }
 
-        // Store the current selection position when we are keeping the selection
-        std::pair<std::size_t, std::size_t> textSelectionPositions;
-        if (keepSelection)
-            textSelectionPositions = findTextSelectionPositions();
-
-        // Fit the text in the available space
-        const sf::String string = Text::wordWrap(maxLineWidth, m_text, m_fontCached, m_textSize, false, false);
+        const WrapRange range = findWrapRange(maxLineWidth, edit);
 
-        // Split the string in multiple lines
-        m_lines.clear();
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
-        while (newLinePos != sf::String::InvalidPos)
+        // Counts the characters between the start of the range and a position in one of the lines of the range
+        const auto findRangeOffset = [this,&range](sf::Vector2<std::size_t> position)
         {
-            newLinePos = string.find('\n', searchPosStart);
+            if ((position.y < range.firstLine) || (position.y >= range.lastLine))
+                return std::size_t{0};
 
-            if (newLinePos != sf::String::InvalidPos)
-                m_lines.push_back(string.substring(searchPosStart, newLinePos - searchPosStart));
-            else
-                m_lines.push_back(string.substring(searchPosStart));
+            std::size_t offset = 0;
+            std::size_t line = range.firstLine;
+            for (std::size_t paragraph = range.firstParagraph; paragraph < range.lastParagraph; ++paragraph)
+            {
+                for (std::size_t i = 0; i < m_paragraphs[paragraph].lineCount; ++i, ++line)
+                {
+                    if (line == position.y)
+                        return offset + position.x;
+
+                    offset += m_lines[line].getSize();
+                }
+
+                offset += 1;
+            }
+
+            return offset;
+        };
 
-            searchPosStart = newLinePos + 1;
+        // Store the selection as the amount of characters between the start of the word-wrapped range and the selection
+        // when it lies within that range. The selection outside the range only has to be moved to other lines.
+        std::pair<std::size_t, std::size_t> textSelectionPositions;
+        if (keepSelection)
+        {
+            if (range.entireText)
+            {
+                // Lines can't be skipped using the paragraphs, as they no longer match the text
+                m_paragraphs.clear();
+                textSelectionPositions = findTextSelectionPositions();
+            }
+            else
+                textSelectionPositions = {findRangeOffset(m_selStart), findRangeOffset(m_selEnd)};
         }
 
+        // Fit the text in the available space
+        const std::size_t oldLineCount = range.lastLine - range.firstLine;
+        const std::size_t newLineCount = wrapParagraphs(maxLineWidth, range);
+
         // Check if we should try to keep our selection
         if (keepSelection)
         {
-            std::size_t index = 0;
-            sf::Vector2<std::size_t> newSelStart;
-            sf::Vector2<std::size_t> newSelEnd;
-            bool newSelStartFound = false;
-            bool newSelEndFound = false;
-
-            // Look for the new locations of our selection
-            for (std::size_t i = 0; i < m_lines.size(); ++i)
+            // Finds the new location of a selection position, only the lines in the word-wrapped range have to be searched
+            bool selectionFound = true;
+            const auto findLinePosition = [&](sf::Vector2<std::size_t> oldPosition, std::size_t rangeOffset)
             {
-                index += m_lines[i].getSize();
-
-                if (!newSelStartFound && (index >= textSelectionPositions.first))
+                if (!range.entireText)
                 {
-                    newSelStart = sf::Vector2<std::size_t>(m_lines[i].getSize() - (index - textSelectionPositions.first), i);
-
-                    newSelStartFound = true;
-                    if (newSelEndFound)
-                        break;
+                    if (oldPosition.y < range.firstLine)
+                        return oldPosition;
+                    else if (oldPosition.y >= range.lastLine)
+                        return sf::Vector2<std::size_t>{oldPosition.x, oldPosition.y - oldLineCount + newLineCount};
                 }
 
-                if (!newSelEndFound && (index >= textSelectionPositions.second))
+                std::size_t index = 0;
+                for (std::size_t i = range.firstLine; i < range.firstLine + newLineCount; ++i)
                 {
-                    newSelEnd = sf::Vector2<std::size_t>(m_lines[i].getSize() - (index - textSelectionPositions.second), i);
+                    index += m_lines[i].getSize();
+                    if (index >= rangeOffset)
+                        return sf::Vector2<std::size_t>{m_lines[i].getSize() - (index - rangeOffset), i};
 
-                    newSelEndFound = true;
-                    if (newSelStartFound)
-                        break;
+                    // Skip newlines in the text
+                    if ((range.textStart + index < m_text.getSize()) && (m_text[range.textStart + index] == '\n'))
+                        ++index;
                 }
 
-                // Skip newlines in the text
-                if (m_text[index] == '\n')
-                    ++index;
-            }
+                selectionFound = false;
+                return oldPosition;
+            };
+
+            const auto newSelStart = findLinePosition(m_selStart, textSelectionPositions.first);
+            const auto newSelEnd = findLinePosition(m_selEnd, textSelectionPositions.second);
 
             // Keep the selection when possible
-            if (newSelStartFound && newSelEndFound)
+            if (selectionFound)
             {
                 m_selStart = newSelStart;
                 m_selEnd = newSelEnd;
@@ -1203,73 +1294,124 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextBox::updateSelectionTexts()
+    TextBox::WrapRange TextBox::findWrapRange(float maxLineWidth, const TextEdit& edit) const
     {
-        // If there is no selection then just put the whole text in m_textBeforeSelection
-        if (m_selStart == m_selEnd)
+        // Find which paragraphs and lines were affected by the edit, based on the paragraphs of the text before the edit
+        std::size_t firstParagraph = 0;
+        std::size_t lastParagraph = 0;
+        std::size_t firstLine = 0;
+        std::size_t lastLine = 0;
+        std::size_t textStart = 0;
+        std::size_t textEnd = m_text.getSize();
+        bool wrapEntireText = m_paragraphs.empty() || (maxLineWidth != m_paragraphsWrapWidth);
+        if (!wrapEntireText)
         {
-            sf::String displayedText;
-            for (std::size_t i = 0; i < m_lines.size(); ++i)
-                displayedText += m_lines[i] + "\n";
-
-            m_textBeforeSelection.setString(displayedText);
-            m_textSelection1.setString("");
-            m_textSelection2.setString("");
-            m_textAfterSelection1.setString("");
-            m_textAfterSelection2.setString("");
-        }
-        else // Some text is selected
-        {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
+            std::size_t paragraphStart = 0;
+            std::size_t paragraph = 0;
+            while ((paragraph < m_paragraphs.size()) && (edit.position > paragraphStart + m_paragraphs[paragraph].length))
+            {
+                paragraphStart += m_paragraphs[paragraph].length + 1;
+                firstLine += m_paragraphs[paragraph].lineCount;
+                ++paragraph;
+            }
 
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
+            firstParagraph = paragraph;
+            textStart = paragraphStart;
+            lastLine = firstLine;
 
-            // Set the text before the selection
-            if (selectionStart.y > 0)
+            // The edit may span multiple paragraphs when newlines were removed
+            const std::size_t editEnd = edit.position + edit.removedCount;
+            while (paragraph < m_paragraphs.size())
             {
-                sf::String string;
-                for (std::size_t i = 0; i < selectionStart.y; ++i)
-                    string += m_lines[i] + "\n";
+                const std::size_t paragraphEnd = paragraphStart + m_paragraphs[paragraph].length;
+                lastLine += m_paragraphs[paragraph].lineCount;
+                ++paragraph;
 
-                string += m_lines[selectionStart.y].substring(0, selectionStart.x);
-                m_textBeforeSelection.setString(string);
-            }
-            else
-                m_textBeforeSelection.setString(m_lines[0].substring(0, selectionStart.x));
+                if (editEnd <= paragraphEnd)
+                {
+                    textEnd = paragraphEnd + edit.insertedCount - edit.removedCount;
+                    break;
+                }
 
-            // Set the selected text
-            if (m_selStart.y == m_selEnd.y)
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, selectionEnd.x - selectionStart.x));
-                m_textSelection2.setString("");
+                paragraphStart = paragraphEnd + 1;
             }
-            else
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, m_lines[selectionStart.y].getSize() - selectionStart.x));
 
-                sf::String string;
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                    string += m_lines[i] + "\n";
+            lastParagraph = paragraph;
 
-                string += m_lines[selectionEnd.y].substring(0, selectionEnd.x);
+            // Fall back to wrapping everything if the edit doesn't match the text
+            if ((lastParagraph == firstParagraph) || (textEnd > m_text.getSize()) || (lastLine > m_lines.size())
+             || ((textEnd < m_text.getSize()) && (m_text[textEnd] != '\n')))
+                wrapEntireText = true;
+        }
 
-                m_textSelection2.setString(string);
-            }
+        if (wrapEntireText)
+            return {0, m_paragraphs.size(), 0, m_lines.size(), 0, m_text.getSize(), true};
+        else
+            return {firstParagraph, lastParagraph, firstLine, lastLine, textStart, textEnd, false};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            // Set the text after the selection
+    std::size_t TextBox::wrapParagraphs(float maxLineWidth, const WrapRange& range)
+    {
+        // Word-wrap the paragraphs in the affected part of the text
+        std::vector<sf::String> lines;
+        std::vector<Paragraph> paragraphs;
+        std::size_t paragraphStart = range.textStart;
+        while (true)
+        {
+            std::size_t paragraphEnd = paragraphStart;
+            while ((paragraphEnd < range.textEnd) && (m_text[paragraphEnd] != '\n'))
+                ++paragraphEnd;
+
+            const sf::String string = Text::wordWrap(maxLineWidth, m_text.substring(paragraphStart, paragraphEnd - paragraphStart),
+                                                     m_fontCached, m_textSize, false, false);
+
+            // Split the string in multiple lines
+            const std::size_t oldLineCount = lines.size();
+            std::size_t searchPosStart = 0;
+            std::size_t newLinePos = 0;
+            while (newLinePos != sf::String::InvalidPos)
             {
-                m_textAfterSelection1.setString(m_lines[selectionEnd.y].substring(selectionEnd.x, m_lines[selectionEnd.y].getSize() - selectionEnd.x));
+                newLinePos = string.find('\n', searchPosStart);
 
-                sf::String string;
-                for (std::size_t i = selectionEnd.y + 1; i < m_lines.size(); ++i)
-                    string += m_lines[i] + "\n";
+                if (newLinePos != sf::String::InvalidPos)
+                    lines.push_back(string.substring(searchPosStart, newLinePos - searchPosStart));
+                else
+                    lines.push_back(string.substring(searchPosStart));
 
-                m_textAfterSelection2.setString(string);
+                searchPosStart = newLinePos + 1;
             }
+
+            paragraphs.push_back({paragraphEnd - paragraphStart, lines.size() - oldLineCount});
+
+            if (paragraphEnd >= range.textEnd)
+                break;
+
+            paragraphStart = paragraphEnd + 1;
+        }
+
+        // Replace the old lines and paragraphs with the new ones
+        const std::size_t lineCount = lines.size();
+        if (range.entireText)
+        {
+            m_lines = std::move(lines);
+            m_paragraphs = std::move(paragraphs);
+        }
+        else
+        {
+            replaceRange(m_lines, range.firstLine, range.lastLine, std::move(lines));
+            replaceRange(m_paragraphs, range.firstParagraph, range.lastParagraph, std::move(paragraphs));
         }
 
+        m_paragraphsWrapWidth = maxLineWidth;
+        return lineCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::updateSelectionTexts()
+    {
         // Check if the caret is located above or below the view
         if (isVerticalScrollbarPresent())
         {
@@ -1307,10 +1449,15 @@ namespace tgui
 
             // Switch the value of the visible flag
             m_caretVisible = !m_caretVisible;
+            if (m_focused)
+                invalidate();
 
             // Too slow for double clicking
             m_possibleDoubleClick = false;
         }
+
+        if (m_focused || m_possibleDoubleClick)
+            scheduleUpdate(sf::milliseconds(500) - m_animationTimeElapsed);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1320,100 +1467,10 @@ namespace tgui
         if (!m_fontCached)
             return;
 
-        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
-        sf::Text tempText{"", *m_fontCached.getFont(), getTextSize()};
-
         // Position the caret
-        {
-            tempText.setString(m_lines[m_selEnd.y].substring(0, m_selEnd.x));
-
-            float kerning = 0;
-            if ((m_selEnd.x > 0) && (m_selEnd.x < m_lines[m_selEnd.y].getSize()))
-                kerning = m_fontCached.getKerning(m_lines[m_selEnd.y][m_selEnd.x-1], m_lines[m_selEnd.y][m_selEnd.x], m_textSize);
-
-            m_caretPosition = {textOffset + tempText.findCharacterPos(tempText.getString().getSize()).x + kerning, static_cast<float>(m_selEnd.y * m_lineHeight)};
-        }
-
-        // Calculate the position of the text objects
-        m_selectionRects.clear();
-        m_textBeforeSelection.setPosition({textOffset, 0});
-        if (m_selStart != m_selEnd)
-        {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
-
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
-
-            float kerningSelectionStart = 0;
-            if ((selectionStart.x > 0) && (selectionStart.x < m_lines[selectionStart.y].getSize()))
-                kerningSelectionStart = m_fontCached.getKerning(m_lines[selectionStart.y][selectionStart.x-1], m_lines[selectionStart.y][selectionStart.x], m_textSize);
-
-            float kerningSelectionEnd = 0;
-            if ((selectionEnd.x > 0) && (selectionEnd.x < m_lines[selectionEnd.y].getSize()))
-                kerningSelectionEnd = m_fontCached.getKerning(m_lines[selectionEnd.y][selectionEnd.x-1], m_lines[selectionEnd.y][selectionEnd.x], m_textSize);
-
-            if (selectionStart.x > 0)
-            {
-                m_textSelection1.setPosition({textOffset + m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().getSize()).x + kerningSelectionStart,
-                                              m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
-            }
-            else
-                m_textSelection1.setPosition({textOffset, m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
-
-            m_textSelection2.setPosition({textOffset, static_cast<float>((selectionStart.y + 1) * m_lineHeight)});
-
-            if (!m_textSelection2.getString().isEmpty() || (selectionEnd.x == 0))
-            {
-                m_textAfterSelection1.setPosition({textOffset + m_textSelection2.findCharacterPos(m_textSelection2.getString().getSize()).x + kerningSelectionEnd,
-                                                   m_textSelection2.getPosition().y + ((selectionEnd.y - selectionStart.y - 1) * m_lineHeight)});
-            }
-            else
-                m_textAfterSelection1.setPosition({m_textSelection1.getPosition().x + m_textSelection1.findCharacterPos(m_textSelection1.getString().getSize()).x + kerningSelectionEnd,
-                                                   m_textSelection1.getPosition().y});
-
-            m_textAfterSelection2.setPosition({textOffset, static_cast<float>((selectionEnd.y + 1) * m_lineHeight)});
-
-            // Recalculate the selection rectangles
-            {
-                m_selectionRects.push_back({m_textSelection1.getPosition().x, static_cast<float>(selectionStart.y * m_lineHeight), 0, static_cast<float>(m_lineHeight)});
-
-                if (!m_lines[selectionStart.y].isEmpty())
-                {
-                    m_selectionRects.back().width = m_textSelection1.findCharacterPos(m_textSelection1.getString().getSize()).x;
-
-                    // There is kerning when the selection is on just this line
-                    if (selectionStart.y == selectionEnd.y)
-                        m_selectionRects.back().width += kerningSelectionEnd;
-                }
-
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                {
-                    m_selectionRects.back().width += textOffset;
-                    m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(i * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
-
-                    if (!m_lines[i].isEmpty())
-                    {
-                        tempText.setString(m_lines[i]);
-                        m_selectionRects.back().width += tempText.findCharacterPos(tempText.getString().getSize()).x;
-                    }
-                }
-
-                if (selectionStart.y != selectionEnd.y)
-                {
-                    m_selectionRects.back().width += textOffset;
-
-                    if (m_textSelection2.getString() != "")
-                    {
-                        tempText.setString(m_lines[selectionEnd.y].substring(0, selectionEnd.x));
-                        m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(selectionEnd.y * m_lineHeight),
-                                                    textOffset + tempText.findCharacterPos(tempText.getString().getSize()).x + kerningSelectionEnd, static_cast<float>(m_lineHeight)});
-                    }
-                    else
-                        m_selectionRects.push_back({0, static_cast<float>(selectionEnd.y * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
-                }
-            }
-        }
+        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
+        priv::GlyphCache& glyphCache = priv::GlyphCache::get(m_fontCached.getFont(), m_textSize, false);
+        m_caretPosition = {textOffset + findCharacterX(m_lines[m_selEnd.y], m_selEnd.x, glyphCache), static_cast<float>(m_selEnd.y * m_lineHeight)};
 
         recalculateVisibleLines();
     }
@@ -1440,6 +1497,79 @@ namespace tgui
             m_topLine = 0;
             m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()) / m_lineHeight), m_lines.size());
         }
+
+        updateVisibleLineTexts();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::updateVisibleLineTexts()
+    {
+        // The visible lines, the selection or the caret may have changed
+        invalidate();
+
+        m_selectionRects.clear();
+        if (!m_fontCached || (m_lineHeight == 0))
+        {
+            m_visibleLineTexts.clear();
+            return;
+        }
+
+        auto selectionStart = m_selStart;
+        auto selectionEnd = m_selEnd;
+        if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
+            std::swap(selectionStart, selectionEnd);
+
+        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
+        priv::GlyphCache& glyphCache = priv::GlyphCache::get(m_fontCached.getFont(), m_textSize, false);
+
+        // Adds a text for part of a line, the existing text objects are reused
+        std::size_t textCount = 0;
+        const auto addText = [&](std::size_t line, std::size_t first, std::size_t last, bool selected)
+        {
+            if (first >= last)
+                return;
+
+            if (textCount == m_visibleLineTexts.size())
+            {
+                m_visibleLineTexts.emplace_back();
+                m_visibleLineTexts.back().setFont(m_fontCached);
+                m_visibleLineTexts.back().setCharacterSize(m_textSize);
+                m_visibleLineTexts.back().setOpacity(m_opacityCached);
+            }
+
+            Text& text = m_visibleLineTexts[textCount++];
+            text.setColor(selected ? m_selectedTextColorCached : m_textColorCached);
+            text.setString(m_lines[line].substring(first, last - first));
+            text.setPosition({textOffset + findCharacterX(m_lines[line], first, glyphCache), static_cast<float>(line * m_lineHeight)});
+        };
+
+        // The lines next to the visible ones are included as well, because their glyphs may reach into the visible area
+        const std::size_t firstLine = (m_topLine > 0) ? m_topLine - 1 : 0;
+        const std::size_t lastLine = std::min(m_topLine + m_visibleLines + 1, m_lines.size());
+        for (std::size_t line = firstLine; line < lastLine; ++line)
+        {
+            const std::size_t lineLength = m_lines[line].getSize();
+            if ((m_selStart == m_selEnd) || (line < selectionStart.y) || (line > selectionEnd.y))
+            {
+                addText(line, 0, lineLength, false);
+                continue;
+            }
+
+            const std::size_t selectionFirst = (line == selectionStart.y) ? selectionStart.x : 0;
+            const std::size_t selectionLast = (line == selectionEnd.y) ? selectionEnd.x : lineLength;
+            addText(line, 0, selectionFirst, false);
+            addText(line, selectionFirst, selectionLast, true);
+            addText(line, selectionLast, lineLength, false);
+
+            // The selection background continues past the end of the line when the next line is also selected
+            const float left = (line == selectionStart.y) ? textOffset + findCharacterX(m_lines[line], selectionFirst, glyphCache) : 0;
+            const float right = (line == selectionEnd.y) ? textOffset + findCharacterX(m_lines[line], selectionLast, glyphCache)
+                                                          : textOffset + findCharacterX(m_lines[line], lineLength, glyphCache) + textOffset;
+            m_selectionRects.push_back({left, static_cast<float>(line * m_lineHeight), right - left, static_cast<float>(m_lineHeight)});
+        }
+
+        m_visibleLineTexts.erase(m_visibleLineTexts.begin() + textCount, m_visibleLineTexts.end());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1456,76 +1586,72 @@ namespace tgui
 
     void TextBox::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        const priv::PropertyId id = priv::makePropertyId(property);
+
+        if (id == priv::makePropertyId("borders"))
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == "padding")
+        else if (id == priv::makePropertyId("padding"))
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             setSize(m_size);
         }
-        else if (property == "textcolor")
+        else if (id == priv::makePropertyId("textcolor"))
         {
-            m_textBeforeSelection.setColor(getSharedRenderer()->getTextColor());
-            m_textAfterSelection1.setColor(getSharedRenderer()->getTextColor());
-            m_textAfterSelection2.setColor(getSharedRenderer()->getTextColor());
+            m_textColorCached = getSharedRenderer()->getTextColor();
+            updateVisibleLineTexts();
         }
-        else if (property == "selectedtextcolor")
+        else if (id == priv::makePropertyId("selectedtextcolor"))
         {
-            m_textSelection1.setColor(getSharedRenderer()->getSelectedTextColor());
-            m_textSelection2.setColor(getSharedRenderer()->getSelectedTextColor());
+            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+            updateVisibleLineTexts();
         }
-        else if (property == "texturebackground")
+        else if (id == priv::makePropertyId("texturebackground"))
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == "scrollbar")
+        else if (id == priv::makePropertyId("scrollbar"))
         {
             m_verticalScroll->setRenderer(getSharedRenderer()->getScrollbar());
         }
-        else if (property == "backgroundcolor")
+        else if (id == priv::makePropertyId("backgroundcolor"))
         {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+            m_backgroundColorCached = applyOpacity(getSharedRenderer()->getBackgroundColor());
         }
-        else if (property == "selectedtextbackgroundcolor")
+        else if (id == priv::makePropertyId("selectedtextbackgroundcolor"))
         {
-            m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
+            m_selectedTextBackgroundColorCached = applyOpacity(getSharedRenderer()->getSelectedTextBackgroundColor());
         }
-        else if (property == "bordercolor")
+        else if (id == priv::makePropertyId("bordercolor"))
         {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
+            m_borderColorCached = applyOpacity(getSharedRenderer()->getBorderColor());
         }
-        else if (property == "caretcolor")
+        else if (id == priv::makePropertyId("caretcolor"))
         {
-            m_caretColorCached = getSharedRenderer()->getCaretColor();
+            m_caretColorCached = applyOpacity(getSharedRenderer()->getCaretColor());
         }
-        else if (property == "caretwidth")
+        else if (id == priv::makePropertyId("caretwidth"))
         {
             m_caretWidthCached = getSharedRenderer()->getCaretWidth();
         }
-        else if (property == "opacity")
+        else if (id == priv::makePropertyId("opacity"))
         {
             Widget::rendererChanged(property);
 
+            // The cached colors have the opacity applied to them, so they are updated as well
+            for (const char* colorProperty : {"backgroundcolor", "selectedtextbackgroundcolor", "bordercolor", "caretcolor"})
+                rendererChanged(colorProperty);
+
             m_verticalScroll->setInheritedOpacity(m_opacityCached);
             m_spriteBackground.setOpacity(m_opacityCached);
-            m_textBeforeSelection.setOpacity(m_opacityCached);
-            m_textAfterSelection1.setOpacity(m_opacityCached);
-            m_textAfterSelection2.setOpacity(m_opacityCached);
-            m_textSelection1.setOpacity(m_opacityCached);
-            m_textSelection2.setOpacity(m_opacityCached);
+            for (auto& text : m_visibleLineTexts)
+                text.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (id == priv::makePropertyId("font"))
         {
             Widget::rendererChanged(property);
-
-            m_textBeforeSelection.setFont(m_fontCached);
-            m_textSelection1.setFont(m_fontCached);
-            m_textSelection2.setFont(m_fontCached);
-            m_textAfterSelection1.setFont(m_fontCached);
-            m_textAfterSelection2.setFont(m_fontCached);
             setTextSize(getTextSize());
         }
         else
@@ -1579,7 +1705,7 @@ namespace tgui
         // Draw the borders
         if (m_bordersCached != Borders{0})
         {
-            drawBorders(target, states, m_bordersCached, getSize(), m_borderColorCached);
+            drawFadedBorders(target, states, m_bordersCached, getSize(), m_borderColorCached);
             states.transform.translate({m_bordersCached.getLeft(), m_bordersCached.getTop()});
         }
 
@@ -1587,7 +1713,7 @@ namespace tgui
         if (m_spriteBackground.isSet())
             m_spriteBackground.draw(target, states);
         else
-            drawRectangleShape(target, states, getInnerSize(), m_backgroundColorCached);
+            drawFadedRectangleShape(target, states, getInnerSize(), m_backgroundColorCached);
 
         // Draw the contents of the text box
         {
@@ -1607,26 +1733,20 @@ namespace tgui
             for (const auto& selectionRect : m_selectionRects)
             {
                 states.transform.translate({selectionRect.left, selectionRect.top});
-                drawRectangleShape(target, states, {selectionRect.width, selectionRect.height + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize)}, m_selectedTextBackgroundColorCached);
+                drawFadedRectangleShape(target, states, {selectionRect.width, selectionRect.height + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize)}, m_selectedTextBackgroundColorCached);
                 states.transform.translate({-selectionRect.left, -selectionRect.top});
             }
 
             // Draw the text
-            m_textBeforeSelection.draw(target, states);
-            if (m_selStart != m_selEnd)
-            {
-                m_textSelection1.draw(target, states);
-                m_textSelection2.draw(target, states);
-                m_textAfterSelection1.draw(target, states);
-                m_textAfterSelection2.draw(target, states);
-            }
+            for (const auto& text : m_visibleLineTexts)
+                text.draw(target, states);
 
             // Only draw the caret when needed
             if (m_focused && m_caretVisible && (m_caretWidthCached > 0))
             {
                 const float caretHeight = m_lineHeight + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize);
                 states.transform.translate({std::ceil(m_caretPosition.x - (m_caretWidthCached / 2.f)), m_caretPosition.y});
-                drawRectangleShape(target, states, {m_caretWidthCached, caretHeight}, m_caretColorCached);
+                drawFadedRectangleShape(target, states, {m_caretWidthCached, caretHeight}, m_caretColorCached);
             }
         }
 
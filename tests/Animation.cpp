@@ -74,10 +74,13 @@ TEST_CASE("[Animation]") {
         SECTION("showWithEffect") {
             SECTION("Fade") {
                 widget->showWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(300));
-                REQUIRE(widget->getInheritedOpacity() == 0);
+                REQUIRE(widget->getAnimatedOpacity() == 0);
                 widget->update(sf::milliseconds(100));
-                REQUIRE(tgui::compareFloats(widget->getInheritedOpacity(), 0.3f));
+                REQUIRE(tgui::compareFloats(widget->getAnimatedOpacity(), 1/3.f));
                 widget->update(sf::milliseconds(200));
+                REQUIRE(widget->getAnimatedOpacity() == 1);
+
+                // The fade is applied while drawing, the inherited opacity remains untouched
                 REQUIRE(widget->getInheritedOpacity() == 0.9f);
             }
 
@@ -139,9 +142,15 @@ TEST_CASE("[Animation]") {
         SECTION("hideWithEffect") {
             SECTION("Fade") {
                 widget->hideWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(300));
-                REQUIRE(widget->getInheritedOpacity() == 0.9f);
+                REQUIRE(widget->getAnimatedOpacity() == 1);
                 widget->update(sf::milliseconds(100));
-                REQUIRE(tgui::compareFloats(widget->getInheritedOpacity(), 0.6f));
+                REQUIRE(tgui::compareFloats(widget->getAnimatedOpacity(), 2/3.f));
+                REQUIRE(widget->getInheritedOpacity() == 0.9f);
+
+                // The opacity is restored when the widget gets hidden
+                widget->update(sf::milliseconds(200));
+                REQUIRE(!widget->isVisible());
+                REQUIRE(widget->getAnimatedOpacity() == 1);
             }
 
             SECTION("Scale") {
@@ -0,0 +1,240 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/Scrollbar.hpp>
+#include <TGUI/Widgets/Picture.hpp>
+#include <TGUI/Animation.hpp>
+
+namespace
+{
+    sf::Image drawGui(tgui::Gui& gui, sf::RenderTexture& target, bool batchingEnabled, std::size_t& drawCalls)
+    {
+        gui.setDrawBatchingEnabled(batchingEnabled);
+        target.clear({25, 130, 10});
+        gui.draw();
+        target.display();
+
+        drawCalls = gui.getDrawCallCount();
+        return target.getTexture().copyToImage();
+    }
+
+    bool imagesEqual(const sf::Image& left, const sf::Image& right)
+    {
+        if (left.getSize() != right.getSize())
+            return false;
+
+        const std::size_t byteCount = left.getSize().x * left.getSize().y * 4;
+        return std::equal(left.getPixelsPtr(), left.getPixelsPtr() + byteCount, right.getPixelsPtr());
+    }
+}
+
+TEST_CASE("[BatchRenderer]")
+{
+    sf::RenderTexture target;
+    target.create(400, 300);
+    tgui::Gui gui{target};
+
+    std::size_t drawCallsWithoutBatching;
+    std::size_t drawCallsWithBatching;
+
+    REQUIRE(gui.isDrawBatchingEnabled());
+
+    SECTION("Buttons without text")
+    {
+        for (unsigned int i = 0; i < 300; ++i)
+        {
+            auto button = tgui::Button::create();
+            button->setSize({18, 18});
+            button->setPosition({(i % 20) * 20.f, (i / 20) * 20.f});
+            gui.add(button);
+        }
+
+        const sf::Image imageWithoutBatching = drawGui(gui, target, false, drawCallsWithoutBatching);
+        const sf::Image imageWithBatching = drawGui(gui, target, true, drawCallsWithBatching);
+
+        // Each button draws its borders and background
+        REQUIRE(drawCallsWithoutBatching == 600);
+        REQUIRE(drawCallsWithBatching == 1);
+        REQUIRE(imagesEqual(imageWithoutBatching, imageWithBatching));
+    }
+
+    SECTION("Buttons with text")
+    {
+        for (unsigned int i = 0; i < 300; ++i)
+        {
+            auto button = tgui::Button::create("X");
+            button->setSize({18, 18});
+            button->setPosition({(i % 20) * 20.f, (i / 20) * 20.f});
+            gui.add(button);
+        }
+
+        const sf::Image imageWithoutBatching = drawGui(gui, target, false, drawCallsWithoutBatching);
+        const sf::Image imageWithBatching = drawGui(gui, target, true, drawCallsWithBatching);
+
+        // The texts share the texture of the font, so they are batched together just like the backgrounds. The bounds of
+        // a batch cover all rows that were added to it, so every row of buttons starts at most 2 new batches.
+        REQUIRE(drawCallsWithoutBatching == 900);
+        REQUIRE(drawCallsWithBatching <= 30);
+        REQUIRE(imagesEqual(imageWithoutBatching, imageWithBatching));
+    }
+
+    SECTION("Overlapping widgets")
+    {
+        auto button1 = tgui::Button::create();
+        button1->setSize({100, 50});
+        gui.add(button1);
+
+        auto picture = tgui::Picture::create("resources/image.png");
+        picture->setPosition({120, 0});
+        picture->setSize({60, 60});
+        gui.add(picture);
+
+        auto button2 = tgui::Button::copy(button1);
+        button2->setPosition({0, 100});
+        gui.add(button2);
+
+        SECTION("Second button can be merged with the first one")
+        {
+            const sf::Image imageWithoutBatching = drawGui(gui, target, false, drawCallsWithoutBatching);
+            const sf::Image imageWithBatching = drawGui(gui, target, true, drawCallsWithBatching);
+
+            REQUIRE(drawCallsWithoutBatching == 5);
+            REQUIRE(drawCallsWithBatching == 2);
+            REQUIRE(imagesEqual(imageWithoutBatching, imageWithBatching));
+        }
+
+        SECTION("Second button lies on top of the picture")
+        {
+            button2->setPosition({150, 30});
+
+            const sf::Image imageWithoutBatching = drawGui(gui, target, false, drawCallsWithoutBatching);
+            const sf::Image imageWithBatching = drawGui(gui, target, true, drawCallsWithBatching);
+
+            REQUIRE(drawCallsWithoutBatching == 5);
+            REQUIRE(drawCallsWithBatching == 3);
+            REQUIRE(imagesEqual(imageWithoutBatching, imageWithBatching));
+        }
+    }
+
+    SECTION("Clipping")
+    {
+        for (unsigned int i = 0; i < 4; ++i)
+        {
+            auto panel = tgui::Panel::create({90, 90});
+            panel->setPosition({i * 100.f, 0});
+            gui.add(panel);
+
+            auto clippedButton = tgui::Button::create();
+            clippedButton->setPosition({-20, -20});
+            clippedButton->setSize({200, 200});
+            panel->add(clippedButton);
+
+            auto scrollbar = tgui::Scrollbar::create();
+            scrollbar->setPosition({70, 50});
+            scrollbar->setSize({16, 80});
+            panel->add(scrollbar);
+        }
+
+        const sf::Image imageWithoutBatching = drawGui(gui, target, false, drawCallsWithoutBatching);
+        const sf::Image imageWithBatching = drawGui(gui, target, true, drawCallsWithBatching);
+
+        // Every panel has its own clipping area, which requires a separate draw call for the widgets inside it
+        REQUIRE(drawCallsWithoutBatching == 4 * 9);
+        REQUIRE(drawCallsWithBatching == 4 * 2);
+        REQUIRE(imagesEqual(imageWithoutBatching, imageWithBatching));
+    }
+
+    SECTION("Opacity")
+    {
+        REQUIRE(tgui::priv::BatchRenderer::getDrawOpacity() == 1);
+        {
+            tgui::priv::BatchRenderer::OpacityScope outerScope{0.5f};
+            REQUIRE(tgui::priv::BatchRenderer::getDrawOpacity() == 0.5f);
+            {
+                tgui::priv::BatchRenderer::OpacityScope innerScope{0.5f};
+                REQUIRE(tgui::priv::BatchRenderer::getDrawOpacity() == 0.25f);
+            }
+            REQUIRE(tgui::priv::BatchRenderer::getDrawOpacity() == 0.5f);
+        }
+        REQUIRE(tgui::priv::BatchRenderer::getDrawOpacity() == 1);
+    }
+
+    SECTION("Fading panel")
+    {
+        auto panel = tgui::Panel::create({200, 200});
+        gui.add(panel);
+
+        auto button = tgui::Button::create("X");
+        button->setSize({100, 50});
+        panel->add(button);
+
+        const sf::Image imageBeforeFade = drawGui(gui, target, true, drawCallsWithBatching);
+
+        panel->showWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(300));
+        gui.updateTime(sf::milliseconds(150));
+
+        // The opacity of the children isn't changed, it is only applied while drawing
+        REQUIRE(button->getInheritedOpacity() == 1);
+
+        const sf::Image imageWithoutBatching = drawGui(gui, target, false, drawCallsWithoutBatching);
+        const sf::Image imageWithBatching = drawGui(gui, target, true, drawCallsWithBatching);
+        REQUIRE(imagesEqual(imageWithoutBatching, imageWithBatching));
+        REQUIRE(!imagesEqual(imageBeforeFade, imageWithBatching));
+
+        gui.updateTime(sf::milliseconds(150));
+        const sf::Image imageAfterFade = drawGui(gui, target, true, drawCallsWithBatching);
+        REQUIRE(imagesEqual(imageBeforeFade, imageAfterFade));
+    }
+}
+
+TEST_CASE("[BatchRenderer] benchmark", "[.benchmark]")
+{
+    sf::RenderTexture target;
+    target.create(800, 600);
+    tgui::Gui gui{target};
+
+    for (unsigned int i = 0; i < 300; ++i)
+    {
+        auto button = tgui::Button::create("Button");
+        button->setSize({38, 28});
+        button->setPosition({(i % 20) * 40.f, (i / 20) * 30.f});
+        gui.add(button);
+    }
+
+    gui.setDrawBatchingEnabled(false);
+    BENCHMARK("Drawing 300 buttons without batching")
+    {
+        gui.draw();
+    }
+
+    gui.setDrawBatchingEnabled(true);
+    BENCHMARK("Drawing 300 buttons with batching")
+    {
+        gui.draw();
+    }
+}
@@ -130,6 +130,60 @@ TEST_CASE("[Container]")
             child1->remove(child4);
             REQUIRE(container->get("name") == nullptr);
         }
+
+        SECTION("path")
+        {
+            REQUIRE(container->get("w2.w4") == widget4);
+            REQUIRE(container->get<tgui::Label>("w2.w5") == widget5);
+            REQUIRE(container->get("w1.w4") == nullptr); // w1 is not a container
+            REQUIRE(container->get("w3.w4") == nullptr); // w4 is not inside w3
+            REQUIRE(container->get("w2.") == nullptr);
+
+            auto form = tgui::Panel::create();
+            auto user = tgui::EditBox::create();
+            form->add(user, "user");
+            widget2->add(form, "form");
+            REQUIRE(container->get("form.user") == user);
+            REQUIRE(container->get("w2.form.user") == user);
+            REQUIRE(widget2->get("form.user") == user);
+
+            // A name containing a dot is still found directly
+            container->add(tgui::Label::create(), "form.user");
+            REQUIRE(container->get("form.user") != user);
+        }
+
+        SECTION("widgets outside the gui")
+        {
+            // Widgets are only stored in the name index while they are part of the gui
+            auto panel = tgui::Panel::create();
+            auto child = tgui::Label::create();
+            panel->add(child, "child");
+            REQUIRE(panel->get("child") == child);
+            REQUIRE(container->get("child") == nullptr);
+
+            container->add(panel, "panel");
+            REQUIRE(container->get("child") == child);
+            REQUIRE(container->get("panel.child") == child);
+
+            container->remove(panel);
+            REQUIRE(container->get("child") == nullptr);
+            REQUIRE(panel->get("child") == child);
+
+            // A container inside the gui only finds its own widgets
+            REQUIRE(widget2->get("w1") == nullptr);
+            REQUIRE(widget2->get("w4") == widget4);
+        }
+
+        SECTION("renamed widgets")
+        {
+            REQUIRE(widget2->setWidgetName(widget4, "renamed"));
+            REQUIRE(container->get("w4") == nullptr);
+            REQUIRE(container->get("renamed") == widget4);
+
+            container->removeAllWidgets();
+            REQUIRE(container->get("renamed") == nullptr);
+            REQUIRE(widget2->get("renamed") == widget4);
+        }
     }
 
     SECTION("remove")
@@ -265,6 +319,181 @@ TEST_CASE("[Container]")
         REQUIRE(widget5->getInheritedOpacity() == 0.7f);
     }
 
+    SECTION("spatial index")
+    {
+        auto parent = std::make_shared<tgui::GuiContainer>();
+        REQUIRE(!parent->isSpatialIndexEnabled());
+        parent->setSpatialIndexEnabled(true);
+        REQUIRE(parent->isSpatialIndexEnabled());
+
+        auto w1 = tgui::ClickableWidget::create({100, 100});
+        auto w2 = tgui::ClickableWidget::create({100, 100});
+        auto w3 = tgui::ClickableWidget::create({50, 50});
+        w1->setPosition({10, 10});
+        w2->setPosition({60, 60});
+        w3->setPosition({500, 500});
+        parent->add(w1);
+        parent->add(w2);
+        parent->add(w3);
+
+        unsigned int count1 = 0;
+        unsigned int count2 = 0;
+        unsigned int count3 = 0;
+        w1->connect("MousePressed", [&]{ genericCallback(count1); });
+        w2->connect("MousePressed", [&]{ genericCallback(count2); });
+        w3->connect("MousePressed", [&]{ genericCallback(count3); });
+
+        // The widget in front is found when widgets overlap
+        parent->leftMousePressed({80, 80});
+        REQUIRE(count1 == 0);
+        REQUIRE(count2 == 1);
+
+        w1->moveToFront();
+        parent->leftMousePressed({80, 80});
+        REQUIRE(count1 == 1);
+        REQUIRE(count2 == 1);
+
+        parent->leftMousePressed({20, 20});
+        REQUIRE(count1 == 2);
+
+        // The index is updated when the widgets move
+        w2->setPosition({700, 700});
+        parent->leftMousePressed({520, 520});
+        parent->leftMousePressed({710, 710});
+        REQUIRE(count2 == 2);
+        REQUIRE(count3 == 1);
+
+        w3->setSize({300, 300});
+        parent->leftMousePressed({750, 550});
+        REQUIRE(count3 == 2);
+
+        // Removed and invisible widgets are no longer found
+        parent->remove(w3);
+        parent->leftMousePressed({520, 520});
+        REQUIRE(count3 == 2);
+
+        w1->setVisible(false);
+        parent->leftMousePressed({20, 20});
+        REQUIRE(count1 == 2);
+
+        // Widgets that react to the mouse outside of their bounds tell the container where to look for them
+        struct WidgetWithPopup : public tgui::ClickableWidget
+        {
+            bool mouseOnWidget(tgui::Vector2f pos) const override
+            {
+                return getHitTestBounds().contains(pos);
+            }
+
+            tgui::FloatRect getHitTestBounds() const override
+            {
+                return {getPosition().x, getPosition().y, 100, 400};
+            }
+        };
+
+        auto w4 = std::make_shared<WidgetWithPopup>();
+        w4->setSize({10, 10});
+        w4->setPosition({300, 0});
+        parent->add(w4);
+
+        unsigned int count4 = 0;
+        w4->connect("MousePressed", [&]{ genericCallback(count4); });
+        parent->leftMousePressed({350, 350});
+        REQUIRE(count4 == 1);
+
+        // Copying the container also copies the setting
+        auto parentCopy = std::make_shared<tgui::GuiContainer>(*parent);
+        REQUIRE(parentCopy->isSpatialIndexEnabled());
+
+        parent->setSpatialIndexEnabled(false);
+        REQUIRE(!parent->isSpatialIndexEnabled());
+        parent->leftMousePressed({710, 710});
+        REQUIRE(count2 == 3);
+    }
+
     // TODO: Events
     //       Test parameter of Widget::disable
 }
+
+TEST_CASE("[Container] spatial index benchmark", "[.benchmark]")
+{
+    auto parent = std::make_shared<tgui::GuiContainer>();
+    for (unsigned int y = 0; y < 40; ++y)
+    {
+        for (unsigned int x = 0; x < 50; ++x)
+        {
+            auto widget = tgui::ClickableWidget::create({18, 18});
+            widget->setPosition({x * 20.f, y * 20.f});
+            parent->add(widget);
+        }
+    }
+
+    const auto moveMouse = [&]{
+            for (unsigned int i = 0; i < 1000; ++i)
+                parent->mouseMoved({static_cast<float>((i * 7) % 1000), static_cast<float>((i * 13) % 800)});
+        };
+
+    BENCHMARK("Mouse moves over 2000 widgets without spatial index")
+    {
+        moveMouse();
+    }
+
+    parent->setSpatialIndexEnabled(true);
+    BENCHMARK("Mouse moves over 2000 widgets with spatial index")
+    {
+        moveMouse();
+    }
+}
+
+TEST_CASE("[Container] name lookup benchmark", "[.benchmark]")
+{
+    // 10000 widgets: 100 panels that each contain 99 labels
+    const auto fillContainer = [](tgui::Container& container){
+            for (unsigned int i = 0; i < 100; ++i)
+            {
+                auto panel = tgui::Panel::create();
+                for (unsigned int j = 0; j < 99; ++j)
+                    panel->add(tgui::Label::create(), "Label" + tgui::to_string(i) + "_" + tgui::to_string(j));
+
+                container.add(panel, "Panel" + tgui::to_string(i));
+            }
+        };
+
+    auto group = tgui::Group::create();
+    fillContainer(*group);
+
+    tgui::Gui gui;
+    fillContainer(*gui.getContainer());
+
+    REQUIRE(group->get("Label99_98") != nullptr);
+    REQUIRE(gui.get("Label99_98") != nullptr);
+    REQUIRE(gui.get("Panel99.Label99_98") != nullptr);
+
+    // Count the found widgets so that the lookups can't be optimized away
+    std::size_t found = 0;
+    BENCHMARK("Looking up the last of 10000 widgets without name index")
+    {
+        found += (group->get("Label99_98") != nullptr);
+    }
+
+    BENCHMARK("Looking up the last of 10000 widgets with name index")
+    {
+        found += (gui.get("Label99_98") != nullptr);
+    }
+
+    BENCHMARK("Looking up a dotted path in 10000 widgets with name index")
+    {
+        found += (gui.get("Panel99.Label99_98") != nullptr);
+    }
+
+    BENCHMARK("Looking up a missing name in 10000 widgets without name index")
+    {
+        found += (group->get("Missing") != nullptr);
+    }
+
+    BENCHMARK("Looking up a missing name in 10000 widgets with name index")
+    {
+        found += (gui.get("Missing") != nullptr);
+    }
+
+    WARN("Widgets found: " << found);
+}
@@ -0,0 +1,452 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/ChatBox.hpp>
+#include <TGUI/Widgets/CheckBox.hpp>
+#include <TGUI/Widgets/ClickableWidget.hpp>
+#include <TGUI/Widgets/ChildWindow.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/ListBox.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/ProgressBar.hpp>
+#include <TGUI/Widgets/Slider.hpp>
+#include <TGUI/Gui.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+namespace
+{
+    class DrawCountingWidget : public tgui::ClickableWidget
+    {
+    public:
+        DrawCountingWidget(unsigned int& drawCount) :
+            m_drawCount(drawCount)
+        {
+        }
+
+        void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+        {
+            ++m_drawCount;
+            tgui::ClickableWidget::draw(target, states);
+        }
+
+    private:
+        unsigned int& m_drawCount;
+    };
+
+    void moveMouse(tgui::Gui& gui, int x, int y)
+    {
+        sf::Event event;
+        event.type = sf::Event::MouseMoved;
+        event.mouseMove.x = x;
+        event.mouseMove.y = y;
+        gui.handleEvent(event);
+    }
+
+    sf::Image drawGui(tgui::Gui& gui, sf::RenderTexture& target)
+    {
+        target.clear({25, 130, 10});
+        gui.draw();
+        target.display();
+        return target.getTexture().copyToImage();
+    }
+
+    bool imagesEqual(const sf::Image& left, const sf::Image& right)
+    {
+        if (left.getSize() != right.getSize())
+            return false;
+
+        const std::size_t byteCount = left.getSize().x * left.getSize().y * 4;
+        return std::equal(left.getPixelsPtr(), left.getPixelsPtr() + byteCount, right.getPixelsPtr());
+    }
+}
+
+TEST_CASE("[DamageTracking]")
+{
+    sf::RenderTexture target;
+    target.create(400, 300);
+    tgui::Gui gui{target};
+
+    unsigned int drawCount = 0;
+    std::vector<std::shared_ptr<DrawCountingWidget>> widgets;
+    for (unsigned int i = 0; i < 10; ++i)
+    {
+        auto widget = std::make_shared<DrawCountingWidget>(drawCount);
+        widget->setPosition({i * 40.f, 0});
+        widget->setSize({30, 30});
+        gui.add(widget);
+        widgets.push_back(widget);
+    }
+
+    REQUIRE(gui.isDirty());
+    gui.draw();
+    REQUIRE(!gui.isDirty());
+    REQUIRE(gui.getDirtyRegion() == tgui::FloatRect{});
+
+    SECTION("Dirty region")
+    {
+        SECTION("Moving")
+        {
+            widgets[2]->setPosition({80, 100});
+            REQUIRE(gui.isDirty());
+            REQUIRE(gui.getDirtyRegion() == tgui::FloatRect(80, 0, 30, 130));
+        }
+
+        SECTION("Resizing")
+        {
+            widgets[1]->setSize({20, 50});
+            REQUIRE(gui.getDirtyRegion() == tgui::FloatRect(40, 0, 30, 50));
+        }
+
+        SECTION("Renderer")
+        {
+            widgets[3]->getRenderer()->setOpacity(0.5f);
+            REQUIRE(gui.getDirtyRegion() == tgui::FloatRect(120, 0, 30, 30));
+        }
+
+        SECTION("Hover")
+        {
+            moveMouse(gui, 15, 15);
+            REQUIRE(gui.getDirtyRegion() == tgui::FloatRect(0, 0, 30, 30));
+            gui.draw();
+
+            // The region of both the old and the new widget below the mouse has to be redrawn
+            moveMouse(gui, 55, 15);
+            REQUIRE(gui.getDirtyRegion() == tgui::FloatRect(0, 0, 70, 30));
+        }
+
+        SECTION("Removing")
+        {
+            gui.remove(widgets[5]);
+            REQUIRE(gui.getDirtyRegion() == tgui::FloatRect(200, 0, 30, 30));
+        }
+
+        SECTION("Changes outside the view")
+        {
+            widgets[9]->setPosition({360, 290});
+            gui.draw();
+
+            widgets[9]->setSize({40, 40});
+            REQUIRE(gui.getDirtyRegion() == tgui::FloatRect(360, 290, 40, 10));
+        }
+
+        SECTION("Invalidating manually")
+        {
+            widgets[6]->invalidate();
+            REQUIRE(gui.getDirtyRegion() == tgui::FloatRect(240, 0, 30, 30));
+        }
+
+        SECTION("Changing the view")
+        {
+            gui.setView(sf::View{{0, 0, 400, 300}});
+            REQUIRE(gui.getDirtyRegion() == tgui::FloatRect(0, 0, 400, 300));
+        }
+    }
+
+    SECTION("Widgets redrawn per frame")
+    {
+        SECTION("Full redraw")
+        {
+            REQUIRE(!gui.isPartialRedrawEnabled());
+
+            drawCount = 0;
+            gui.draw();
+            REQUIRE(drawCount == 10);
+
+            widgets[4]->setPosition({160, 100});
+            drawCount = 0;
+            gui.draw();
+            REQUIRE(drawCount == 10);
+        }
+
+        SECTION("Partial redraw")
+        {
+            gui.setPartialRedrawEnabled(true);
+            REQUIRE(gui.isPartialRedrawEnabled());
+
+            // Everything has to be drawn on the new internal texture
+            drawCount = 0;
+            gui.draw();
+            REQUIRE(drawCount == 10);
+
+            drawCount = 0;
+            gui.draw();
+            REQUIRE(drawCount == 0);
+
+            widgets[4]->setPosition({160, 100});
+            drawCount = 0;
+            gui.draw();
+            REQUIRE(drawCount == 1);
+
+            moveMouse(gui, 290, 15);
+            drawCount = 0;
+            gui.draw();
+            REQUIRE(drawCount == 1);
+
+            widgets[0]->setPosition({40, 0});
+            drawCount = 0;
+            gui.draw();
+            REQUIRE(drawCount == 2);
+        }
+    }
+
+    SECTION("Partial redraw gives same result as full redraw")
+    {
+        gui.removeAllWidgets();
+
+        std::vector<tgui::Button::Ptr> buttons;
+        for (unsigned int i = 0; i < 20; ++i)
+        {
+            auto button = tgui::Button::create();
+            button->setSize({35, 35});
+            button->setPosition({(i % 10) * 40.f, (i / 10) * 40.f});
+            gui.add(button);
+            buttons.push_back(button);
+        }
+
+        gui.setPartialRedrawEnabled(true);
+        drawGui(gui, target);
+
+        buttons[3]->setPosition({200, 200});
+        buttons[12]->getRenderer()->setBackgroundColor(sf::Color::Red);
+        const sf::Image imageWithPartialRedraw = drawGui(gui, target);
+
+        gui.setPartialRedrawEnabled(false);
+        const sf::Image imageWithFullRedraw = drawGui(gui, target);
+
+        REQUIRE(imagesEqual(imageWithPartialRedraw, imageWithFullRedraw));
+    }
+
+    SECTION("Partial redraw shows changes made from code")
+    {
+        gui.removeAllWidgets();
+
+        auto slider = tgui::Slider::create(0, 10);
+        slider->setPosition({20, 20});
+        slider->setSize({200, 16});
+        gui.add(slider);
+
+        auto progressBar = tgui::ProgressBar::create();
+        progressBar->setPosition({20, 60});
+        progressBar->setSize({200, 20});
+        gui.add(progressBar);
+
+        auto checkBox = tgui::CheckBox::create();
+        checkBox->setPosition({250, 20});
+        checkBox->setSize({20, 20});
+        gui.add(checkBox);
+
+        auto chatBox = tgui::ChatBox::create();
+        chatBox->getRenderer()->setFont("resources/DejaVuSans.ttf");
+        chatBox->setPosition({20, 100});
+        chatBox->setSize({200, 120});
+        chatBox->setTextSize(16);
+        chatBox->addLine("First line");
+        gui.add(chatBox);
+
+        gui.setPartialRedrawEnabled(true);
+        drawGui(gui, target);
+
+        slider->setValue(7);
+        REQUIRE(gui.getDirtyRegion().contains({120, 28}));
+
+        progressBar->setValue(60);
+        checkBox->setChecked(true);
+        chatBox->addLine("Line added from code");
+        const sf::Image imageWithPartialRedraw = drawGui(gui, target);
+
+        gui.setPartialRedrawEnabled(false);
+        const sf::Image imageWithFullRedraw = drawGui(gui, target);
+
+        REQUIRE(imagesEqual(imageWithPartialRedraw, imageWithFullRedraw));
+    }
+
+    SECTION("Render cache")
+    {
+        gui.removeAllWidgets();
+
+        auto childWindow = tgui::ChildWindow::create();
+        childWindow->setPosition({20, 20});
+        childWindow->setSize({200, 150});
+        gui.add(childWindow);
+
+        std::vector<std::shared_ptr<DrawCountingWidget>> children;
+        for (unsigned int i = 0; i < 5; ++i)
+        {
+            auto widget = std::make_shared<DrawCountingWidget>(drawCount);
+            widget->setPosition({i * 40.f, 10});
+            widget->setSize({30, 30});
+            childWindow->add(widget);
+            children.push_back(widget);
+        }
+
+        auto label = tgui::Label::create("Cached");
+        label->setPosition({10, 60});
+        childWindow->add(label);
+
+        REQUIRE(!childWindow->isRenderCacheEnabled());
+        childWindow->setRenderCacheEnabled(true);
+        REQUIRE(childWindow->isRenderCacheEnabled());
+
+        SECTION("Widgets are only drawn again when they changed")
+        {
+            drawCount = 0;
+            gui.draw();
+            REQUIRE(drawCount == 5);
+
+            drawCount = 0;
+            gui.draw();
+            REQUIRE(drawCount == 0);
+
+            // Dragging the child window only moves the texture
+            childWindow->setPosition({50, 40});
+            drawCount = 0;
+            gui.draw();
+            REQUIRE(drawCount == 0);
+
+            children[2]->setSize({20, 20});
+            drawCount = 0;
+            gui.draw();
+            REQUIRE(drawCount == 5);
+
+            label->setText("Changed");
+            drawCount = 0;
+            gui.draw();
+            REQUIRE(drawCount == 5);
+
+            childWindow->remove(children[4]);
+            drawCount = 0;
+            gui.draw();
+            REQUIRE(drawCount == 4);
+
+            // Changing the size of the child window requires a new texture
+            childWindow->setSize({250, 150});
+            drawCount = 0;
+            gui.draw();
+            REQUIRE(drawCount == 4);
+
+            childWindow->setRenderCacheEnabled(false);
+            drawCount = 0;
+            gui.draw();
+            gui.draw();
+            REQUIRE(drawCount == 8);
+        }
+
+        SECTION("Cached widgets look the same as when drawing them directly")
+        {
+            // Text is left out, its anti-aliased edges may be rounded differently when blended twice
+            childWindow->remove(label);
+
+            auto panel = tgui::Panel::create({80, 40});
+            panel->setPosition({20, 90});
+            panel->getRenderer()->setBackgroundColor(sf::Color::Blue);
+            childWindow->add(panel);
+
+            auto innerPanel = tgui::Panel::create({40, 60});
+            innerPanel->setPosition({10, 10});
+            innerPanel->getRenderer()->setBackgroundColor(sf::Color::Red);
+            panel->add(innerPanel);
+
+            drawGui(gui, target);
+
+            childWindow->setPosition({50, 40});
+            panel->setPosition({40, 80});
+            const sf::Image imageWithCache = drawGui(gui, target);
+
+            childWindow->setRenderCacheEnabled(false);
+            const sf::Image imageWithoutCache = drawGui(gui, target);
+
+            REQUIRE(imagesEqual(imageWithCache, imageWithoutCache));
+        }
+
+        SECTION("Changes made from code are shown in the cache")
+        {
+            // The text of the label would be blended twice, the text in the list box is drawn on top of its background
+            childWindow->remove(label);
+
+            auto slider = tgui::Slider::create(0, 10);
+            slider->setPosition({10, 60});
+            slider->setSize({150, 14});
+            childWindow->add(slider);
+
+            auto listBox = tgui::ListBox::create();
+            listBox->getRenderer()->setFont("resources/DejaVuSans.ttf");
+            listBox->setPosition({10, 85});
+            listBox->setSize({150, 60});
+            listBox->setItemHeight(20);
+            listBox->addItem("First");
+            listBox->addItem("Second");
+            childWindow->add(listBox);
+
+            drawGui(gui, target);
+
+            slider->setValue(8);
+            listBox->addItem("Third");
+            listBox->changeItemByIndex(0, "Changed");
+            listBox->setSelectedItemByIndex(1);
+            const sf::Image imageWithCache = drawGui(gui, target);
+
+            childWindow->setRenderCacheEnabled(false);
+            const sf::Image imageWithoutCache = drawGui(gui, target);
+
+            REQUIRE(imagesEqual(imageWithCache, imageWithoutCache));
+        }
+    }
+}
+
+TEST_CASE("[DamageTracking] render cache benchmark", "[.benchmark]")
+{
+    sf::RenderTexture target;
+    target.create(800, 600);
+    tgui::Gui gui{target};
+
+    auto childWindow = tgui::ChildWindow::create();
+    childWindow->setSize({600, 400});
+    gui.add(childWindow);
+
+    for (unsigned int i = 0; i < 500; ++i)
+    {
+        auto button = tgui::Button::create("Button");
+        button->setSize({22, 14});
+        button->setPosition({(i % 25) * 24.f, (i / 25) * 16.f});
+        childWindow->add(button);
+    }
+
+    // The child window is dragged around while nothing inside it changes
+    unsigned int frame = 0;
+    BENCHMARK("Dragging a child window with 500 buttons without render cache")
+    {
+        childWindow->setPosition({static_cast<float>(frame++ % 100), 50});
+        gui.draw();
+    }
+
+    childWindow->setRenderCacheEnabled(true);
+    BENCHMARK("Dragging a child window with 500 buttons with render cache")
+    {
+        childWindow->setPosition({static_cast<float>(frame++ % 100), 50});
+        gui.draw();
+    }
+}
@@ -0,0 +1,98 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/FontManager.hpp>
+#include <TGUI/Font.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <SFML/System/Err.hpp>
+
+TEST_CASE("[FontManager]")
+{
+    tgui::FontManager::flushCache();
+
+    SECTION("Fonts are shared")
+    {
+        tgui::Font font1{"resources/DejaVuSans.ttf"};
+        tgui::Font font2{"resources/DejaVuSans.ttf"};
+        REQUIRE(font1.getFont() != nullptr);
+        REQUIRE(font1.getFont() == font2.getFont());
+
+        auto label1 = tgui::Label::create();
+        auto label2 = tgui::Label::create();
+        label1->getRenderer()->setFont("resources/DejaVuSans.ttf");
+        label2->getRenderer()->setFont("resources/DejaVuSans.ttf");
+        REQUIRE(label1->getRenderer()->getFont() == label2->getRenderer()->getFont());
+        REQUIRE(label1->getRenderer()->getFont().getFont() == font1.getFont());
+
+        const auto statistics = tgui::FontManager::getStatistics();
+        REQUIRE(statistics.fontCount == 1);
+        REQUIRE(statistics.loadCount == 1);
+        REQUIRE(statistics.reuseCount >= 3);
+    }
+
+    SECTION("Unused fonts are released")
+    {
+        std::weak_ptr<sf::Font> weakFont;
+        {
+            tgui::Font font{"resources/DejaVuSans.ttf"};
+            weakFont = font.getFont();
+            REQUIRE(tgui::FontManager::getStatistics().fontCount == 1);
+        }
+
+        REQUIRE(weakFont.expired());
+        REQUIRE(tgui::FontManager::getStatistics().fontCount == 0);
+
+        tgui::Font font{"resources/DejaVuSans.ttf"};
+        REQUIRE(tgui::FontManager::getStatistics().loadCount == 2);
+    }
+
+    SECTION("Flushing the cache")
+    {
+        tgui::Font font1{"resources/DejaVuSans.ttf"};
+        tgui::FontManager::flushCache("resources/DejaVuSans.ttf");
+        REQUIRE(tgui::FontManager::getStatistics().fontCount == 0);
+
+        // The old font remains valid but is no longer shared
+        tgui::Font font2{"resources/DejaVuSans.ttf"};
+        REQUIRE(font1.getFont() != font2.getFont());
+        REQUIRE(tgui::FontManager::getStatistics().fontCount == 1);
+
+        tgui::FontManager::flushCache();
+        REQUIRE(tgui::FontManager::getStatistics().fontCount == 0);
+        REQUIRE(tgui::FontManager::getStatistics().loadCount == 0);
+    }
+
+    SECTION("Fonts that fail to load are not shared")
+    {
+        std::streambuf *oldbuf = sf::err().rdbuf(0);
+        auto font1 = tgui::FontManager::getFont("NonExistent.ttf");
+        auto font2 = tgui::FontManager::getFont("NonExistent.ttf");
+        sf::err().rdbuf(oldbuf);
+
+        REQUIRE(font1 != font2);
+        REQUIRE(tgui::FontManager::getStatistics().fontCount == 0);
+    }
+}
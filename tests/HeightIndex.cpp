@@ -0,0 +1,134 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/HeightIndex.hpp>
+
+TEST_CASE("[HeightIndex]")
+{
+    tgui::priv::HeightIndex index;
+    REQUIRE(index.getSize() == 0);
+    REQUIRE(index.getTotalHeight() == 0);
+    REQUIRE(index.findIndex(10) == 0);
+
+    SECTION("Adding and removing items")
+    {
+        index.pushBack(10);
+        index.pushBack(20);
+        index.pushFront(5);
+        REQUIRE(index.getSize() == 3);
+        REQUIRE(index.getHeight(0) == 5);
+        REQUIRE(index.getHeight(1) == 10);
+        REQUIRE(index.getHeight(2) == 20);
+        REQUIRE(index.getTotalHeight() == 35);
+
+        index.popFront();
+        REQUIRE(index.getSize() == 2);
+        REQUIRE(index.getHeight(0) == 10);
+        REQUIRE(index.getTotalHeight() == 30);
+
+        index.popBack();
+        REQUIRE(index.getSize() == 1);
+        REQUIRE(index.getHeight(0) == 10);
+        REQUIRE(index.getTotalHeight() == 10);
+
+        index.clear();
+        REQUIRE(index.getSize() == 0);
+        REQUIRE(index.getTotalHeight() == 0);
+    }
+
+    SECTION("Offsets")
+    {
+        for (unsigned int i = 1; i <= 100; ++i)
+            index.pushBack(static_cast<float>(i));
+
+        REQUIRE(index.getOffset(0) == 0);
+        REQUIRE(index.getOffset(1) == 1);
+        REQUIRE(index.getOffset(10) == 55);
+        REQUIRE(index.getOffset(100) == 5050);
+        REQUIRE(index.getTotalHeight() == 5050);
+
+        index.setHeight(0, 11);
+        REQUIRE(index.getOffset(10) == 65);
+        REQUIRE(index.getTotalHeight() == 5060);
+
+        index.erase(0);
+        REQUIRE(index.getSize() == 99);
+        REQUIRE(index.getHeight(0) == 2);
+        REQUIRE(index.getOffset(9) == 54);
+        REQUIRE(index.getTotalHeight() == 5049);
+    }
+
+    SECTION("Finding items")
+    {
+        index.pushBack(10);
+        index.pushBack(20);
+        index.pushBack(30);
+
+        REQUIRE(index.findIndex(-5) == 0);
+        REQUIRE(index.findIndex(0) == 0);
+        REQUIRE(index.findIndex(9.5f) == 0);
+        REQUIRE(index.findIndex(10) == 1);
+        REQUIRE(index.findIndex(29) == 1);
+        REQUIRE(index.findIndex(30) == 2);
+        REQUIRE(index.findIndex(59) == 2);
+        REQUIRE(index.findIndex(60) == 3);
+    }
+
+    SECTION("Items wrapping around the buffer")
+    {
+        // Keep removing items from the front while adding them at the back, like a chat box with a line limit does
+        for (unsigned int i = 0; i < 10; ++i)
+            index.pushBack(1);
+
+        for (unsigned int i = 0; i < 1000; ++i)
+        {
+            index.popFront();
+            index.pushBack(static_cast<float>(i % 7));
+        }
+
+        REQUIRE(index.getSize() == 10);
+        float expectedTotal = 0;
+        for (unsigned int i = 990; i < 1000; ++i)
+        {
+            REQUIRE(index.getHeight(i - 990) == static_cast<float>(i % 7));
+            REQUIRE(index.getOffset(i - 990) == expectedTotal);
+            expectedTotal += static_cast<float>(i % 7);
+        }
+        REQUIRE(index.getTotalHeight() == expectedTotal);
+
+        for (unsigned int i = 0; i < 10; ++i)
+        {
+            if (index.getHeight(i) > 0)
+                REQUIRE(index.findIndex(index.getOffset(i)) == i);
+        }
+
+        for (unsigned int i = 0; i < 10; ++i)
+            index.pushFront(2);
+        REQUIRE(index.getSize() == 20);
+        REQUIRE(index.getOffset(10) == 20);
+        REQUIRE(index.getTotalHeight() == expectedTotal + 20);
+    }
+}
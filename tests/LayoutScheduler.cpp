@@ -0,0 +1,145 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/LayoutScheduler.hpp>
+#include <TGUI/Widgets/ClickableWidget.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Gui.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/System/Err.hpp>
+
+using namespace tgui::bind_functions;
+
+TEST_CASE("[LayoutScheduler]")
+{
+    auto panel = tgui::Panel::create({400, 300});
+
+    SECTION("Signals are only emitted once")
+    {
+        sf::RenderTexture texture;
+        texture.create(20, 15);
+        tgui::Gui gui{texture};
+
+        auto widget = tgui::ClickableWidget::create({"parent.width / 2", "parent.height / 2"});
+        gui.add(widget);
+
+        unsigned int sizeChangedCount = 0;
+        widget->connect("SizeChanged", [&]{ sizeChangedCount++; });
+
+        // Both the width and height of the gui change, but the widget is only resized once
+        gui.setView(sf::View{{0, 0, 100, 50}});
+        REQUIRE(widget->getSize() == sf::Vector2f(50, 25));
+        REQUIRE(sizeChangedCount == 1);
+    }
+
+    SECTION("Widgets are updated in the order of their dependencies")
+    {
+        std::vector<tgui::ClickableWidget::Ptr> widgets;
+        for (unsigned int i = 0; i < 10; ++i)
+        {
+            auto widget = tgui::ClickableWidget::create({"parent.width / 10", "parent.height"});
+            if (i > 0)
+                widget->setPosition(bindRight(widgets.back()), bindTop(widgets.back()));
+
+            panel->add(widget);
+            widgets.push_back(widget);
+        }
+
+        unsigned int positionChangedCount = 0;
+        widgets.back()->connect("PositionChanged", [&]{ positionChangedCount++; });
+
+        panel->setSize(800, 600);
+        REQUIRE(widgets.back()->getPosition() == sf::Vector2f(720, 0));
+        REQUIRE(widgets.back()->getSize() == sf::Vector2f(80, 600));
+        REQUIRE(positionChangedCount == 1);
+    }
+
+    SECTION("Deferred updates")
+    {
+        auto widget = tgui::ClickableWidget::create({"parent.width / 2", "parent.height / 2"});
+        panel->add(widget);
+        REQUIRE(widget->getSize() == sf::Vector2f(200, 150));
+
+        tgui::LayoutScheduler::setDeferred(true);
+        REQUIRE(tgui::LayoutScheduler::isDeferred());
+
+        panel->setSize(200, 100);
+        REQUIRE(tgui::LayoutScheduler::hasPendingUpdates());
+        REQUIRE(widget->getSize() == sf::Vector2f(200, 150));
+
+        tgui::LayoutScheduler::update();
+        REQUIRE(!tgui::LayoutScheduler::hasPendingUpdates());
+        REQUIRE(widget->getSize() == sf::Vector2f(100, 50));
+
+        // Pending updates are performed when no longer deferring them
+        panel->setSize(400, 300);
+        tgui::LayoutScheduler::setDeferred(false);
+        REQUIRE(!tgui::LayoutScheduler::isDeferred());
+        REQUIRE(widget->getSize() == sf::Vector2f(200, 150));
+    }
+
+    SECTION("Circular dependency")
+    {
+        auto widget1 = tgui::ClickableWidget::create();
+        auto widget2 = tgui::ClickableWidget::create();
+        panel->add(widget1);
+        panel->add(widget2);
+
+        std::streambuf *oldbuf = sf::err().rdbuf(0);
+        widget1->setSize({bindWidth(widget2) + 1, 10});
+        widget2->setSize({bindWidth(widget1) + 1, 10});
+        sf::err().rdbuf(oldbuf);
+
+        REQUIRE(!tgui::LayoutScheduler::hasPendingUpdates());
+    }
+}
+
+TEST_CASE("[LayoutScheduler] relative layout benchmark", "[.benchmark]")
+{
+    sf::RenderTexture texture;
+    texture.create(800, 600);
+    tgui::Gui gui{texture};
+
+    // Create a grid of 100 by 50 widgets where each widget is positioned relative to its left and top neighbours
+    std::vector<tgui::ClickableWidget::Ptr> widgets;
+    for (unsigned int i = 0; i < 5000; ++i)
+    {
+        auto widget = tgui::ClickableWidget::create({"parent.width / 100", "parent.height / 50"});
+        if (i % 100 != 0)
+            widget->setPosition(bindRight(widgets[i - 1]), bindTop(widgets[i - 1]));
+        else if (i > 0)
+            widget->setPosition(0, bindBottom(widgets[i - 100]));
+
+        gui.add(widget);
+        widgets.push_back(widget);
+    }
+
+    BENCHMARK("Resizing the window 10 times")
+    {
+        for (unsigned int i = 0; i < 10; ++i)
+            gui.setView(sf::View{{0, 0, 800.f + i, 600.f + i}});
+    }
+}
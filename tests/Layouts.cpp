@@ -351,6 +351,42 @@ TEST_CASE("[Layouts]")
         }
     }
 
+    SECTION("Binding by name")
+    {
+        tgui::Panel::Ptr panel = std::make_shared<tgui::Panel>();
+        panel->setSize(400, 300);
+
+        auto group = std::make_shared<tgui::Panel>();
+        group->setPosition(10, 20);
+        group->setSize(200, 100);
+        panel->add(group, "MyGroup");
+
+        auto inner = std::make_shared<tgui::Button>();
+        inner->setSize(50, 40);
+        group->add(inner, "InnerButton");
+
+        auto button = std::make_shared<tgui::Button>();
+        panel->add(button, "Btn");
+
+        // Names are matched case-insensitively and can be chained
+        button->setPosition({"mygroup.x", "MyGroup.innerbutton.height"});
+        REQUIRE(button->getPosition() == sf::Vector2f(10, 40));
+
+        button->setSize({"myGroup.size", "parent.mygroup.size"});
+        REQUIRE(button->getSize() == sf::Vector2f(200, 100));
+
+        group->setSize(150, 80);
+        inner->setSize(50, 30);
+        REQUIRE(button->getPosition() == sf::Vector2f(10, 30));
+        REQUIRE(button->getSize() == sf::Vector2f(150, 80));
+
+        // Unknown names or properties don't bind anything
+        button->setSize({"mygroup.depth", "unknown.height"});
+        REQUIRE(button->getSize() == sf::Vector2f(0, 0));
+        button->setSize({"mygroup..width", ".height"});
+        REQUIRE(button->getSize() == sf::Vector2f(0, 0));
+    }
+
     SECTION("Bug Fixes")
     {
         SECTION("Setting negative size and reverting back to positive (https://github.com/texus/TGUI/issues/54)")
@@ -370,3 +406,30 @@ TEST_CASE("[Layouts]")
         }
     }
 }
+
+TEST_CASE("[Layouts] binding by name benchmark", "[.benchmark]")
+{
+    // Bind to the last of a thousand siblings, so that every reconnect has to search through all names
+    tgui::Panel::Ptr panel = std::make_shared<tgui::Panel>();
+    for (unsigned int i = 0; i < 1000; ++i)
+        panel->add(tgui::Button::create(), "Button" + tgui::to_string(i));
+
+    auto widget = std::make_shared<tgui::Button>();
+    widget->setSize({"Button999.width / 2", "Button999.height"});
+    panel->add(widget);
+
+    BENCHMARK("Reconnecting a layout that binds a widget by name")
+    {
+        for (unsigned int i = 0; i < 100; ++i)
+            widget->setSize(widget->getSizeLayout());
+    }
+
+    BENCHMARK("Moving a widget with a layout that binds a widget by name")
+    {
+        for (unsigned int i = 0; i < 100; ++i)
+        {
+            panel->remove(widget);
+            panel->add(widget);
+        }
+    }
+}
@@ -25,6 +25,9 @@
 #include "Tests.hpp"
 #include <TGUI/Loading/DataIO.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
+#include <chrono>
+#include <fstream>
+#include <iterator>
 
 TEST_CASE("[DataIO]")
 {
@@ -198,6 +201,46 @@ TEST_CASE("[DataIO]")
             std::stringstream input("{ Property = ; ");
             REQUIRE_THROWS_AS(tgui::DataIO::parse(input), tgui::Exception);
         }
+
+        SECTION("Whitespace and comments inside value")
+        {
+            std::stringstream input("Property = a \t b/*c*/ d //e\n ;\nList = [ x  y , \"1,2\"];");
+
+            std::unique_ptr<tgui::DataIO::Node> rootNode;
+            REQUIRE_NOTHROW(rootNode = tgui::DataIO::parse(input));
+
+            REQUIRE(rootNode->propertyValuePairs["property"]->value == "a b d");
+            REQUIRE(rootNode->propertyValuePairs["list"]->value == "[ x y , \"1,2\"]");
+            REQUIRE(rootNode->propertyValuePairs["list"]->valueList.size() == 2);
+            REQUIRE(rootNode->propertyValuePairs["list"]->valueList[0] == "x y");
+            REQUIRE(rootNode->propertyValuePairs["list"]->valueList[1] == "\"1,2\"");
+        }
+
+        SECTION("Partially read stream")
+        {
+            std::stringstream input("Ignored Property = Value;");
+            std::string word;
+            input >> word;
+
+            std::unique_ptr<tgui::DataIO::Node> rootNode;
+            REQUIRE_NOTHROW(rootNode = tgui::DataIO::parse(input));
+            REQUIRE(rootNode->propertyValuePairs.size() == 1);
+            REQUIRE(rootNode->propertyValuePairs["property"]->value == "Value");
+        }
+
+        SECTION("Contiguous buffer")
+        {
+            const std::string input = "Child { Property = [a, \"b\"]; } Error";
+
+            // The data behind the given size is never read
+            std::unique_ptr<tgui::DataIO::Node> rootNode;
+            REQUIRE_NOTHROW(rootNode = tgui::DataIO::parse(input.data(), input.size() - 6));
+            REQUIRE(rootNode->children.size() == 1);
+            REQUIRE(rootNode->children[0]->propertyValuePairs["property"]->valueList.size() == 2);
+            REQUIRE(rootNode->children[0]->propertyValuePairs["property"]->valueList[1] == "\"b\"");
+
+            REQUIRE_THROWS_AS(tgui::DataIO::parse(input.data(), input.size()), tgui::Exception);
+        }
     }
 
     SECTION("correct input")
@@ -287,4 +330,93 @@ TEST_CASE("[DataIO]")
         REQUIRE(parsedRoot->children[1]->children.empty());
         REQUIRE(parsedRoot->children[1]->propertyValuePairs.empty());
     }
+
+    SECTION("binary")
+    {
+        const std::string input = "Property = Value;\n"
+                                  "Child1\n"
+                                  "{\n"
+                                  "    List = [\"a\", B, \"\\\"c\\\"\"];\n"
+                                  "    Nested { Empty = []; }\n"
+                                  "}\n"
+                                  "{\n"
+                                  "}\n";
+
+        auto textRoot = tgui::DataIO::parse(input.data(), input.size());
+
+        std::string binary;
+        tgui::DataIO::emitBinary(textRoot, binary);
+        auto binaryRoot = tgui::DataIO::parseBinary(binary.data(), binary.size());
+
+        std::stringstream textStream;
+        std::stringstream binaryStream;
+        tgui::DataIO::emit(textRoot, textStream);
+        tgui::DataIO::emit(binaryRoot, binaryStream);
+        REQUIRE(textStream.str() == binaryStream.str());
+
+        REQUIRE(binaryRoot->children.size() == 2);
+        REQUIRE(binaryRoot->children[0]->parent == binaryRoot.get());
+        REQUIRE(binaryRoot->children[0]->children[0]->parent == binaryRoot->children[0].get());
+        REQUIRE(binaryRoot->children[0]->propertyValuePairs["list"]->listNode);
+        REQUIRE(binaryRoot->children[0]->propertyValuePairs["list"]->valueList.size() == 3);
+        REQUIRE(binaryRoot->children[0]->propertyValuePairs["list"]->valueList[2] == "\"\\\"c\\\"\"");
+
+        SECTION("Invalid data")
+        {
+            REQUIRE_THROWS_AS(tgui::DataIO::parseBinary(input.data(), input.size()), tgui::Exception);
+            REQUIRE_THROWS_AS(tgui::DataIO::parseBinary(binary.data(), binary.size() - 1), tgui::Exception);
+            REQUIRE_THROWS_AS(tgui::DataIO::parseBinary((binary + "x").data(), binary.size() + 1), tgui::Exception);
+
+            // Nodes that are nested too deep are rejected instead of overflowing the stack
+            std::string deepBinary{"TGUIBIN\1", 8};
+            for (unsigned int i = 0; i < 100000; ++i)
+                deepBinary.append("\0\0\0\0" "\0\0\0\0" "\1\0\0\0", 12);
+            REQUIRE_THROWS_AS(tgui::DataIO::parseBinary(deepBinary.data(), deepBinary.size()), tgui::Exception);
+        }
+
+        SECTION("Cache")
+        {
+            tgui::setBinaryCachePath(".");
+            REQUIRE(tgui::getBinaryCachePath() == "./");
+
+            // The first call writes the cache file, the second one reads it back
+            for (unsigned int i = 0; i < 2; ++i)
+            {
+                std::stringstream cachedStream;
+                tgui::DataIO::emit(tgui::DataIO::parseWithCache(input), cachedStream);
+                REQUIRE(cachedStream.str() == textStream.str());
+            }
+
+            tgui::setBinaryCachePath("");
+        }
+    }
+}
+
+TEST_CASE("[DataIO] parse benchmark", "[.benchmark]")
+{
+    std::string themes;
+    for (const std::string filename : {"resources/Black.txt", "resources/BabyBlue.txt", "resources/TransparentGrey.txt"})
+    {
+        std::ifstream file{filename};
+        REQUIRE(file.is_open());
+        themes.append(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{});
+    }
+
+    // Repeat the themes until the input has the size of a large form file
+    std::string input;
+    while (input.size() < 3 * 1024 * 1024)
+        input += themes;
+
+    BENCHMARK("Parsing 3 MB of theme files")
+    {
+        tgui::DataIO::parse(input.data(), input.size());
+    }
+
+    const unsigned int repetitions = 10;
+    const auto startTime = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < repetitions; ++i)
+        tgui::DataIO::parse(input.data(), input.size());
+
+    const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - startTime;
+    WARN("Parsed theme files at " << (repetitions * input.size() / (1024.0 * 1024.0)) / duration.count() << " MB/s");
 }
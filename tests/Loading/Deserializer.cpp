@@ -201,7 +201,11 @@ TEST_CASE("[Deserializer]")
         REQUIRE(rendererData->propertyValuePairs.size() == 3);
         REQUIRE(rendererData->propertyValuePairs["somecolor"].getString() == "Red");
         REQUIRE(rendererData->propertyValuePairs["textstyleproperty"].getString() == "StrikeThrough");
-        REQUIRE(rendererData->propertyValuePairs["nested"].getString() == "{\nnum = 5;\n}");
+
+        // The nested renderer is created directly instead of being stored as text that has to be parsed again
+        REQUIRE(rendererData->propertyValuePairs["nested"].getType() == tgui::ObjectConverter::Type::RendererData);
+        REQUIRE(rendererData->propertyValuePairs["nested"].getRenderer()->propertyValuePairs.size() == 1);
+        REQUIRE(rendererData->propertyValuePairs["nested"].getRenderer()->propertyValuePairs["num"].getNumber() == 5);
     }
 
     SECTION("custom deserialize function")
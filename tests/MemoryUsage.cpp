@@ -0,0 +1,217 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/TGUI.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// The global allocation functions are replaced to be able to measure how much memory the widgets use.
+// Every allocation stores its size in front of the returned memory. A DLL on Windows has its own heap, so the memory can
+// only be tracked when the libraries are linked statically.
+#if !defined(SFML_SYSTEM_WINDOWS) || defined(TGUI_STATIC)
+    #define TGUI_TRACK_HEAP
+#endif
+
+namespace
+{
+    std::atomic<std::size_t> heapBytes{0};
+    std::atomic<std::size_t> heapAllocations{0};
+
+    const std::size_t allocationHeaderSize = alignof(std::max_align_t);
+
+    template <typename WidgetType>
+    std::size_t getHeapPerWidget()
+    {
+        const std::size_t count = 100;
+        std::vector<typename WidgetType::Ptr> widgets;
+        widgets.reserve(count);
+
+        // The first widget may load the default font or theme
+        WidgetType::create();
+
+        const std::size_t heapBefore = heapBytes;
+        for (std::size_t i = 0; i < count; ++i)
+            widgets.push_back(WidgetType::create());
+
+        return (heapBytes - heapBefore) / count;
+    }
+
+    template <typename WidgetType>
+    void reportMemoryUsage(const char* name)
+    {
+    #ifdef TGUI_TRACK_HEAP
+        WARN(name << ": sizeof " << sizeof(WidgetType) << " bytes, " << getHeapPerWidget<WidgetType>() << " bytes on the heap per widget");
+    #else
+        WARN(name << ": sizeof " << sizeof(WidgetType) << " bytes");
+    #endif
+    }
+}
+
+#ifdef TGUI_TRACK_HEAP
+void* operator new(std::size_t size)
+{
+    void* memory = std::malloc(size + allocationHeaderSize);
+    if (!memory)
+        throw std::bad_alloc{};
+
+    *static_cast<std::size_t*>(memory) = size;
+    heapBytes += size;
+    ++heapAllocations;
+    return static_cast<char*>(memory) + allocationHeaderSize;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    if (!ptr)
+        return;
+
+    void* memory = static_cast<char*>(ptr) - allocationHeaderSize;
+    heapBytes -= *static_cast<std::size_t*>(memory);
+    std::free(memory);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    operator delete(ptr);
+}
+#endif
+
+TEST_CASE("[MemoryUsage]")
+{
+    SECTION("Signals only store a pointer to their name")
+    {
+        REQUIRE(sizeof(tgui::Signal) <= 2 * sizeof(void*) + sizeof(std::shared_ptr<int>));
+    }
+
+#ifdef TGUI_TRACK_HEAP
+    SECTION("Rarely used parts of a widget are only allocated when used")
+    {
+        auto button = tgui::Button::create();
+
+        std::size_t heapBefore = heapBytes;
+        button->connect("Pressed", []{});
+        REQUIRE(heapBytes > heapBefore);
+
+        heapBefore = heapBytes;
+        button->setUserData(5);
+        REQUIRE(heapBytes > heapBefore);
+        REQUIRE(button->getUserData<int>() == 5);
+
+        // Once the side storage exists, replacing the user data doesn't allocate it again
+        auto label = tgui::Label::create();
+        heapBefore = heapBytes;
+        label->setUserData(std::string{"x"});
+        const std::size_t userDataSize = heapBytes - heapBefore;
+        heapBefore = heapBytes;
+        label->setUserData(std::string{"y"});
+        REQUIRE(heapBytes - heapBefore < userDataSize);
+
+        REQUIRE_THROWS_AS(tgui::Label::create()->getUserData<int>(), std::bad_cast);
+    }
+
+    SECTION("Copying a layout shares its constant parts")
+    {
+        const tgui::Layout constantLayout{"(10 + 20) / 2"};
+        std::size_t allocationsBefore = heapAllocations;
+        tgui::Layout constantCopy{constantLayout};
+        REQUIRE(heapAllocations == allocationsBefore);
+        REQUIRE(constantCopy.getValue() == 15);
+
+        // Only the part that depends on a widget is copied
+        const tgui::Layout boundLayout{"(parent.width - 20) / 2"};
+        allocationsBefore = heapAllocations;
+        tgui::Layout boundCopy{boundLayout};
+        REQUIRE(heapAllocations - allocationsBefore <= 2);
+    }
+#endif
+}
+
+TEST_CASE("[MemoryUsage] widget size report", "[.benchmark]")
+{
+    reportMemoryUsage<tgui::BitmapButton>("BitmapButton");
+    reportMemoryUsage<tgui::Button>("Button");
+    reportMemoryUsage<tgui::Canvas>("Canvas");
+    reportMemoryUsage<tgui::ChatBox>("ChatBox");
+    reportMemoryUsage<tgui::CheckBox>("CheckBox");
+    reportMemoryUsage<tgui::ChildWindow>("ChildWindow");
+    reportMemoryUsage<tgui::ComboBox>("ComboBox");
+    reportMemoryUsage<tgui::EditBox>("EditBox");
+    reportMemoryUsage<tgui::Grid>("Grid");
+    reportMemoryUsage<tgui::Group>("Group");
+    reportMemoryUsage<tgui::HorizontalLayout>("HorizontalLayout");
+    reportMemoryUsage<tgui::HorizontalWrap>("HorizontalWrap");
+    reportMemoryUsage<tgui::Knob>("Knob");
+    reportMemoryUsage<tgui::Label>("Label");
+    reportMemoryUsage<tgui::ListBox>("ListBox");
+    reportMemoryUsage<tgui::MenuBar>("MenuBar");
+    reportMemoryUsage<tgui::MessageBox>("MessageBox");
+    reportMemoryUsage<tgui::Panel>("Panel");
+    reportMemoryUsage<tgui::Picture>("Picture");
+    reportMemoryUsage<tgui::ProgressBar>("ProgressBar");
+    reportMemoryUsage<tgui::RadioButton>("RadioButton");
+    reportMemoryUsage<tgui::RadioButtonGroup>("RadioButtonGroup");
+    reportMemoryUsage<tgui::RangeSlider>("RangeSlider");
+    reportMemoryUsage<tgui::ScrollablePanel>("ScrollablePanel");
+    reportMemoryUsage<tgui::Scrollbar>("Scrollbar");
+    reportMemoryUsage<tgui::Slider>("Slider");
+    reportMemoryUsage<tgui::SpinButton>("SpinButton");
+    reportMemoryUsage<tgui::Tabs>("Tabs");
+    reportMemoryUsage<tgui::TextBox>("TextBox");
+    reportMemoryUsage<tgui::VerticalLayout>("VerticalLayout");
+}
+
+TEST_CASE("[MemoryUsage] layout allocations benchmark", "[.benchmark]")
+{
+#ifdef TGUI_TRACK_HEAP
+    const std::size_t count = 1000;
+
+    auto panel = tgui::Panel::create({400, 300});
+    auto widget = tgui::ClickableWidget::create();
+    widget->setSize({"(parent.width - 20) / 2", "parent.height * 0.5 + 10"});
+    panel->add(widget);
+
+    auto otherWidget = tgui::ClickableWidget::create();
+    panel->add(otherWidget);
+
+    std::size_t allocationsBefore = heapAllocations;
+    for (std::size_t i = 0; i < count; ++i)
+        widget->setSize(widget->getSizeLayout());
+    WARN("setSize(getSizeLayout()): " << static_cast<float>(heapAllocations - allocationsBefore) / count << " heap allocations per call");
+
+    allocationsBefore = heapAllocations;
+    for (std::size_t i = 0; i < count; ++i)
+        otherWidget->setSize(widget->getSizeLayout());
+    WARN("setSize(otherWidget->getSizeLayout()): " << static_cast<float>(heapAllocations - allocationsBefore) / count << " heap allocations per call");
+
+    allocationsBefore = heapAllocations;
+    for (std::size_t i = 0; i < count; ++i)
+        tgui::Layout2d copy{widget->getSizeLayout()};
+    WARN("Layout2d copy: " << static_cast<float>(heapAllocations - allocationsBefore) / count << " heap allocations per copy");
+#else
+    WARN("Heap allocations can only be counted when linking statically");
+#endif
+}
@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Slider.hpp>
 
 TEST_CASE("[Signal]")
 {
@@ -170,5 +171,124 @@ TEST_CASE("[Signal]")
         widget->setPosition(60, 60);
         widget->setSize(400, 100);
         REQUIRE(i == 5);
+
+        REQUIRE(!widget->onPositionChange.disconnect(id));
+        id = widget->onPositionChange.connect([](){});
+        REQUIRE(widget->onPositionChange.disconnect(id));
+    }
+
+    SECTION("Changing connections while emitting")
+    {
+        unsigned int count1 = 0;
+        unsigned int count2 = 0;
+        unsigned int count3 = 0;
+        unsigned int id2 = 0;
+        unsigned int id3 = 0;
+
+        // The first handler disconnects itself and the second one, and connects a new handler
+        unsigned int id1 = 0;
+        id1 = widget->onPositionChange.connect([&](){
+                count1++;
+                widget->onPositionChange.disconnect(id1);
+                widget->onPositionChange.disconnect(id2);
+                id3 = widget->onPositionChange.connect([&](){ count3++; });
+            });
+        id2 = widget->onPositionChange.connect([&](){ count2++; });
+
+        // Handlers that are connected during emission are only called on the next emission
+        widget->setPosition(10, 10);
+        REQUIRE(count1 == 1);
+        REQUIRE(count2 == 0);
+        REQUIRE(count3 == 0);
+
+        widget->setPosition(20, 20);
+        REQUIRE(count1 == 1);
+        REQUIRE(count2 == 0);
+        REQUIRE(count3 == 1);
+
+        // A handler that disconnects all handlers, including one connected during the same emission
+        widget->onPositionChange.connect([&](){
+                widget->onPositionChange.connect([&](){ count3++; });
+                widget->onPositionChange.disconnectAll();
+            });
+        widget->setPosition(30, 30);
+        REQUIRE(count3 == 2);
+
+        widget->setPosition(40, 40);
+        REQUIRE(count3 == 2);
+        REQUIRE(!widget->onPositionChange.disconnect(id3));
+    }
+
+    SECTION("Emitting while emitting")
+    {
+        auto slider1 = tgui::Slider::create(0, 100);
+        auto slider2 = tgui::Slider::create(0, 100);
+
+        // The second handler still receives the value of the first slider after the second slider emitted its signal
+        std::vector<float> values;
+        slider1->onValueChange.connect([&](float value){ values.push_back(value); slider2->setValue(value / 2); });
+        slider1->onValueChange.connect([&](tgui::Widget::Ptr w, std::string, float value){ REQUIRE(w == slider1); values.push_back(value); });
+        slider2->onValueChange.connect([&](tgui::Widget::Ptr w, std::string, float value){ REQUIRE(w == slider2); values.push_back(value); });
+
+        slider1->setValue(40);
+        REQUIRE(values == std::vector<float>{40, 20, 40});
+    }
+
+    SECTION("Name")
+    {
+        tgui::Signal literalSignal{"Literal"};
+        REQUIRE(literalSignal.getName() == "Literal");
+
+        // A name that isn't a string literal is copied into the signal
+        std::string name = "Dynamic";
+        auto dynamicSignal = tgui::make_unique<tgui::SignalFloat>(std::string{name});
+        name = "Changed";
+        REQUIRE(dynamicSignal->getName() == "Dynamic");
+
+        tgui::SignalFloat copiedSignal{*dynamicSignal};
+        tgui::SignalFloat assignedSignal{"Other"};
+        assignedSignal = copiedSignal;
+        dynamicSignal = nullptr;
+        REQUIRE(copiedSignal.getName() == "Dynamic");
+        REQUIRE(assignedSignal.getName() == "Dynamic");
+
+        tgui::SignalFloat movedSignal{std::move(copiedSignal)};
+        REQUIRE(movedSignal.getName() == "Dynamic");
+
+        // A character buffer is copied as well, only constant arrays are treated as string literals
+        char buffer[] = "Buffer";
+        tgui::Signal bufferSignal{buffer};
+        tgui::SignalRange bufferRangeSignal{buffer};
+        buffer[0] = 'X';
+        REQUIRE(bufferSignal.getName() == "Buffer");
+        REQUIRE(bufferRangeSignal.getName() == "Buffer");
+    }
+}
+
+TEST_CASE("[Signal] emit benchmark", "[.benchmark]")
+{
+    const auto emitPositionChanges = [](tgui::Widget::Ptr widget){
+            for (unsigned int i = 0; i < 100000; ++i)
+                widget->setPosition(static_cast<float>(i % 2), 0);
+        };
+
+    tgui::Widget::Ptr widget = tgui::ClickableWidget::create();
+    BENCHMARK("100000 emissions without handlers")
+    {
+        emitPositionChanges(widget);
+    }
+
+    unsigned int count = 0;
+    widget->onPositionChange.connect([&](tgui::Vector2f){ count++; });
+    BENCHMARK("100000 emissions with 1 handler")
+    {
+        emitPositionChanges(widget);
+    }
+
+    for (unsigned int i = 1; i < 8; ++i)
+        widget->onPositionChange.connect([&](tgui::Vector2f){ count++; });
+    BENCHMARK("100000 emissions with 8 handlers")
+    {
+        emitPositionChanges(widget);
     }
 }
@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/Sprite.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 
 TEST_CASE("[Sprite]")
 {
@@ -511,6 +512,35 @@ TEST_CASE("[Sprite]")
         }
     }
 
+    SECTION("Drawing with a different size")
+    {
+        sf::RenderTexture target;
+        target.create(100, 100);
+
+        sprite.setTexture({"resources/image.png", {}, {10, 5, 30, 40}});
+        sprite.setSize({20, 30});
+        sprite.setPosition({10, 15});
+        sprite.setOpacity(0.5f);
+
+        tgui::Sprite resizedSprite = sprite;
+        resizedSprite.setSize({80, 60});
+        target.clear();
+        resizedSprite.draw(target, {});
+        target.display();
+        const sf::Image expectedImage = target.getTexture().copyToImage();
+
+        target.clear();
+        sprite.draw(target, {}, {80, 60});
+        target.display();
+        const sf::Image image = target.getTexture().copyToImage();
+
+        REQUIRE(std::equal(image.getPixelsPtr(), image.getPixelsPtr() + (100 * 100 * 4), expectedImage.getPixelsPtr()));
+
+        // The sprite itself is left untouched
+        REQUIRE(sprite.getSize() == sf::Vector2f(20, 30));
+        REQUIRE(sprite.getScalingType() == tgui::Sprite::ScalingType::NineSlice);
+    }
+
     SECTION("getTexture has a version to change the texture and a const version")
     {
         sprite.getTexture().setSmooth(false);
@@ -24,6 +24,9 @@
 
 #include "Tests.hpp"
 #include <TGUI/Text.hpp>
+#include <TGUI/GlyphCache.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <cstring>
 
 TEST_CASE("[Text]")
 {
@@ -134,5 +137,193 @@ TEST_CASE("[Text]")
             text3.setFont("resources/DejaVuSans.ttf");
             REQUIRE(text.getSize().y == text3.getSize().y);
         }
+
+        SECTION("Glyph cache")
+        {
+            std::shared_ptr<sf::Font> font = text.getFont();
+            tgui::priv::GlyphCache& glyphCache = tgui::priv::GlyphCache::get(font, 20, false);
+            REQUIRE(&glyphCache == &tgui::priv::GlyphCache::get(font, 20, false));
+            REQUIRE(&glyphCache != &tgui::priv::GlyphCache::get(font, 20, true));
+            REQUIRE(&glyphCache != &tgui::priv::GlyphCache::get(font, 21, false));
+
+            for (const std::uint32_t codePoint : {U'A', U'V', U'\u00CA', U'\u0416', U'\u4E2D'})
+            {
+                REQUIRE(glyphCache.getAdvance(codePoint) == static_cast<float>(font->getGlyph(codePoint, 20, false).advance));
+                REQUIRE(glyphCache.getAdvance(codePoint) == static_cast<float>(font->getGlyph(codePoint, 20, false).advance));
+            }
+
+            REQUIRE(glyphCache.getAdvance('\t') == 4 * glyphCache.getAdvance(' '));
+            REQUIRE(glyphCache.getKerning('A', 'V') == static_cast<float>(font->getKerning('A', 'V', 20)));
+            REQUIRE(glyphCache.getKerning(0, 'V') == 0);
+            REQUIRE(glyphCache.getLineSpacing() == font->getLineSpacing(20));
+            REQUIRE(glyphCache.getExtraVerticalSpace() == tgui::Text::calculateExtraVerticalSpace(font, 20));
+
+            // Replacing the font gives different values when the new font has different glyphs
+            text.setFont(tgui::Font{sf::Font{}});
+            text.setString("xy");
+            REQUIRE(text.getSize().x == 0);
+            text.setFont(font);
+            REQUIRE(text.getSize().x > 0);
+
+            tgui::priv::GlyphCache::invalidate(font.get());
+            REQUIRE(tgui::priv::GlyphCache::get(font, 20, false).getAdvance('A') == static_cast<float>(font->getGlyph('A', 20, false).advance));
+        }
+
+        SECTION("Layout cache")
+        {
+            tgui::priv::TextLayoutCache::clear();
+            tgui::priv::TextLayoutCache::resetStatistics();
+
+            const std::shared_ptr<sf::Font> font = text.getFont();
+            const auto layout = tgui::priv::TextLayoutCache::get(font, 20, sf::Text::Regular, "Item");
+            REQUIRE(layout == tgui::priv::TextLayoutCache::get(font, 20, sf::Text::Regular, "Item"));
+            REQUIRE(layout != tgui::priv::TextLayoutCache::get(font, 21, sf::Text::Regular, "Item"));
+            REQUIRE(layout != tgui::priv::TextLayoutCache::get(font, 20, sf::Text::Bold, "Item"));
+            REQUIRE(layout != tgui::priv::TextLayoutCache::get(font, 20, sf::Text::Regular, "Items"));
+
+            auto statistics = tgui::priv::TextLayoutCache::getStatistics();
+            REQUIRE(statistics.hits == 1);
+            REQUIRE(statistics.misses == 4);
+            REQUIRE(statistics.evictions == 0);
+            REQUIRE(statistics.entryCount == 4);
+            REQUIRE(statistics.memoryUsage > 0);
+
+            // Texts with the same string share their layout but keep their own color
+            text.setCharacterSize(20);
+            text.setColor(sf::Color::Red);
+            tgui::Text text2;
+            text2.setFont(font);
+            text2.setCharacterSize(20);
+
+            const std::size_t hits = tgui::priv::TextLayoutCache::getStatistics().hits;
+            text.setString("Item");
+            text2.setString("Item");
+            REQUIRE(text.getSize() == layout->getSize());
+            REQUIRE(text2.getSize() == layout->getSize());
+            REQUIRE(tgui::priv::TextLayoutCache::getStatistics().hits == hits + 2);
+            REQUIRE(text2.getColor() != text.getColor());
+
+            // The layout is only requested once it is needed, not after every property that changes
+            const std::size_t misses = tgui::priv::TextLayoutCache::getStatistics().misses;
+            tgui::Text text3;
+            text3.setFont(font);
+            text3.setCharacterSize(25);
+            text3.setStyle(sf::Text::Bold);
+            text3.setString("Only one layout");
+            REQUIRE(tgui::priv::TextLayoutCache::getStatistics().misses == misses);
+            text3.getSize();
+            text3.getSize();
+            REQUIRE(tgui::priv::TextLayoutCache::getStatistics().misses == misses + 1);
+
+            // Long strings are not kept in the cache
+            const std::size_t entryCountBeforeLongString = tgui::priv::TextLayoutCache::getStatistics().entryCount;
+            const sf::String longString(std::string(tgui::priv::TextLayoutCache::getMaximumStringLength() + 1, 'x'));
+            REQUIRE(tgui::priv::TextLayoutCache::get(font, 20, sf::Text::Regular, longString)->getSize().x > 0);
+            statistics = tgui::priv::TextLayoutCache::getStatistics();
+            REQUIRE(statistics.entryCount == entryCountBeforeLongString);
+            REQUIRE(statistics.uncached == 1);
+
+            // The least recently used layouts are removed when the cache is full
+            REQUIRE(tgui::priv::TextLayoutCache::getCapacity() > 0);
+            const std::size_t oldCapacity = tgui::priv::TextLayoutCache::getCapacity();
+            const std::size_t entryCount = tgui::priv::TextLayoutCache::getStatistics().entryCount;
+            tgui::priv::TextLayoutCache::setCapacity(2);
+            statistics = tgui::priv::TextLayoutCache::getStatistics();
+            REQUIRE(statistics.entryCount == 2);
+            REQUIRE(statistics.evictions == entryCount - 2);
+            REQUIRE(layout == tgui::priv::TextLayoutCache::get(font, 20, sf::Text::Regular, "Item"));
+
+            // A layout that is no longer in the cache stays valid for the texts that use it
+            tgui::priv::TextLayoutCache::clear();
+            REQUIRE(tgui::priv::TextLayoutCache::getStatistics().entryCount == 0);
+            REQUIRE(text.getSize() == layout->getSize());
+            REQUIRE(layout != tgui::priv::TextLayoutCache::get(font, 20, sf::Text::Regular, "Item"));
+
+            tgui::priv::TextLayoutCache::invalidate(font.get());
+            REQUIRE(tgui::priv::TextLayoutCache::getStatistics().entryCount == 0);
+
+            // The least recently used layouts are also removed when they use too much memory
+            tgui::priv::TextLayoutCache::setCapacity(oldCapacity);
+            for (unsigned int i = 0; i < 10; ++i)
+                tgui::priv::TextLayoutCache::get(font, 20, sf::Text::Regular, "Item " + std::to_string(i));
+
+            statistics = tgui::priv::TextLayoutCache::getStatistics();
+            REQUIRE(statistics.entryCount == 10);
+
+            const std::size_t oldMemoryLimit = tgui::priv::TextLayoutCache::getMemoryLimit();
+            tgui::priv::TextLayoutCache::setMemoryLimit(statistics.memoryUsage / 2);
+            statistics = tgui::priv::TextLayoutCache::getStatistics();
+            REQUIRE(statistics.entryCount < 10);
+            REQUIRE(statistics.memoryUsage <= tgui::priv::TextLayoutCache::getMemoryLimit());
+
+            tgui::priv::TextLayoutCache::setMemoryLimit(oldMemoryLimit);
+        }
+
+        SECTION("Drawn like sf::Text")
+        {
+            const std::shared_ptr<sf::Font> font = text.getFont();
+            text.setCharacterSize(24);
+            text.setString(L"Text\tT\u00EAst\n AV\nxyz");
+            text.setColor({200, 100, 50, 150});
+
+            sf::Text sfText{text.getString(), *font, 24};
+        #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+            sfText.setFillColor({200, 100, 50, 150});
+        #else
+            sfText.setColor({200, 100, 50, 150});
+        #endif
+
+            for (const unsigned int style : {static_cast<unsigned int>(sf::Text::Regular),
+                                             static_cast<unsigned int>(sf::Text::Bold | sf::Text::Italic | sf::Text::Underlined)})
+            {
+                text.setStyle(style);
+                sfText.setStyle(style);
+
+                sf::RenderTexture target;
+                target.create(200, 120);
+
+                target.clear(sf::Color::Blue);
+                target.draw(sfText);
+                const sf::Image expectedImage = target.getTexture().copyToImage();
+
+                target.clear(sf::Color::Blue);
+                text.draw(target, {});
+                const sf::Image image = target.getTexture().copyToImage();
+
+                REQUIRE(std::memcmp(image.getPixelsPtr(), expectedImage.getPixelsPtr(), 200 * 120 * 4) == 0);
+            }
+        }
+    }
+}
+
+TEST_CASE("[Text] word wrap benchmark", "[.benchmark]")
+{
+    const sf::String sentence = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt.\n";
+    sf::String text;
+    while (text.getSize() < 1024 * 1024)
+        text += sentence;
+
+    const tgui::Font font{"resources/DejaVuSans.ttf"};
+    BENCHMARK("Word-wrapping 1 MB of text")
+    {
+        tgui::Text::wordWrap(300, text, font, 14, false);
+    }
+}
+
+TEST_CASE("[Text] layout cache benchmark", "[.benchmark]")
+{
+    const tgui::Font font{"resources/DejaVuSans.ttf"};
+    std::vector<tgui::Text> texts(1000);
+    for (auto& text : texts)
+    {
+        text.setFont(font);
+        text.setCharacterSize(14);
+    }
+
+    // Many list items, menu entries and buttons display one of a small amount of strings
+    BENCHMARK("Setting the string of 1000 texts to one of 10 strings")
+    {
+        for (std::size_t i = 0; i < texts.size(); ++i)
+            texts[i].setString("Item " + std::to_string(i % 10));
     }
 }
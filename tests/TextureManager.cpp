@@ -26,6 +26,10 @@
 #include <TGUI/TextureManager.hpp>
 #include <TGUI/Exception.hpp>
 #include <TGUI/Texture.hpp>
+#include <TGUI/Sprite.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/Picture.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/System/Err.hpp>
 
 TEST_CASE("[TextureManager]")
@@ -53,3 +57,109 @@ TEST_CASE("[TextureManager]")
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
     REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(textureData1), tgui::Exception);
 }
+
+TEST_CASE("[TextureManager] Texture atlas")
+{
+    const auto statsBefore = tgui::TextureManager::getStatistics();
+
+    tgui::TextureManager::setAtlasEnabled(true);
+    REQUIRE(tgui::TextureManager::isAtlasEnabled());
+
+    {
+        tgui::Texture part1{"resources/image.png", {0, 0, 20, 20}};
+        tgui::Texture part2{"resources/image.png", {20, 10, 30, 40}};
+        tgui::Texture full1{"resources/Texture1.png"};
+        tgui::Texture full2{"resources/Texture2.png"};
+
+        SECTION("Parts of the same image")
+        {
+            REQUIRE(part1.getData()->atlasTexture != nullptr);
+            REQUIRE(part1.getData()->atlasTexture == part2.getData()->atlasTexture);
+            REQUIRE(part1.getData()->image == part2.getData()->image);
+            REQUIRE(&part1.getData()->getTexture() == part1.getData()->atlasTexture.get());
+            REQUIRE(part2.getData()->atlasOffset == sf::Vector2u(20, 10));
+            REQUIRE(part2.getData()->getSize() == sf::Vector2u(30, 40));
+            REQUIRE(part2.getImageSize() == sf::Vector2f(30, 40));
+        }
+
+        SECTION("Small images")
+        {
+            REQUIRE(full1.getData()->atlasTexture != nullptr);
+            REQUIRE(full1.getData()->atlasTexture == full2.getData()->atlasTexture);
+            REQUIRE(full1.getData()->atlasOffset != full2.getData()->atlasOffset);
+            REQUIRE(full2.getImageSize() == sf::Vector2f(50, 50));
+        }
+
+        SECTION("Statistics")
+        {
+            const auto stats = tgui::TextureManager::getStatistics();
+            REQUIRE(stats.textureCount == statsBefore.textureCount + 4);
+            REQUIRE(stats.atlasTextureCount == statsBefore.atlasTextureCount + 4);
+            REQUIRE(stats.atlasPageCount == statsBefore.atlasPageCount + 1);
+            REQUIRE(stats.gpuTextureCount == statsBefore.gpuTextureCount + 2);
+            REQUIRE(stats.imageCount == statsBefore.imageCount + 3);
+            REQUIRE(stats.gpuMemoryWithoutAtlas == statsBefore.gpuMemoryWithoutAtlas + (20*20 + 30*40 + 50*50 + 50*50) * 4);
+        }
+
+        SECTION("Smooth textures are moved out of the atlas")
+        {
+            full2.setSmooth(true);
+            REQUIRE(full2.isSmooth());
+            REQUIRE(full2.getData()->atlasTexture == nullptr);
+            REQUIRE(full2.getData()->texture.getSize() == sf::Vector2u(50, 50));
+            REQUIRE(!full1.isSmooth());
+            REQUIRE(tgui::TextureManager::getStatistics().gpuTextureCount == statsBefore.gpuTextureCount + 3);
+        }
+
+        SECTION("Drawing")
+        {
+            sf::RenderTexture target;
+            target.create(30, 40);
+            target.clear(sf::Color::Transparent);
+
+            tgui::Sprite sprite;
+            sprite.setTexture(part2);
+            sprite.draw(target, {});
+            target.display();
+
+            const sf::Image image = target.getTexture().copyToImage();
+            for (unsigned int y = 0; y < 40; y += 13)
+            {
+                for (unsigned int x = 0; x < 30; x += 7)
+                    REQUIRE(image.getPixel(x, y) == part2.getData()->image->getPixel(20 + x, 10 + y));
+            }
+        }
+    }
+
+    tgui::TextureManager::setAtlasEnabled(false);
+    REQUIRE(!tgui::TextureManager::isAtlasEnabled());
+    REQUIRE(tgui::TextureManager::getStatistics().textureCount == statsBefore.textureCount);
+
+    tgui::Texture texture{"resources/image.png", {0, 0, 20, 20}};
+    REQUIRE(texture.getData()->atlasTexture == nullptr);
+    REQUIRE(texture.getData()->texture.getSize() == sf::Vector2u(20, 20));
+}
+
+TEST_CASE("[TextureManager] copy benchmark", "[.benchmark]")
+{
+    // Every picture uses a different part of the image, so that every copy has to find its own texture in the manager
+    const auto createPanel = [](unsigned int widgetCount){
+            auto panel = tgui::Panel::create();
+            for (unsigned int i = 0; i < widgetCount; ++i)
+                panel->add(tgui::Picture::create({"resources/image.png", {static_cast<int>(i % 50), static_cast<int>((i / 50) % 50), 1, 1}}));
+
+            return panel;
+        };
+
+    const auto panel1000 = createPanel(1000);
+    BENCHMARK("Copying a panel with 1000 textured widgets")
+    {
+        tgui::Panel::copy(panel1000);
+    }
+
+    const auto panel2000 = createPanel(2000);
+    BENCHMARK("Copying a panel with 2000 textured widgets")
+    {
+        tgui::Panel::copy(panel2000);
+    }
+}
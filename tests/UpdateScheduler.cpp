@@ -0,0 +1,201 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Animation.hpp>
+#include <TGUI/Widgets/ClickableWidget.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/UpdateScheduler.hpp>
+#include <TGUI/Gui.hpp>
+#include <limits>
+#include <new>
+
+TEST_CASE("[UpdateScheduler]")
+{
+    tgui::Gui gui;
+    const sf::Time noWakeup = sf::microseconds(std::numeric_limits<sf::Int64>::max());
+
+    // Widgets get updated once after being added, in case they were waiting for time before
+    gui.updateTime(sf::milliseconds(10));
+    REQUIRE(gui.getNextWakeupTime() == noWakeup);
+
+    SECTION("Idle widgets don't need updates")
+    {
+        gui.add(tgui::ClickableWidget::create());
+        gui.add(tgui::Label::create("Text"));
+        REQUIRE(gui.getNextWakeupTime() == sf::Time::Zero);
+
+        gui.updateTime(sf::milliseconds(10));
+        REQUIRE(gui.getNextWakeupTime() == noWakeup);
+    }
+
+    SECTION("Animation")
+    {
+        auto widget = tgui::ClickableWidget::create();
+        gui.add(widget);
+        gui.updateTime(sf::milliseconds(10));
+
+        widget->hideWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(300));
+        REQUIRE(gui.getNextWakeupTime() == sf::Time::Zero);
+
+        gui.updateTime(sf::milliseconds(200));
+        REQUIRE(widget->isVisible());
+        REQUIRE(gui.getNextWakeupTime() == sf::Time::Zero);
+
+        gui.updateTime(sf::milliseconds(200));
+        REQUIRE(!widget->isVisible());
+        REQUIRE(gui.getNextWakeupTime() == noWakeup);
+    }
+
+    SECTION("Animation started before the widget was added to the gui")
+    {
+        auto panel = tgui::Panel::create();
+        auto widget = tgui::ClickableWidget::create();
+        panel->add(widget);
+
+        widget->hideWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(300));
+        gui.add(panel);
+
+        gui.updateTime(sf::milliseconds(400));
+        REQUIRE(!widget->isVisible());
+    }
+
+    SECTION("Double click timer")
+    {
+        auto label = tgui::Label::create("Text");
+        label->setSize(100, 50);
+        gui.add(label);
+        gui.updateTime(sf::milliseconds(10));
+
+        label->leftMousePressed({10, 10});
+        label->leftMouseReleased({10, 10});
+        REQUIRE(gui.getNextWakeupTime() == DOUBLE_CLICK_TIMEOUT);
+
+        gui.updateTime(DOUBLE_CLICK_TIMEOUT / 2.f);
+        REQUIRE(gui.getNextWakeupTime() == DOUBLE_CLICK_TIMEOUT / 2.f);
+
+        gui.updateTime(DOUBLE_CLICK_TIMEOUT / 2.f);
+        REQUIRE(gui.getNextWakeupTime() == noWakeup);
+    }
+
+    SECTION("Blinking caret")
+    {
+        auto editBox = tgui::EditBox::create();
+        gui.add(editBox);
+        gui.updateTime(sf::milliseconds(10));
+        REQUIRE(gui.getNextWakeupTime() == noWakeup);
+
+        editBox->setFocused(true);
+        REQUIRE(gui.getNextWakeupTime() == sf::milliseconds(500));
+
+        gui.updateTime(sf::milliseconds(200));
+        REQUIRE(gui.getNextWakeupTime() == sf::milliseconds(300));
+
+        gui.updateTime(sf::milliseconds(300));
+        REQUIRE(gui.getNextWakeupTime() == sf::milliseconds(500));
+
+        editBox->setFocused(false);
+        gui.updateTime(sf::milliseconds(10));
+        REQUIRE(gui.getNextWakeupTime() == noWakeup);
+    }
+
+    SECTION("Removed widgets are no longer updated")
+    {
+        auto widget = tgui::ClickableWidget::create();
+        gui.add(widget);
+        gui.updateTime(sf::milliseconds(10));
+
+        widget->showWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(300));
+        gui.remove(widget);
+
+        gui.updateTime(sf::milliseconds(400));
+        REQUIRE(gui.getNextWakeupTime() == noWakeup);
+        REQUIRE(widget->getAnimatedOpacity() == 0);
+    }
+
+    SECTION("Hidden widgets are not updated")
+    {
+        auto panel = tgui::Panel::create();
+        auto widget = tgui::ClickableWidget::create();
+        panel->add(widget);
+        gui.add(panel);
+        gui.updateTime(sf::milliseconds(10));
+
+        widget->showWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(300));
+        panel->setVisible(false);
+
+        gui.updateTime(sf::milliseconds(400));
+        REQUIRE(gui.getNextWakeupTime() == noWakeup);
+        REQUIRE(widget->getAnimatedOpacity() == 0);
+
+        // The animation continues when the panel is shown again
+        panel->setVisible(true);
+        REQUIRE(gui.getNextWakeupTime() == sf::Time::Zero);
+
+        gui.updateTime(sf::milliseconds(400));
+        REQUIRE(widget->getAnimatedOpacity() == 1);
+    }
+
+    SECTION("Widget created at the address of a destroyed widget")
+    {
+        alignas(tgui::ClickableWidget) unsigned char memory[sizeof(tgui::ClickableWidget)];
+        const auto destroyWidget = [](tgui::ClickableWidget* widget){ widget->~ClickableWidget(); };
+
+        tgui::priv::UpdateScheduler scheduler;
+        auto widget = std::shared_ptr<tgui::ClickableWidget>(new (memory) tgui::ClickableWidget, destroyWidget);
+        scheduler.schedule(*widget, sf::milliseconds(100));
+        widget = nullptr;
+
+        widget = std::shared_ptr<tgui::ClickableWidget>(new (memory) tgui::ClickableWidget, destroyWidget);
+        widget->hideWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(300));
+        scheduler.schedule(*widget, {});
+
+        scheduler.update(sf::milliseconds(400), *widget);
+        REQUIRE(!widget->isVisible());
+    }
+}
+
+TEST_CASE("[UpdateScheduler] idle gui benchmark", "[.benchmark]")
+{
+    tgui::Gui gui;
+    for (unsigned int i = 0; i < 100; ++i)
+    {
+        auto panel = tgui::Panel::create();
+        for (unsigned int j = 0; j < 100; ++j)
+            panel->add(tgui::Label::create("Text"));
+
+        gui.add(panel);
+    }
+
+    gui.updateTime(sf::milliseconds(10));
+
+    BENCHMARK("Updating the time of 10000 idle widgets")
+    {
+        for (unsigned int i = 0; i < 1000; ++i)
+            gui.updateTime(sf::milliseconds(16));
+    }
+}
@@ -26,6 +26,25 @@
 #include <TGUI/Gui.hpp>
 #include <TGUI/Widgets/Panel.hpp>
 #include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Loading/WidgetFactory.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+namespace
+{
+    // Widget from outside the library, which passes colors to the draw helpers without applying the opacity itself
+    class CustomWidget : public tgui::ClickableWidget
+    {
+    public:
+        void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+        {
+            states.transform.translate(getPosition());
+            drawBorders(target, states, {2}, getSize(), sf::Color::Blue);
+
+            states.transform.translate({2, 2});
+            drawRectangleShape(target, states, getSize() - sf::Vector2f{4, 4}, sf::Color::Red);
+        }
+    };
+}
 
 TEST_CASE("[Widget]")
 {
@@ -277,9 +296,72 @@ TEST_CASE("[Widget]")
             REQUIRE(clonedRenderer->propertyValuePairs["font"].getFont().getId() == "resources/DejaVuSans.ttf");
         }
 
+        SECTION("Property map")
+        {
+            static_assert(tgui::priv::makePropertyId("TextColor") == tgui::priv::makePropertyId("textcolor"), "Property ids should be case-insensitive");
+            REQUIRE(tgui::priv::makePropertyId(std::string{"TextColor"}) == tgui::priv::makePropertyId("textcolor"));
+
+            tgui::RendererPropertyMap properties;
+            properties["opacity"] = {0.5f};
+            properties["textcolor"] = {sf::Color::Red};
+            REQUIRE(properties.size() == 2);
+            REQUIRE(properties.find(tgui::priv::makePropertyId("TextColor"), "TextColor") == properties.find("textcolor"));
+            REQUIRE(properties.find(tgui::priv::makePropertyId("BackgroundColor"), "BackgroundColor") == properties.end());
+
+            // A property with the same identifier but a different name is not returned
+            REQUIRE(properties.find(tgui::priv::makePropertyId("textcolor"), "bordercolor") == properties.end());
+            REQUIRE(properties.find(tgui::priv::makePropertyId("textcolor"), "textcolo") == properties.end());
+
+            auto copiedProperties = properties;
+            REQUIRE(properties.erase("textcolor") == 1);
+            REQUIRE(properties.find(tgui::priv::makePropertyId("textcolor"), "textcolor") == properties.end());
+            REQUIRE(copiedProperties.find(tgui::priv::makePropertyId("textcolor"), "textcolor")->second.getColor() == sf::Color::Red);
+
+            properties["textcolor"] = {sf::Color::Blue};
+            REQUIRE(properties.find(tgui::priv::makePropertyId("textcolor"), "textcolor")->second.getColor() == sf::Color::Blue);
+            REQUIRE(properties.find(tgui::priv::makePropertyId("opacity"), "opacity")->second.getNumber() == 0.5f);
+
+            // Values don't move when other properties are added
+            tgui::ObjectConverter& opacity = properties.insert(tgui::priv::makePropertyId("Opacity"), "Opacity")->second;
+            for (const char* name : {"BorderColor", "BackgroundColor", "Borders", "Padding"})
+                properties.insert(tgui::priv::makePropertyId(name), name);
+            REQUIRE(&opacity == &properties["opacity"]);
+            REQUIRE(properties.size() == 6);
+
+            // The last property takes the place of a removed one
+            REQUIRE(properties.erase("opacity") == 1);
+            REQUIRE(properties.erase("opacity") == 0);
+            REQUIRE(properties.find("padding") != properties.end());
+            REQUIRE(properties.find(tgui::priv::makePropertyId("Padding"), "Padding")->first == "padding");
+            REQUIRE(properties.find(tgui::priv::makePropertyId("textcolor"), "textcolor")->second.getColor() == sf::Color::Blue);
+            REQUIRE(properties.getMap().size() == 5);
+        }
+
         // TODO: Other tests with the renderer class (e.g. sharing and copying a renderer when using multiple widgets)
     }
 
+    SECTION("Draw helpers apply the opacity")
+    {
+        auto customWidget = std::make_shared<CustomWidget>();
+        customWidget->setSize(20, 20);
+        customWidget->getRenderer()->setOpacity(0.5f);
+
+        sf::RenderTexture target;
+        target.create(20, 20);
+        tgui::Gui gui{target};
+        gui.add(customWidget);
+
+        target.clear(sf::Color::Black);
+        gui.draw();
+        target.display();
+
+        const sf::Image image = target.getTexture().copyToImage();
+        REQUIRE(image.getPixel(0, 0).b >= 127);
+        REQUIRE(image.getPixel(0, 0).b <= 128);
+        REQUIRE(image.getPixel(10, 10).r >= 127);
+        REQUIRE(image.getPixel(10, 10).r <= 128);
+    }
+
     SECTION("Saving and loading widget from file")
     {
         auto parent = tgui::Panel::create();
@@ -299,6 +381,24 @@ TEST_CASE("[Widget]")
         REQUIRE(!parent->get("Widget Name.With:Special{Chars}")->isEnabled());
     }
 
+    SECTION("Saving and loading widget from binary file")
+    {
+        auto parent = tgui::Panel::create();
+        parent->add(widget, "Widget Name.With:Special{Chars}");
+
+        widget->setVisible(false);
+        widget->setPosition(50, "15%");
+        widget->setSize("30%", "70");
+
+        REQUIRE_NOTHROW(parent->saveWidgetsToFile("WidgetFileClickableWidget1.txt"));
+        REQUIRE_NOTHROW(parent->saveWidgetsToBinary("WidgetFileClickableWidget.tguibin"));
+        REQUIRE_NOTHROW(parent->loadWidgetsFromBinary("WidgetFileClickableWidget.tguibin"));
+        REQUIRE_NOTHROW(parent->saveWidgetsToFile("WidgetFileClickableWidget2.txt"));
+        REQUIRE(compareFiles("WidgetFileClickableWidget1.txt", "WidgetFileClickableWidget2.txt"));
+
+        REQUIRE(!parent->get("Widget Name.With:Special{Chars}")->isVisible());
+    }
+
     SECTION("Bug Fixes")
     {
         SECTION("Disabled widgets should not be focusable (https://forum.tgui.eu/index.php?topic=384)")
@@ -318,3 +418,31 @@ TEST_CASE("[Widget]")
         }
     }
 }
+
+TEST_CASE("[Widget] setRenderer benchmark", "[.benchmark]")
+{
+    const std::vector<std::string> widgetTypes = {
+        "BitmapButton", "Button", "ChatBox", "CheckBox", "ChildWindow", "ComboBox", "EditBox", "Knob", "Label", "ListBox",
+        "MenuBar", "MessageBox", "Panel", "Picture", "ProgressBar", "RadioButton", "RangeSlider", "ScrollablePanel",
+        "Scrollbar", "Slider", "SpinButton", "Tabs", "TextBox"
+    };
+
+    tgui::Theme blackTheme{"resources/Black.txt"};
+    std::vector<std::pair<tgui::Widget::Ptr, std::string>> widgets;
+    for (const auto& type : widgetTypes)
+    {
+        const std::string rendererName = (type == "BitmapButton") ? "Button" : type;
+        widgets.emplace_back(tgui::WidgetFactory::getConstructFunction(type)(), rendererName);
+    }
+
+    BENCHMARK("Switching the renderer of every widget type 100 times")
+    {
+        for (unsigned int i = 0; i < 50; ++i)
+        {
+            for (auto& pair : widgets)
+                pair.first->setRenderer(blackTheme.getRendererNoThrow(pair.second));
+            for (auto& pair : widgets)
+                pair.first->setRenderer(tgui::Theme::getDefault()->getRendererNoThrow(pair.second));
+        }
+    }
+}
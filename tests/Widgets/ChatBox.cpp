@@ -124,6 +124,22 @@ TEST_CASE("[ChatBox]")
             REQUIRE(chatBox->getLine(0) == "Line 4");
             REQUIRE(chatBox->getLine(1) == "Line 3");
         }
+
+        SECTION("Many lines")
+        {
+            chatBox->setSize(200, 100);
+            chatBox->setLineLimit(100);
+            for (unsigned int i = 0; i < 1000; ++i)
+                chatBox->addLine("Line " + std::to_string(i));
+
+            REQUIRE(chatBox->getLineAmount() == 100);
+            REQUIRE(chatBox->getLine(0) == "Line 900");
+            REQUIRE(chatBox->getLine(99) == "Line 999");
+
+            REQUIRE(chatBox->removeLine(0));
+            REQUIRE(chatBox->getLine(0) == "Line 901");
+            REQUIRE(chatBox->getLineAmount() == 99);
+        }
     }
 
     SECTION("Text size")
@@ -260,3 +276,24 @@ TEST_CASE("[ChatBox]")
         REQUIRE(chatBox->getLine(3) == "L2");
     }
 }
+
+TEST_CASE("[ChatBox] append benchmark", "[.benchmark]")
+{
+    auto chatBox = tgui::ChatBox::create();
+    chatBox->getRenderer()->setFont("resources/DejaVuSans.ttf");
+    chatBox->setSize(400, 300);
+
+    BENCHMARK("Adding 100000 lines")
+    {
+        for (unsigned int i = 0; i < 100000; ++i)
+            chatBox->addLine("Line " + std::to_string(i) + " of the chat that is being shown in the chat box");
+    }
+
+    BENCHMARK("Adding 100000 lines with a line limit of 1000")
+    {
+        chatBox->removeAllLines();
+        chatBox->setLineLimit(1000);
+        for (unsigned int i = 0; i < 100000; ++i)
+            chatBox->addLine("Line " + std::to_string(i) + " of the chat that is being shown in the chat box");
+    }
+}
@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Clipboard.hpp>
 
 TEST_CASE("[EditBox]")
 {
@@ -319,6 +320,92 @@ TEST_CASE("[EditBox]")
                 REQUIRE(editBox->getText() == "-.");
             }
         }
+
+        SECTION("Custom")
+        {
+            editBox->setInputValidator("[A-Z]{1,3}(-[0-9]+)?");
+            REQUIRE(editBox->getInputValidator() == "[A-Z]{1,3}(-[0-9]+)?");
+            REQUIRE(editBox->getText() == "");
+
+            editBox->setText("AB-12");
+            REQUIRE(editBox->getText() == "AB-12");
+
+            editBox->setText("ABCD");
+            REQUIRE(editBox->getText() == "");
+
+            SECTION("Adding characters")
+            {
+                editBox->setText("AB");
+                editBox->textEntered('C');
+                REQUIRE(editBox->getText() == "ABC");
+
+                editBox->textEntered('D');
+                REQUIRE(editBox->getText() == "ABC");
+
+                editBox->textEntered('1');
+                REQUIRE(editBox->getText() == "ABC");
+
+                // The text only has to match again after the character was added
+                editBox->textEntered('-');
+                REQUIRE(editBox->getText() == "ABC");
+
+                editBox->setInputValidator("[A-Z]{1,3}(-[0-9]*)?");
+                editBox->setText("ABC");
+                editBox->textEntered('-');
+                editBox->textEntered('4');
+                REQUIRE(editBox->getText() == "ABC-4");
+
+                // Insert characters in front of the caret
+                editBox->setCaretPosition(1);
+                editBox->textEntered('Z');
+                REQUIRE(editBox->getText() == "ABC-4");
+
+                editBox->setCaretPosition(4);
+                editBox->textEntered('2');
+                REQUIRE(editBox->getText() == "ABC-24");
+
+                editBox->selectText(0, 3);
+                editBox->textEntered('X');
+                REQUIRE(editBox->getText() == "X-24");
+            }
+        }
+
+        SECTION("Unicode")
+        {
+            editBox->setInputValidator("[^0-9]*");
+            REQUIRE(editBox->getText() == "");
+
+            editBox->setText(L"Ê Text");
+            REQUIRE(editBox->getText() == L"Ê Text");
+
+            editBox->textEntered(L'\u00C9');
+            editBox->textEntered('5');
+            REQUIRE(editBox->getText() == L"Ê Text\u00C9");
+        }
+
+        SECTION("Paste")
+        {
+            editBox->setInputValidator(tgui::EditBox::Validator::UInt);
+            editBox->setText("12");
+            editBox->setCaretPosition(1);
+
+            sf::Event::KeyEvent keyEvent;
+            keyEvent.code = sf::Keyboard::V;
+            keyEvent.alt = false;
+            keyEvent.control = true;
+            keyEvent.shift = false;
+            keyEvent.system = false;
+
+            tgui::Clipboard::set("345");
+            editBox->keyPressed(keyEvent);
+            REQUIRE(editBox->getText() == "13452");
+            REQUIRE(editBox->getCaretPosition() == 4);
+
+            // Pasting text that does not match clears the edit box, just like calling setText
+            tgui::Clipboard::set("x");
+            editBox->keyPressed(keyEvent);
+            REQUIRE(editBox->getText() == "");
+        }
     }
 
     SECTION("Events / Signals")
@@ -765,3 +852,57 @@ TEST_CASE("[EditBox]")
         }
     }
 }
+
+TEST_CASE("[EditBox] input validator benchmark", "[.benchmark]")
+{
+    auto editBox = tgui::EditBox::create();
+    editBox->getRenderer()->setFont("resources/DejaVuSans.ttf");
+    editBox->setSize(400, 30);
+
+    sf::Event::KeyEvent keyEvent;
+    keyEvent.code = sf::Keyboard::V;
+    keyEvent.alt = false;
+    keyEvent.control = true;
+    keyEvent.shift = false;
+    keyEvent.system = false;
+
+    std::string digits(100000, '0');
+    for (std::size_t i = 0; i < digits.length(); ++i)
+        digits[i] = static_cast<char>('0' + (i % 10));
+
+    const auto paste = [&](const std::string& validator, const std::string& contents){
+            editBox->setInputValidator(validator);
+            editBox->setText("");
+            tgui::Clipboard::set(contents);
+            editBox->keyPressed(keyEvent);
+            REQUIRE(editBox->getText().getSize() == contents.length());
+        };
+
+    BENCHMARK("Pasting 100000 characters with the UInt validator")
+    {
+        paste(tgui::EditBox::Validator::UInt, digits);
+    }
+
+    BENCHMARK("Pasting 100000 characters with the Float validator")
+    {
+        paste(tgui::EditBox::Validator::Float, "-" + digits + ".5");
+    }
+
+    std::string groupedNumber = "100";
+    while (groupedNumber.length() < 100000)
+        groupedNumber += ",000";
+
+    BENCHMARK("Pasting 100000 characters with a custom validator")
+    {
+        paste("([0-9]{1,3}(,[0-9]{3})*)?", groupedNumber);
+    }
+
+    editBox->setInputValidator("[0-9]+(\\.[0-9]*)?");
+    editBox->setText(digits);
+    editBox->setCaretPosition(50000);
+    BENCHMARK("Typing 100 characters in the middle of 100000 validated characters")
+    {
+        for (unsigned int i = 0; i < 100; ++i)
+            editBox->textEntered('7');
+    }
+}
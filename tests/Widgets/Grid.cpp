@@ -58,6 +58,16 @@ TEST_CASE("[Grid]")
         REQUIRE(grid->getWidget(0, 0) == widget2);
         REQUIRE(grid->getWidgetBorders(0, 0) == tgui::Borders(1, 2, 3, 4));
         REQUIRE(grid->getWidgetAlignment(0, 0) == tgui::Grid::Alignment::UpperLeft);
+
+        // Placing a widget in an occupied cell replaces the old widget, which no longer affects the grid
+        auto widget3 = tgui::ClickableWidget::create({30, 15});
+        grid->addWidget(widget3, 0, 0);
+        REQUIRE(grid->getWidget(0, 0) == widget3);
+        REQUIRE(grid->getWidgetLocations().count(widget2) == 0);
+
+        const sf::Vector2f gridSize = grid->getSize();
+        widget2->setSize({300, 200});
+        REQUIRE(grid->getSize() == gridSize);
     }
 
     SECTION("Removing widgets")
@@ -108,6 +118,64 @@ TEST_CASE("[Grid]")
         REQUIRE(grid->getWidgetAlignment(0, 0) == tgui::Grid::Alignment::Center);
     }
 
+    SECTION("Resizing widgets")
+    {
+        // Fills a grid with widgets of which the size depends on their cell
+        const auto fillGrid = [](tgui::Grid::Ptr g, float changedWidth){
+                for (unsigned int row = 0; row < 4; ++row)
+                {
+                    for (unsigned int col = 0; col < 3; ++col)
+                    {
+                        const float width = ((row == 1) && (col == 1)) ? changedWidth : 10.f + col;
+                        g->addWidget(tgui::ClickableWidget::create({width, 5.f + row}), row, col, {1}, tgui::Grid::Alignment::Right);
+                    }
+                }
+            };
+
+        fillGrid(grid, 10);
+        REQUIRE(grid->getSize() == sf::Vector2f(3*2 + 10 + 11 + 12, 4*2 + 5 + 6 + 7 + 8));
+        REQUIRE(grid->getWidget(1, 2)->getPosition() == sf::Vector2f(12 + 13 + 1, 7 + 1));
+
+        // Only the changed row and column are measured again, but the result is the same as building the grid from scratch
+        auto expectedGrid = tgui::Grid::create();
+        fillGrid(expectedGrid, 30);
+
+        grid->getWidget(1, 1)->setSize({30, 6});
+        REQUIRE(grid->getSize() == expectedGrid->getSize());
+        for (unsigned int row = 0; row < 4; ++row)
+        {
+            for (unsigned int col = 0; col < 3; ++col)
+                REQUIRE(grid->getWidget(row, col)->getPosition() == expectedGrid->getWidget(row, col)->getPosition());
+        }
+
+        // Shrinking the widget again restores the original column width
+        grid->getWidget(1, 1)->setSize({10, 6});
+        REQUIRE(grid->getSize() == sf::Vector2f(3*2 + 10 + 11 + 12, 4*2 + 5 + 6 + 7 + 8));
+        REQUIRE(grid->getWidget(1, 2)->getPosition() == sf::Vector2f(12 + 13 + 1, 7 + 1));
+    }
+
+    SECTION("Suspending the layout")
+    {
+        REQUIRE(!grid->isLayoutSuspended());
+        grid->setLayoutSuspended(true);
+        REQUIRE(grid->isLayoutSuspended());
+
+        auto widget1 = tgui::ClickableWidget::create({20, 10});
+        auto widget2 = tgui::ClickableWidget::create({30, 15});
+        grid->addWidget(widget1, 0, 0);
+        grid->addWidget(widget2, 0, 1);
+
+        // Nothing is positioned until the layout is resumed
+        REQUIRE(grid->getSize() == sf::Vector2f(0, 0));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(0, 0));
+
+        grid->setLayoutSuspended(false);
+        REQUIRE(!grid->isLayoutSuspended());
+        REQUIRE(grid->getSize() == sf::Vector2f(50, 15));
+        REQUIRE(widget1->getPosition() == sf::Vector2f(0, 2.5f));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(20, 0));
+    }
+
     SECTION("Saving and loading from file")
     {
         grid->setSize({800, 600});
@@ -127,3 +195,52 @@ TEST_CASE("[Grid]")
         testSavingWidget("Grid", grid, false);
     }
 }
+
+TEST_CASE("[Grid] layout benchmark", "[.benchmark]")
+{
+    // A grid of 100 rows and 20 columns
+    const auto fillGrid = [](tgui::Grid& grid){
+            for (unsigned int row = 0; row < 100; ++row)
+            {
+                for (unsigned int col = 0; col < 20; ++col)
+                    grid.addWidget(tgui::ClickableWidget::create({40, 20}), row, col, {2});
+            }
+        };
+
+    BENCHMARK("Building a 100x20 grid")
+    {
+        auto grid = tgui::Grid::create();
+        fillGrid(*grid);
+    }
+
+    BENCHMARK("Building a 100x20 grid while the layout is suspended")
+    {
+        auto grid = tgui::Grid::create();
+        grid->setLayoutSuspended(true);
+        fillGrid(*grid);
+        grid->setLayoutSuspended(false);
+    }
+
+    auto grid = tgui::Grid::create();
+    fillGrid(*grid);
+
+    BENCHMARK("Resizing every widget in a 100x20 grid")
+    {
+        for (const auto& widget : grid->getWidgets())
+            widget->setSize({50, 25});
+        for (const auto& widget : grid->getWidgets())
+            widget->setSize({40, 20});
+    }
+
+    BENCHMARK("Resizing every widget in a 100x20 grid while the layout is suspended")
+    {
+        grid->setLayoutSuspended(true);
+        for (const auto& widget : grid->getWidgets())
+            widget->setSize({50, 25});
+        for (const auto& widget : grid->getWidgets())
+            widget->setSize({40, 20});
+        grid->setLayoutSuspended(false);
+    }
+
+    WARN("Grid size: " << grid->getSize().x << "x" << grid->getSize().y);
+}
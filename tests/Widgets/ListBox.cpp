@@ -142,6 +142,21 @@ TEST_CASE("[ListBox]")
         REQUIRE(listBox->removeItemById("4"));
         REQUIRE(listBox->getItemCount() == 1);
         REQUIRE(listBox->getItems()[0] == "Item 3");
+
+        // The ids of the items below a removed item still refer to the correct item
+        listBox->addItem("Item 7", "7");
+        listBox->addItem("Item 8", "8");
+        listBox->addItem("Item 9", "7");
+        REQUIRE(listBox->removeItemByIndex(0));
+        REQUIRE(listBox->getItemById("7") == "Item 7");
+        REQUIRE(listBox->getItemById("8") == "Item 8");
+        REQUIRE(listBox->removeItemById("7"));
+        REQUIRE(listBox->getItemById("7") == "Item 9");
+        REQUIRE(listBox->getItemById("8") == "Item 8");
+        REQUIRE(listBox->removeItemByIndex(1));
+        REQUIRE(listBox->getItemById("7") == "");
+        REQUIRE(listBox->getItemCount() == 1);
+        listBox->removeAllItems();
         
         listBox->addItem("Item 5");
         listBox->addItem("Item 5");
@@ -246,6 +261,34 @@ TEST_CASE("[ListBox]")
         REQUIRE(!listBox->containsId("1"));
     }
 
+    SECTION("Many items")
+    {
+        listBox->setSize(200, 100);
+        listBox->setItemHeight(20);
+        for (unsigned int i = 0; i < 10000; ++i)
+            listBox->addItem("Item " + std::to_string(i), std::to_string(i));
+
+        REQUIRE(listBox->getItemCount() == 10000);
+        REQUIRE(listBox->getItemById("9999") == "Item 9999");
+        REQUIRE(listBox->containsId("5000"));
+
+        REQUIRE(listBox->setSelectedItemById("42"));
+        REQUIRE(listBox->getSelectedItemIndex() == 42);
+
+        // Ids of the items behind a removed item must still be found
+        REQUIRE(listBox->removeItemByIndex(0));
+        REQUIRE(listBox->getSelectedItemIndex() == 41);
+        REQUIRE(!listBox->containsId("0"));
+        REQUIRE(listBox->getItemById("43") == "Item 43");
+        REQUIRE(listBox->changeItemById("43", "Item 43b"));
+        REQUIRE(listBox->getItems()[42] == "Item 43b");
+
+        listBox->setMaximumItems(100);
+        REQUIRE(listBox->getItemCount() == 100);
+        REQUIRE(!listBox->containsId("101"));
+        REQUIRE(listBox->containsId("100"));
+    }
+
     SECTION("ItemHeight")
     {
         listBox->setItemHeight(20);
@@ -405,3 +448,28 @@ TEST_CASE("[ListBox]")
         testSavingWidget("ListBox", listBox);
     }
 }
+
+TEST_CASE("[ListBox] many items benchmark", "[.benchmark]")
+{
+    auto listBox = tgui::ListBox::create();
+    listBox->getRenderer()->setFont("resources/DejaVuSans.ttf");
+    listBox->setSize(300, 400);
+
+    BENCHMARK("Adding 1000000 items")
+    {
+        for (unsigned int i = 0; i < 1000000; ++i)
+            listBox->addItem("Item " + std::to_string(i), std::to_string(i));
+    }
+
+    BENCHMARK("Changing the text size of 1000000 items")
+    {
+        for (unsigned int i = 10; i < 20; ++i)
+            listBox->setTextSize(i);
+    }
+
+    BENCHMARK("Selecting 1000 items by id")
+    {
+        for (unsigned int i = 0; i < 1000; ++i)
+            listBox->setSelectedItemById(std::to_string(i * 997));
+    }
+}
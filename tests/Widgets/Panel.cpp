@@ -268,5 +268,11 @@ TEST_CASE("[Panel]")
         panel->add(picture);
 
         TEST_DRAW("Panel.png")
+
+        // The cached colors are faded again when the opacity changes, also when they were set while the panel was invisible
+        panel->getRenderer()->setOpacity(0);
+        panel->getRenderer()->setBackgroundColor(sf::Color::Yellow);
+        panel->getRenderer()->setOpacity(0.7f);
+        TEST_DRAW("Panel.png")
     }
 }
@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/Widgets/Slider.hpp>
+#include <TGUI/Container.hpp>
 
 TEST_CASE("[Slider]")
 {
@@ -162,6 +163,27 @@ TEST_CASE("[Slider]")
 
             // TODO: Test value changes on mouse events
         }
+
+        SECTION("Thumb outside track after resize")
+        {
+            auto parent = std::make_shared<tgui::GuiContainer>();
+            parent->setSpatialIndexEnabled(true);
+
+            slider->setPosition(50, 50);
+            slider->setSize(200, 16);
+            parent->add(slider);
+
+            unsigned int mouseEnteredCount = 0;
+            slider->connect("MouseEntered", genericCallback, std::ref(mouseEnteredCount));
+
+            // The thumb becomes higher than the old full size of the slider
+            slider->setSize(200, 30);
+            parent->mouseMoved({150, 42});
+            REQUIRE(mouseEnteredCount == 1);
+
+            parent->leftMousePressed({150, 42});
+            REQUIRE(slider->isFocused());
+        }
     }
 
     testWidgetRenderer(slider->getRenderer());
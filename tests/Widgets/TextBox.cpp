@@ -363,6 +363,82 @@ TEST_CASE("[TextBox]")
             textBox->textEntered('C');
             REQUIRE(textBox->getText() == "ABCDEFGHIJKLMNOPQRSTUVWXYZABC");
         }
+
+        SECTION("Only edited paragraphs are word-wrapped again")
+        {
+            // The lines of the edited text box should be the same as when the text is word-wrapped from scratch
+            auto requireSameLines = [&]{
+                    auto reference = tgui::TextBox::copy(textBox);
+                    reference->setText(textBox->getText());
+                    REQUIRE(textBox->getLinesCount() == reference->getLinesCount());
+
+                    const std::size_t caretPosition = textBox->getCaretPosition();
+                    reference->setCaretPosition(caretPosition);
+                    REQUIRE(reference->getCaretPosition() == caretPosition);
+                };
+
+            textBox->setSize(150, 100);
+            textBox->setText("The quick brown fox\njumps over the lazy dog\n\nwhile the cat is sleeping in the sun");
+            requireSameLines();
+
+            textBox->setCaretPosition(10);
+            for (const char key : std::string{"very very very "})
+                textBox->textEntered(key);
+            requireSameLines();
+
+            textBox->textEntered('\n');
+            requireSameLines();
+
+            textBox->setCaretPosition(20);
+            for (unsigned int i = 0; i < 4; ++i)
+                textBox->keyPressed({sf::Keyboard::Key::Delete, false, false, false, false});
+            requireSameLines();
+
+            // Remove the newlines between the paragraphs one by one
+            for (std::size_t pos = textBox->getText().find('\n'); pos != sf::String::InvalidPos; pos = textBox->getText().find('\n'))
+            {
+                textBox->setCaretPosition(pos + 1);
+                textBox->keyPressed({sf::Keyboard::Key::BackSpace, false, false, false, false});
+                requireSameLines();
+            }
+
+            tgui::Clipboard::set("pasted\ntext that\n\nspans multiple paragraphs ");
+            textBox->setCaretPosition(5);
+            textBox->keyPressed({sf::Keyboard::Key::V, false, true, false, false});
+            requireSameLines();
+
+            textBox->setCaretPosition(3);
+            for (unsigned int i = 0; i < 30; ++i)
+                textBox->keyPressed({sf::Keyboard::Key::Right, false, false, true, false});
+            textBox->keyPressed({sf::Keyboard::Key::BackSpace, false, false, false, false});
+            requireSameLines();
+
+            textBox->setSize(250, 100);
+            textBox->textEntered('x');
+            requireSameLines();
+        }
+
+        SECTION("Selection is kept when the text is word-wrapped again")
+        {
+            textBox->setSize(150, 100);
+            textBox->setText("The quick brown fox\njumps over the lazy dog\n\nwhile the cat is sleeping in the sun");
+            textBox->setCaretPosition(24);
+            for (unsigned int i = 0; i < 30; ++i)
+                textBox->keyPressed({sf::Keyboard::Key::Right, false, false, true, false});
+            REQUIRE(textBox->getSelectedText() == "s over the lazy dog\n\nwhile the");
+
+            textBox->setSize(250, 100);
+            REQUIRE(textBox->getSelectedText() == "s over the lazy dog\n\nwhile the");
+
+            textBox->setSize(80, 100);
+            REQUIRE(textBox->getSelectedText() == "s over the lazy dog\n\nwhile the");
+
+            // Adding text at the end places the caret behind it without touching the other paragraphs
+            textBox->addText(" all day");
+            REQUIRE(textBox->getSelectedText() == "");
+            REQUIRE(textBox->getCaretPosition() == textBox->getText().getSize());
+            REQUIRE(textBox->getText() == "The quick brown fox\njumps over the lazy dog\n\nwhile the cat is sleeping in the sun all day");
+        }
     }
 
     testWidgetRenderer(textBox->getRenderer());
@@ -543,3 +619,33 @@ TEST_CASE("[TextBox]")
         }
     }
 }
+
+TEST_CASE("[TextBox] keystroke benchmark", "[.benchmark]")
+{
+    auto textBox = tgui::TextBox::create();
+    textBox->getRenderer()->setFont("resources/DejaVuSans.ttf");
+    textBox->setSize(400, 300);
+
+    const auto createDocument = [&](std::size_t lineCount){
+            sf::String text;
+            for (std::size_t i = 0; i < lineCount; ++i)
+                text += "Line " + std::to_string(i) + " of the log that is being viewed in the text box\n";
+
+            textBox->setText(text);
+            textBox->setCaretPosition(text.getSize() / 2);
+        };
+
+    createDocument(5000);
+    BENCHMARK("Typing 100 characters in a document of 5000 lines")
+    {
+        for (unsigned int i = 0; i < 100; ++i)
+            textBox->textEntered('x');
+    }
+
+    createDocument(50000);
+    BENCHMARK("Typing 100 characters in a document of 50000 lines")
+    {
+        for (unsigned int i = 0; i < 100; ++i)
+            textBox->textEntered('x');
+    }
+}